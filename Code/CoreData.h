@@ -26,6 +26,7 @@
 #import "RKEntityMapping.h"
 #import "RKManagedObjectCaching.h"
 #import "RKInMemoryManagedObjectCache.h"
+#import "RKEntityCacheSnapshot.h"
 #import "RKFetchRequestManagedObjectCache.h"
 
 #import "RKPropertyInspector+CoreData.h"
@@ -161,4 +161,20 @@
  */
 @property (nonatomic, copy) NSPredicate *destinationPredicate;
 
+///-------------------------------
+/// @name Freezing the Connection
+///-------------------------------
+
+/**
+ Makes the receiver immutable. Once frozen, setting the `includesSubentities`, `sourcePredicate` or `destinationPredicate` of the receiver raises an `NSInternalInconsistencyException`.
+
+ Connections are frozen by the `freeze` method of the entity mapping they were added to.
+ */
+- (void)freeze;
+
+/**
+ Returns a Boolean value that indicates if the receiver has been frozen.
+ */
+@property (nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
 @end
@@ -19,6 +19,7 @@
 //
 
 #import "RKConnectionDescription.h"
+#import "RKMapping_Private.h"
 
 static NSSet *RKSetWithInvalidAttributesForEntity(NSArray *attributes, NSEntityDescription *entity)
 {
@@ -40,6 +41,7 @@ static NSSet *RKSetWithInvalidAttributesForEntity(NSArray *attributes, NSEntityD
 @property (nonatomic, strong, readwrite) NSRelationshipDescription *relationship;
 @property (nonatomic, copy, readwrite) NSDictionary *attributes;
 @property (nonatomic, copy, readwrite) NSString *keyPath;
+@property (nonatomic, assign, readwrite, getter=isFrozen) BOOL frozen;
 @end
 
 @implementation RKConnectionDescription
@@ -98,6 +100,29 @@ static NSSet *RKSetWithInvalidAttributesForEntity(NSArray *attributes, NSEntityD
     return nil;
 }
 
+- (void)setIncludesSubentities:(BOOL)includesSubentities
+{
+    RKRaiseIfFrozen();
+    _includesSubentities = includesSubentities;
+}
+
+- (void)setSourcePredicate:(NSPredicate *)sourcePredicate
+{
+    RKRaiseIfFrozen();
+    _sourcePredicate = sourcePredicate;
+}
+
+- (void)setDestinationPredicate:(NSPredicate *)destinationPredicate
+{
+    RKRaiseIfFrozen();
+    _destinationPredicate = [destinationPredicate copy];
+}
+
+- (void)freeze
+{
+    self.frozen = YES;
+}
+
 - (BOOL)isForeignKeyConnection
 {
     return NO;
@@ -20,9 +20,17 @@
 
 #import <CoreData/CoreData.h>
 
+@class RKEntityCacheSnapshot;
+
 /**
  The `RKEntityByAttributeCache` class provides an in-memory caching mechanism for managed objects instances of an entity in a managed object context with the value of one of the object's attributes acting as the cache key. When loaded, the cache will retrieve all instances of an entity from the store and build a dictionary mapping values for the given cache key attribute to the managed object ID for all objects matching the value. The cache can then be used to quickly retrieve objects by attribute value for the cache key without executing another fetch request against the managed object context. This can provide a large performance improvement when a large number of objects are being retrieved using a particular attribute as the key.
 
+ Objects are keyed by the raw values of the cache key attributes rather than by a string representation of them: caches keyed by a single attribute use the attribute value itself as the key, while caches keyed by several attributes use an `RKEntityCacheKey`. Attribute values used to retrieve objects are coerced to the class Core Data uses for the type of their attribute, so that, for example, the string `@"12345"` retrieves objects whose numeric attribute is `12345` (see `RKEntityCacheKeyComponentForAttributeValue`).
+
+ The associations are partitioned into shards by the hash of their key, each synchronized independently with a reader-writer lock. Lookups only wait for writes to the shard holding their key, so objects can be added to and retrieved from the cache by concurrent mapping operations with little contention.
+
+ A cache with a `snapshotURL` loads from the snapshot at that URL when it still reflects the contents of the persistent store, avoiding the fetch of every instance of the entity. Snapshots are written by `RKEntityCache` as managed object contexts save (see `[RKEntityCache snapshotDirectoryURL]`).
+
  `RKEntityByAttributeCache` instances are used by the `RKEntityCache` to provide caching for multiple entities at once.
 
  @bug Please note that the `RKEntityByAttribute` cache is implemented using a `NSFetchRequest` with a result type of `NSDictionaryResultType`. This means that the cache **cannot** load pending object instances via a fetch from the `load` method. Pending objects must be manually added to the cache via `addObject:` if it is desirable for the pending objects to be retrieved by subsequent invocations of `objectWithAttributeValue:inContext:` and `objectsWithAttributeValue:inContext:` prior to a save.
@@ -82,11 +90,31 @@
  Loads the cache by finding all instances of the configured entity and building
  an association between the value of the cached attribute's value and the
  managed object ID for the object.
+
+ When the receiver has a `snapshotURL` and the snapshot at that URL is valid for the current generations of the persistent stores and records as many objects as the stores contain instances of the entity, the associations are read from the snapshot instead of being fetched. The object IDs of the snapshot are only built when the receiver is first accessed.
+
+ The loaded associations are merged with the objects added to the receiver while it was loading, leaving out those removed in the meantime. Flushing the receiver or loading it again while it is loading discards the associations of the earlier load.
  
  @param completion A block to execute when the cache has finished loading.
  */
 - (void)load:(void (^)(void))completion;
 
+/**
+ The number of objects fetched by each batch when loading the cache from the persistent store, or `0` to fetch every object at once.
+
+ When non-zero, `load:` first fetches the object IDs of every instance of the entity, then fetches the values of the cache key attributes in batches of object IDs, adding each batch to the cache as soon as it is fetched. The cache is marked as loaded as soon as loading begins. Until every batch has been loaded, lookups fetch the objects matching their keys, as the objects sharing a key may be spread across batches, so the first lookups do not wait for the whole entity to be loaded. If a batch fails to be fetched, the cache is not considered complete and no snapshot is taken of it.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger loadBatchSize;
+
+/**
+ A block invoked on the `callbackQueue` as the cache is loaded, with the number of objects loaded so far and the total number of objects to load. Invoked after each batch when loading in batches, and once otherwise.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) void (^loadProgressBlock)(NSUInteger loadedCount, NSUInteger totalCount);
+
 /**
  Flushes the cache by releasing all cache attribute value to managed object ID associations.
  
@@ -94,6 +122,61 @@
  */
 - (void)flush:(void (^)(void))completion;
 
+///------------------------------
+/// @name Limiting the Cache
+///------------------------------
+
+/**
+ The maximum number of object IDs held by the receiver, or `0` for no limit.
+
+ Once the limit is exceeded, keys are evicted with the clock algorithm, an approximation of least recently used eviction: keys that have not been looked up since the last sweep are evicted until the receiver holds 90% of the limit. Keys of objects with temporary object IDs are never evicted, as the objects cannot be fetched back from the store. Once objects have been evicted, lookups of keys missing from the receiver fetch the matching objects from the store and add them back. So do lookups of keys that were added back by adding objects to the receiver, as the objects sharing a key that was not unique may have been evicted along with it.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger countLimit;
+
+/**
+ Evicts the least recently used keys of the receiver until it holds no more than the given number of object IDs.
+
+ @param count The number of object IDs to retain.
+ */
+- (void)evictObjectsToCount:(NSUInteger)count;
+
+/**
+ The number of keys looked up and found in the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of keys looked up and missing from the receiver, whether or not they were then fetched from the store.
+ */
+@property (nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The number of object IDs evicted from the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger evictionCount;
+
+///------------------------------
+/// @name Persisting the Cache
+///------------------------------
+
+/**
+ The file URL of the snapshot from which the receiver is loaded when the snapshot is valid.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) NSURL *snapshotURL;
+
+/**
+ Returns a snapshot of the associations of the receiver, tagged with the current generations of the persistent stores.
+
+ Associations with temporary object IDs are omitted. The snapshot is only meaningful when the receiver holds every saved instance of the entity, so `nil` is returned unless the receiver has been loaded in full, without failures, and not flushed since.
+
+ @return A snapshot of the receiver, or `nil` if the receiver is not fully loaded.
+ */
+- (RKEntityCacheSnapshot *)snapshot;
+
 ///-----------------------------
 /// @name Inspecting Cache State
 ///-----------------------------
@@ -101,7 +184,12 @@
 /**
  A Boolean value indicating if the cache has loaded associations between cache attribute values and managed object ID's.
  */
-@property (nonatomic, getter=isLoaded, readonly) BOOL loaded;
+@property (getter=isLoaded, readonly) BOOL loaded;
+
+/**
+ A Boolean value indicating if the cache is being loaded in batches. Lookups fetch the objects matching their keys while the cache is loading.
+ */
+@property (getter=isLoading, readonly) BOOL loading;
 
 /**
  Returns a count of the total number of cached objects.
@@ -125,7 +213,7 @@
 
 /**
  Returns a Boolean value that indicates whether a given object is present
- in the cache.
+ in the cache. Objects evicted from the cache are not present.
 
  @param object An object.
  @return YES if object is present in the cache, otherwise NO.
@@ -183,6 +271,16 @@
  */
 - (void)removeObjects:(NSSet *)managedObjects completion:(void (^)(void))completion;
 
+/**
+ Synchronously removes the association between a managed object ID and the given values of the cache key attributes.
+
+ Used to remove objects whose attribute values are no longer available from the objects themselves, such as objects whose cache key attributes were changed or that were deleted by a save.
+
+ @param objectID The managed object ID to remove from the cache.
+ @param attributeValues The values of the cache key attributes the object ID is cached under.
+ */
+- (void)removeObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues;
+
 @end
 
 /*
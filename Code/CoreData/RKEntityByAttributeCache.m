@@ -18,75 +18,383 @@
 //  limitations under the License.
 //
 
+#import <pthread.h>
+#import <stdatomic.h>
 #import "NSManagedObject+RKAdditions.h"
 #import "RKEntityByAttributeCache.h"
 #import "RKPropertyInspector+CoreData.h"
 #import "RKObjectUtilities.h"
 #import "RKPropertyInspector.h"
 #import "RKLog.h"
+#import "RKEntityCacheKey.h"
+#import "RKEntityCacheSnapshot.h"
 
 // Set Logging Component
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitCoreDataCache
 
-static id RKCacheKeyValueForEntityAttributeWithValue(NSEntityDescription *entity, NSString *attribute, id value)
+// Returns the values of a collection in enumeration order, so that they can be addressed by index
+static NSArray *RKArrayOfValuesFromCollection(id collection)
 {
-    if ([value isKindOfClass:[NSString class]] || [value isEqual:[NSNull null]]) {
-        return value;
+    if ([collection isKindOfClass:[NSArray class]]) return collection;
+    if ([collection isKindOfClass:[NSOrderedSet class]]) return [collection array];
+    return [collection allObjects];
+}
+
+// The number of shards of each cache. Must be a power of two.
+static const NSUInteger RKEntityByAttributeCacheShardCount = 16;
+
+/**
+ An entry holds the object IDs cached under a key, along with the reference bit of the key for the clock eviction algorithm.
+
+ Entries created by adding single objects to a shard that has evicted keys are partial: the key may have been evicted, in which case the other objects sharing it are missing from the entry until they are fetched.
+ */
+@interface RKEntityByAttributeCacheEntry : NSObject
+@property (nonatomic, strong, readonly) NSMutableSet *objectIDs;
+// Set by lookups while holding only the read lock of the shard, so it is stored atomically
+@property (nonatomic, assign) BOOL referenced;
+@property (nonatomic, assign, getter=isPartial) BOOL partial;
+// The index of the slot of the key in the clock ring of the shard
+@property (nonatomic, assign) NSUInteger clockIndex;
+- (instancetype)initWithObjectIDs:(NSMutableSet *)objectIDs;
+- (BOOL)containsTemporaryObjectID;
+@end
+
+@implementation RKEntityByAttributeCacheEntry {
+    atomic_bool _referenced;
+}
+
+- (instancetype)initWithObjectIDs:(NSMutableSet *)objectIDs
+{
+    self = [super init];
+    if (self) {
+        _objectIDs = objectIDs;
+        atomic_init(&_referenced, false);
     }
-    return [value respondsToSelector:@selector(stringValue)] ? [value stringValue] : value;
+    return self;
 }
 
-static NSString *RKCacheKeyForEntityWithAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+- (BOOL)referenced
 {
-    // Performance optimization
-    if ([attributeValues count] == 1) return [[[attributeValues allValues] lastObject] description];
-    NSArray *sortedAttributes = [[attributeValues allKeys] sortedArrayUsingSelector:@selector(compare:)];
-    NSMutableArray *sortedValues = [NSMutableArray arrayWithCapacity:[sortedAttributes count]];
-    for (NSString *attributeName in sortedAttributes) {
-        id cacheKeyValue = RKCacheKeyValueForEntityAttributeWithValue(entity, attributeName, attributeValues[attributeName]);
-        [sortedValues addObject:cacheKeyValue];
-    };
+    return atomic_load_explicit(&_referenced, memory_order_relaxed);
+}
 
-    return [sortedValues componentsJoinedByString:@":"];
+- (void)setReferenced:(BOOL)referenced
+{
+    atomic_store_explicit(&_referenced, referenced, memory_order_relaxed);
 }
 
-/*
- This function recursively calculates a set of cache keys given a dictionary of attribute values. The basic premise is that we wish to decompose all arrays of values within the dictionary into a distinct cache key, as each object within the cache will appear for only one key.
+- (BOOL)containsTemporaryObjectID
+{
+    for (NSManagedObjectID *objectID in self.objectIDs) {
+        if ([objectID isTemporaryID]) return YES;
+    }
+    return NO;
+}
+
+@end
+
+/**
+ A shard holds the object IDs cached under the keys whose hash maps to it. Each shard is synchronized with its own reader-writer lock, so that lookups never wait for writes to other shards and lookups of the same shard proceed concurrently.
+
+ Keys are evicted with the clock algorithm: the keys of a shard are arranged in a ring swept by a hand, and each lookup of a key sets its reference bit. Sweeping a key clears its bit if set, giving it a second chance, and evicts it otherwise. Unlike a least recently used list, lookups never reorder the ring, so they only need the read lock.
  */
-static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *entity, NSDictionary *attributeValues)
+@interface RKEntityByAttributeCacheShard : NSObject
+@property (nonatomic, readonly) NSUInteger count;
+@property (nonatomic, readonly) NSUInteger countOfCacheKeys;
+- (NSSet *)objectIDsForCacheKey:(id)cacheKey partial:(BOOL *)partial;
+- (void)addObjectID:(NSManagedObjectID *)objectID forCacheKey:(id)cacheKey;
+- (void)addFetchedObjectIDs:(NSSet *)objectIDs forCacheKey:(id)cacheKey;
+- (void)removeObjectID:(NSManagedObjectID *)objectID forCacheKey:(id)cacheKey;
+- (BOOL)containsObjectID:(NSManagedObjectID *)objectID;
+- (void)removeAllObjectIDs;
+- (void)beginRecordingRemovals;
+- (void)endRecordingRemovals;
+- (void)mergeObjectIDsByCacheKey:(NSDictionary *)objectIDsByCacheKey complete:(BOOL)complete;
+- (void)enumerateObjectIDsUsingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID))block;
+- (NSUInteger)evictObjectIDsToCount:(NSUInteger)count;
+@end
+
+@implementation RKEntityByAttributeCacheShard {
+    pthread_rwlock_t _lock;
+    NSMutableDictionary *_entriesByCacheKey;
+    NSUInteger _count;
+    // The ring of keys swept by the clock hand. The slots of removed keys hold `NSNull` until they are reused by new keys.
+    NSMutableArray *_clock;
+    NSMutableIndexSet *_freeClockIndexes;
+    NSUInteger _clockHand;
+    // The object IDs removed from each key while the cache is loading, so that merging the fetched associations does not bring them back
+    NSMutableDictionary *_removedObjectIDsByCacheKey;
+    // YES once keys have been evicted, after which new entries may be missing objects of evicted keys
+    BOOL _hasEvictedObjectIDs;
+}
+
+- (instancetype)init
 {
-    NSMutableArray *cacheKeys = [NSMutableArray array];
-    NSSet *collectionKeys = [attributeValues keysOfEntriesPassingTest:^BOOL(id key, id obj, BOOL *stop) {
-        return RKObjectIsCollection(obj);
-    }];
+    self = [super init];
+    if (self) {
+        pthread_rwlock_init(&_lock, NULL);
+        _entriesByCacheKey = [NSMutableDictionary new];
+        _clock = [NSMutableArray new];
+        _freeClockIndexes = [NSMutableIndexSet indexSet];
+    }
+    return self;
+}
 
-    if ([collectionKeys count] > 0) {
-        for (NSString *attributeName in collectionKeys) {
-            id attributeValue = attributeValues[attributeName];
-            for (id value in attributeValue) {
-                NSMutableDictionary *mutableAttributeValues = [attributeValues mutableCopy];
-                [mutableAttributeValues setValue:value forKey:attributeName];
-                [cacheKeys addObjectsFromArray:RKCacheKeysForEntityFromAttributeValues(entity, mutableAttributeValues)];
-            }
+- (void)dealloc
+{
+    pthread_rwlock_destroy(&_lock);
+}
+
+- (NSUInteger)count
+{
+    pthread_rwlock_rdlock(&_lock);
+    NSUInteger count = _count;
+    pthread_rwlock_unlock(&_lock);
+    return count;
+}
+
+- (NSUInteger)countOfCacheKeys
+{
+    pthread_rwlock_rdlock(&_lock);
+    NSUInteger count = [_entriesByCacheKey count];
+    pthread_rwlock_unlock(&_lock);
+    return count;
+}
+
+// Must be invoked while holding the write lock
+- (void)insertCacheKey:(id)cacheKey intoClockWithEntry:(RKEntityByAttributeCacheEntry *)entry
+{
+    NSUInteger index = [_freeClockIndexes firstIndex];
+    if (index == NSNotFound) {
+        entry.clockIndex = [_clock count];
+        [_clock addObject:cacheKey];
+    } else {
+        [_freeClockIndexes removeIndex:index];
+        entry.clockIndex = index;
+        _clock[index] = cacheKey;
+    }
+}
+
+// Must be invoked while holding the write lock
+- (void)removeEntryForCacheKey:(id)cacheKey
+{
+    RKEntityByAttributeCacheEntry *entry = _entriesByCacheKey[cacheKey];
+    [_entriesByCacheKey removeObjectForKey:cacheKey];
+    _clock[entry.clockIndex] = [NSNull null];
+    [_freeClockIndexes addIndex:entry.clockIndex];
+}
+
+// Must be invoked while holding the write lock. Compacts the ring once most of it is free, so that sweeps do not spend their steps on free slots.
+- (void)compactClockIfNeeded
+{
+    if ([_freeClockIndexes count] > [_entriesByCacheKey count] + 64) {
+        NSMutableArray *clock = [NSMutableArray arrayWithCapacity:[_entriesByCacheKey count]];
+        NSUInteger clockHand = 0;
+        for (NSUInteger index = 0; index < [_clock count]; index++) {
+            if ([_freeClockIndexes containsIndex:index]) continue;
+            if (index < _clockHand) clockHand++;
+            id key = _clock[index];
+            [_entriesByCacheKey[key] setClockIndex:[clock count]];
+            [clock addObject:key];
         }
+        _clock = clock;
+        _clockHand = [clock count] ? clockHand % [clock count] : 0;
+        _freeClockIndexes = [NSMutableIndexSet indexSet];
+    }
+}
+
+- (NSSet *)objectIDsForCacheKey:(id)cacheKey partial:(BOOL *)partial
+{
+    pthread_rwlock_rdlock(&_lock);
+    RKEntityByAttributeCacheEntry *entry = _entriesByCacheKey[cacheKey];
+    entry.referenced = YES;
+    NSSet *objectIDs = [entry.objectIDs copy];
+    if (partial) *partial = entry.isPartial;
+    pthread_rwlock_unlock(&_lock);
+    return objectIDs;
+}
+
+// Must be invoked while holding the write lock. Complete object IDs are all the saved objects of the key.
+- (RKEntityByAttributeCacheEntry *)addObjectIDs:(NSSet *)objectIDs forCacheKey:(id)cacheKey complete:(BOOL)complete
+{
+    RKEntityByAttributeCacheEntry *entry = _entriesByCacheKey[cacheKey];
+    if (entry) {
+        NSUInteger previousCount = [entry.objectIDs count];
+        [entry.objectIDs unionSet:objectIDs];
+        _count += [entry.objectIDs count] - previousCount;
+        if (complete) entry.partial = NO;
     } else {
-        [cacheKeys addObject:RKCacheKeyForEntityWithAttributeValues(entity, attributeValues)];
+        entry = [[RKEntityByAttributeCacheEntry alloc] initWithObjectIDs:[objectIDs mutableCopy]];
+        entry.partial = ! complete && _hasEvictedObjectIDs;
+        _entriesByCacheKey[cacheKey] = entry;
+        [self insertCacheKey:cacheKey intoClockWithEntry:entry];
+        _count += [objectIDs count];
+    }
+    return entry;
+}
+
+- (void)addObjectID:(NSManagedObjectID *)objectID forCacheKey:(id)cacheKey
+{
+    pthread_rwlock_wrlock(&_lock);
+    // Objects added one at a time are being mapped, so they start out referenced
+    [[self addObjectIDs:[NSSet setWithObject:objectID] forCacheKey:cacheKey complete:NO] setReferenced:YES];
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)addFetchedObjectIDs:(NSSet *)objectIDs forCacheKey:(id)cacheKey
+{
+    pthread_rwlock_wrlock(&_lock);
+    [[self addObjectIDs:objectIDs forCacheKey:cacheKey complete:YES] setReferenced:YES];
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)removeObjectID:(NSManagedObjectID *)objectID forCacheKey:(id)cacheKey
+{
+    pthread_rwlock_wrlock(&_lock);
+    if (_removedObjectIDsByCacheKey) {
+        NSMutableSet *removedObjectIDs = _removedObjectIDsByCacheKey[cacheKey];
+        if (removedObjectIDs) {
+            [removedObjectIDs addObject:objectID];
+        } else {
+            _removedObjectIDsByCacheKey[cacheKey] = [NSMutableSet setWithObject:objectID];
+        }
+    }
+    RKEntityByAttributeCacheEntry *entry = _entriesByCacheKey[cacheKey];
+    if ([entry.objectIDs containsObject:objectID]) {
+        [entry.objectIDs removeObject:objectID];
+        _count--;
+        if ([entry.objectIDs count] == 0) {
+            [self removeEntryForCacheKey:cacheKey];
+            [self compactClockIfNeeded];
+        }
+    }
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (BOOL)containsObjectID:(NSManagedObjectID *)objectID
+{
+    BOOL containsObjectID = NO;
+    pthread_rwlock_rdlock(&_lock);
+    for (RKEntityByAttributeCacheEntry *entry in [_entriesByCacheKey objectEnumerator]) {
+        if ([entry.objectIDs containsObject:objectID]) {
+            containsObjectID = YES;
+            break;
+        }
+    }
+    pthread_rwlock_unlock(&_lock);
+    return containsObjectID;
+}
+
+- (void)removeAllObjectIDs
+{
+    pthread_rwlock_wrlock(&_lock);
+    _entriesByCacheKey = [NSMutableDictionary new];
+    _count = 0;
+    _clock = [NSMutableArray new];
+    _freeClockIndexes = [NSMutableIndexSet indexSet];
+    _clockHand = 0;
+    _removedObjectIDsByCacheKey = nil;
+    _hasEvictedObjectIDs = NO;
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)beginRecordingRemovals
+{
+    pthread_rwlock_wrlock(&_lock);
+    _removedObjectIDsByCacheKey = [NSMutableDictionary new];
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)endRecordingRemovals
+{
+    pthread_rwlock_wrlock(&_lock);
+    _removedObjectIDsByCacheKey = nil;
+    pthread_rwlock_unlock(&_lock);
+}
+
+// Merges associations fetched by a load with those written since the load began, skipping the associations removed since then
+- (void)mergeObjectIDsByCacheKey:(NSDictionary *)objectIDsByCacheKey complete:(BOOL)complete
+{
+    pthread_rwlock_wrlock(&_lock);
+    [objectIDsByCacheKey enumerateKeysAndObjectsUsingBlock:^(id cacheKey, NSSet *objectIDs, BOOL *stop) {
+        NSSet *removedObjectIDs = self->_removedObjectIDsByCacheKey[cacheKey];
+        if ([removedObjectIDs count]) {
+            NSMutableSet *remainingObjectIDs = [objectIDs mutableCopy];
+            [remainingObjectIDs minusSet:removedObjectIDs];
+            objectIDs = remainingObjectIDs;
+        }
+        if ([objectIDs count]) [self addObjectIDs:objectIDs forCacheKey:cacheKey complete:complete];
+    }];
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (void)enumerateObjectIDsUsingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID))block
+{
+    pthread_rwlock_rdlock(&_lock);
+    [_entriesByCacheKey enumerateKeysAndObjectsUsingBlock:^(id cacheKey, RKEntityByAttributeCacheEntry *entry, BOOL *stop) {
+        for (NSManagedObjectID *objectID in entry.objectIDs) block(cacheKey, objectID);
+    }];
+    pthread_rwlock_unlock(&_lock);
+}
+
+- (NSUInteger)evictObjectIDsToCount:(NSUInteger)count
+{
+    NSUInteger evictedCount = 0;
+    pthread_rwlock_wrlock(&_lock);
+
+    // Two revolutions clear every reference bit, after which every key not holding temporary object IDs has been considered for eviction
+    NSUInteger clockCount = [_clock count];
+    for (NSUInteger step = 0; _count > count && step < 2 * clockCount; step++) {
+        NSUInteger index = _clockHand;
+        _clockHand = (_clockHand + 1) % clockCount;
+        if ([_freeClockIndexes containsIndex:index]) continue;
+
+        id cacheKey = _clock[index];
+        RKEntityByAttributeCacheEntry *entry = _entriesByCacheKey[cacheKey];
+        if (entry.referenced) {
+            entry.referenced = NO;
+        } else if (! [entry containsTemporaryObjectID]) {
+            // Objects with temporary IDs cannot be fetched back from the store, so they are never evicted
+            _hasEvictedObjectIDs = YES;
+            _count -= [entry.objectIDs count];
+            evictedCount += [entry.objectIDs count];
+            [self removeEntryForCacheKey:cacheKey];
+        }
     }
+    [self compactClockIfNeeded];
+    pthread_rwlock_unlock(&_lock);
+    return evictedCount;
+}
 
-    return cacheKeys;
+@end
+
+static NSUInteger RKEntityByAttributeCacheShardIndexForCacheKey(id cacheKey)
+{
+    // Fold the high bits in, as the hash of small integers is the integer itself
+    NSUInteger hash = [cacheKey hash];
+    return (hash ^ (hash >> 16)) & (RKEntityByAttributeCacheShardCount - 1);
 }
 
 @interface RKEntityByAttributeCache ()
-@property (nonatomic, strong) NSMutableDictionary *cacheKeysToObjectIDs;
-#if OS_OBJECT_USE_OBJC
-@property (nonatomic, strong) dispatch_queue_t queue;
-#else
-@property (nonatomic, assign) dispatch_queue_t queue;
-#endif
+@property (nonatomic, copy) NSArray *shards;
+@property (atomic, assign, readwrite, getter=isLoaded) BOOL loaded;
+@property (atomic, assign, getter=isComplete) BOOL complete; // YES once every instance of the entity in the store has been loaded
+@property (atomic, assign, readwrite, getter=isLoading) BOOL loading;
+@property (atomic, assign) NSUInteger loadGeneration; // Advanced by each load and flush, so that the results of a superseded load are dropped
+@property (atomic, assign) BOOL hasEvictedObjects; // YES once objects have been evicted since the cache was last loaded
+@property (atomic, assign) BOOL hasFailedToLoadObjects; // YES once a batch of the load in progress has failed to be fetched
+@property (atomic, strong) RKEntityCacheSnapshot *pendingSnapshot; // The snapshot the receiver was loaded from, until it is decoded into the shards by the first access
 @end
 
-@implementation RKEntityByAttributeCache
+@implementation RKEntityByAttributeCache {
+    // The attributes sorted by name and their types, in the order in which their values appear in composite keys
+    NSArray *_sortedAttributes;
+    NSAttributeType *_sortedAttributeTypes;
+    _Atomic(NSUInteger) _hitCount;
+    _Atomic(NSUInteger) _missCount;
+    _Atomic(NSUInteger) _evictionCount;
+}
 
 - (instancetype)initWithEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames managedObjectContext:(NSManagedObjectContext *)context
 {
@@ -99,8 +407,16 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
         _entity = entity;
         _attributes = attributeNames;
         _managedObjectContext = context;
-        NSString *queueName = [[NSString alloc] initWithFormat:@"%@.%p", @"org.restkit.core-data.entity-by-attribute-cache", self];
-        self.queue = dispatch_queue_create([queueName UTF8String], DISPATCH_QUEUE_CONCURRENT);
+        _sortedAttributes = [attributeNames sortedArrayUsingSelector:@selector(compare:)];
+        _sortedAttributeTypes = (NSAttributeType *)calloc([_sortedAttributes count], sizeof(NSAttributeType));
+        NSDictionary *attributesByName = [entity attributesByName];
+        [_sortedAttributes enumerateObjectsUsingBlock:^(NSString *attributeName, NSUInteger index, BOOL *stop) {
+            NSAttributeDescription *attribute = attributesByName[attributeName];
+            self->_sortedAttributeTypes[index] = attribute ? [attribute attributeType] : NSUndefinedAttributeType;
+        }];
+        NSMutableArray *shards = [NSMutableArray arrayWithCapacity:RKEntityByAttributeCacheShardCount];
+        for (NSUInteger index = 0; index < RKEntityByAttributeCacheShardCount; index++) [shards addObject:[RKEntityByAttributeCacheShard new]];
+        self.shards = shards;
     }
 
     return self;
@@ -108,28 +424,105 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 
 - (void)dealloc
 {
-#if !OS_OBJECT_USE_OBJC
-    dispatch_release(_queue);
-    _queue = NULL;
-#endif
     _callbackQueue = NULL;
+    free(_sortedAttributeTypes);
+}
+
+#pragma mark - Cache Keys
+
+/*
+ Caches keyed by a single attribute use the attribute value itself as the key, avoiding any allocation for values such as tagged `NSNumber` objects. Caches keyed by several attributes use an `RKEntityCacheKey` holding the values in the order of the sorted attributes. In both cases the values are coerced to the class Core Data fetches for the type of their attribute.
+ */
+- (id)cacheKeyForAttributeValues:(NSDictionary *)attributeValues
+{
+    NSUInteger count = [_sortedAttributes count];
+    if (count == 1) return RKEntityCacheKeyComponentForAttributeValue(attributeValues[_sortedAttributes[0]], _sortedAttributeTypes[0]);
+
+    __strong id *components = (__strong id *)calloc(count, sizeof(id));
+    for (NSUInteger index = 0; index < count; index++) {
+        components[index] = RKEntityCacheKeyComponentForAttributeValue(attributeValues[_sortedAttributes[index]], _sortedAttributeTypes[index]);
+    }
+    RKEntityCacheKey *cacheKey = [[RKEntityCacheKey alloc] initWithValues:components count:count];
+    for (NSUInteger index = 0; index < count; index++) components[index] = nil;
+    free(components);
+    return cacheKey;
+}
+
+/*
+ Enumerates the cache keys matching a dictionary of attribute values. The values of the dictionary may be collections, in which case a key is produced for every combination of the values they contain (the cartesian product of the collections), as each cached object appears under exactly one key.
+ */
+- (void)enumerateCacheKeysForAttributeValues:(NSDictionary *)attributeValues usingBlock:(void (^)(id cacheKey))block
+{
+    NSUInteger count = [_sortedAttributes count];
+    BOOL containsCollection = NO;
+    for (NSString *attributeName in _sortedAttributes) {
+        id value = attributeValues[attributeName];
+        if (! value) return;
+        if (RKObjectIsCollection(value)) containsCollection = YES;
+    }
+
+    if (! containsCollection) {
+        block([self cacheKeyForAttributeValues:attributeValues]);
+        return;
+    }
+
+    if (count == 1) {
+        for (id value in attributeValues[_sortedAttributes[0]]) {
+            block(RKEntityCacheKeyComponentForAttributeValue(value, _sortedAttributeTypes[0]));
+        }
+        return;
+    }
+
+    NSMutableArray *valuesByAttribute = [NSMutableArray arrayWithCapacity:count];
+    for (NSString *attributeName in _sortedAttributes) {
+        id value = attributeValues[attributeName];
+        NSArray *values = RKObjectIsCollection(value) ? RKArrayOfValuesFromCollection(value) : @[ value ];
+        if ([values count] == 0) return;
+        [valuesByAttribute addObject:values];
+    }
+
+    __strong id *components = (__strong id *)calloc(count, sizeof(id));
+    NSUInteger *positions = (NSUInteger *)calloc(count, sizeof(NSUInteger));
+    BOOL exhausted = NO;
+    while (! exhausted) {
+        for (NSUInteger index = 0; index < count; index++) {
+            components[index] = RKEntityCacheKeyComponentForAttributeValue(valuesByAttribute[index][positions[index]], _sortedAttributeTypes[index]);
+        }
+        block([[RKEntityCacheKey alloc] initWithValues:components count:count]);
+
+        // Advance to the next combination, with the last attribute varying fastest
+        exhausted = YES;
+        for (NSUInteger index = count; index > 0; index--) {
+            if (++positions[index - 1] < [valuesByAttribute[index - 1] count]) {
+                exhausted = NO;
+                break;
+            }
+            positions[index - 1] = 0;
+        }
+    }
+    for (NSUInteger index = 0; index < count; index++) components[index] = nil;
+    free(components);
+    free(positions);
+}
+
+- (RKEntityByAttributeCacheShard *)shardForCacheKey:(id)cacheKey
+{
+    return _shards[RKEntityByAttributeCacheShardIndexForCacheKey(cacheKey)];
 }
 
 - (NSUInteger)count
 {
-    __block NSUInteger count;
-    dispatch_sync(self.queue, ^{
-        count = [[[self.cacheKeysToObjectIDs allValues] valueForKeyPath:@"@sum.@count"] integerValue];
-    });
+    [self decodePendingSnapshotIfNeeded];
+    NSUInteger count = 0;
+    for (RKEntityByAttributeCacheShard *shard in self.shards) count += [shard count];
     return count;
 }
 
 - (NSUInteger)countOfAttributeValues
 {
-    __block NSUInteger count;
-    dispatch_sync(self.queue, ^{
-        count = [self.cacheKeysToObjectIDs count];
-    });
+    [self decodePendingSnapshotIfNeeded];
+    NSUInteger count = 0;
+    for (RKEntityByAttributeCacheShard *shard in self.shards) count += [shard countOfCacheKeys];
     return count;
 }
 
@@ -138,7 +531,212 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     return [[self objectsWithAttributeValues:attributeValues inContext:self.managedObjectContext] count];
 }
 
+- (NSPersistentStoreCoordinator *)persistentStoreCoordinator
+{
+    NSManagedObjectContext *context = self.managedObjectContext;
+    while (context && ! [context persistentStoreCoordinator]) context = [context parentContext];
+    return [context persistentStoreCoordinator];
+}
+
+- (NSArray *)newObjectIDsByCacheKeyByShard
+{
+    NSMutableArray *objectIDsByCacheKeyByShard = [[NSMutableArray alloc] initWithCapacity:RKEntityByAttributeCacheShardCount];
+    for (NSUInteger index = 0; index < RKEntityByAttributeCacheShardCount; index++) [objectIDsByCacheKeyByShard addObject:[NSMutableDictionary dictionary]];
+    return objectIDsByCacheKeyByShard;
+}
+
+static void RKAddObjectIDForCacheKeyToShards(NSArray *objectIDsByCacheKeyByShard, NSManagedObjectID *objectID, id cacheKey)
+{
+    NSMutableDictionary *objectIDsByCacheKey = objectIDsByCacheKeyByShard[RKEntityByAttributeCacheShardIndexForCacheKey(cacheKey)];
+    NSMutableSet *objectIDs = objectIDsByCacheKey[cacheKey];
+    if (objectIDs) {
+        [objectIDs addObject:objectID];
+    } else {
+        objectIDsByCacheKey[cacheKey] = [NSMutableSet setWithObject:objectID];
+    }
+}
+
+/*
+ Merges associations fetched by the load of the given generation into each shard under its write lock, so that objects added or removed while loading are neither lost nor brought back. Returns `NO` without merging if the load has been superseded by another load or a flush.
+ */
+- (BOOL)mergeObjectIDsByCacheKeyByShard:(NSArray *)objectIDsByCacheKeyByShard complete:(BOOL)complete loadGeneration:(NSUInteger)loadGeneration
+{
+    @synchronized(self) {
+        if (self.loadGeneration != loadGeneration) {
+            RKLogDebug(@"Dropping results of superseded load of entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
+            return NO;
+        }
+        [self.shards enumerateObjectsUsingBlock:^(RKEntityByAttributeCacheShard *shard, NSUInteger index, BOOL *stop) {
+            [shard mergeObjectIDsByCacheKey:objectIDsByCacheKeyByShard[index] complete:complete];
+        }];
+    }
+    [self enforceCountLimit];
+    return YES;
+}
+
+// Marks the load of the given generation as finished, unless it has been superseded
+- (BOOL)finishLoadWithGeneration:(NSUInteger)loadGeneration complete:(BOOL)complete
+{
+    @synchronized(self) {
+        if (self.loadGeneration != loadGeneration) return NO;
+        // Removals are recorded until a pending snapshot is decoded, so that it does not bring back objects removed while loading
+        if (! self.pendingSnapshot) {
+            for (RKEntityByAttributeCacheShard *shard in self.shards) [shard endRecordingRemovals];
+        }
+        self.loaded = YES;
+        self.complete = complete && ! self.hasFailedToLoadObjects && ! self.hasEvictedObjects;
+        self.loading = NO;
+        return YES;
+    }
+}
+
+/*
+ Returns the snapshot of the receiver, or `nil` if there is no snapshot or it no longer reflects the contents of the store. Besides the store generations checked by the snapshot itself, the number of instances of the entity in the store must match the number of objects in the snapshot, which catches changes made without advancing the generations at the cost of a single count query. The first row of each store and entity of the snapshot must also be found in the store with the attribute values of its cache key, so that object IDs rebuilt from the snapshot are known to designate the objects they were taken from.
+ */
+- (RKEntityCacheSnapshot *)validSnapshot
+{
+    NSError *error = nil;
+    RKEntityCacheSnapshot *snapshot = [RKEntityCacheSnapshot snapshotWithContentsOfURL:self.snapshotURL error:&error];
+    if (! snapshot) {
+        RKLogDebug(@"No entity cache snapshot for Entity '%@' by attributes '%@' could be read from '%@': %@", self.entity.name, self.attributes, self.snapshotURL, error);
+        return nil;
+    }
+    if (! [snapshot isValidForEntity:self.entity attributes:_sortedAttributes persistentStoreCoordinator:[self persistentStoreCoordinator]]) {
+        RKLogDebug(@"Discarding stale entity cache snapshot %@", snapshot);
+        return nil;
+    }
+
+    // Objects pending in the context are not in the snapshot, as it is only taken of saved objects
+    NSFetchRequest *fetchRequest = [[NSFetchRequest alloc] init];
+    fetchRequest.entity = self.entity;
+    fetchRequest.includesPendingChanges = NO;
+    __block NSUInteger count = NSNotFound;
+    [self.managedObjectContext performBlockAndWait:^{
+        count = [self.managedObjectContext countForFetchRequest:fetchRequest error:&error];
+    }];
+    if (count != snapshot.count) {
+        RKLogDebug(@"Discarding entity cache snapshot %@: the store contains %ld instances of the entity", snapshot, (long)count);
+        if (count == NSNotFound) RKLogCoreDataError(error);
+        return nil;
+    }
+
+    __block BOOL verified = YES;
+    [snapshot enumerateSampleObjectIDsWithPersistentStoreCoordinator:[self persistentStoreCoordinator] usingBlock:^(id cacheKey, NSManagedObjectID *objectID, BOOL *stop) {
+        NSFetchRequest *sampleFetchRequest = [[NSFetchRequest alloc] init];
+        sampleFetchRequest.entity = self.entity;
+        sampleFetchRequest.includesPendingChanges = NO;
+        sampleFetchRequest.predicate = objectID ? [self predicateForObjectID:objectID cacheKey:cacheKey] : nil;
+        __block NSUInteger sampleCount = 0;
+        if (objectID) {
+            [self.managedObjectContext performBlockAndWait:^{
+                sampleCount = [self.managedObjectContext countForFetchRequest:sampleFetchRequest error:nil];
+            }];
+        }
+        if (sampleCount != 1) {
+            RKLogDebug(@"Discarding entity cache snapshot %@: object ID %@ is not in the store with the attribute values of cache key '%@'", snapshot, objectID, cacheKey);
+            verified = NO;
+            *stop = YES;
+        }
+    }];
+    return verified ? snapshot : nil;
+}
+
+// Returns a predicate matching the object with the given object ID if it has the attribute values of the given cache key
+- (NSPredicate *)predicateForObjectID:(NSManagedObjectID *)objectID cacheKey:(id)cacheKey
+{
+    NSUInteger count = [_sortedAttributes count];
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:count + 1];
+    [subpredicates addObject:[NSPredicate predicateWithFormat:@"SELF == %@", objectID]];
+    for (NSUInteger index = 0; index < count; index++) {
+        id value = (count == 1) ? cacheKey : [(RKEntityCacheKey *)cacheKey valueAtIndex:index];
+        [subpredicates addObject:[NSPredicate predicateWithFormat:@"%K == %@", _sortedAttributes[index], (value == [NSNull null]) ? nil : value]];
+    }
+    return [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+}
+
+/*
+ Decodes the snapshot the receiver was loaded from into the shards. Loading from a snapshot only reads and validates it, deferring the cost of building the object IDs of its rows until the receiver is first accessed.
+ */
+- (void)decodePendingSnapshotIfNeeded
+{
+    if (! self.pendingSnapshot) return;
+
+    @synchronized(self) {
+        RKEntityCacheSnapshot *snapshot = self.pendingSnapshot;
+        if (! snapshot) return;
+        NSArray *objectIDsByCacheKeyByShard = [self newObjectIDsByCacheKeyByShard];
+        [snapshot enumerateObjectIDsWithPersistentStoreCoordinator:[self persistentStoreCoordinator] usingBlock:^(id cacheKey, NSManagedObjectID *objectID) {
+            RKAddObjectIDForCacheKeyToShards(objectIDsByCacheKeyByShard, objectID, cacheKey);
+        }];
+        [self.shards enumerateObjectsUsingBlock:^(RKEntityByAttributeCacheShard *shard, NSUInteger index, BOOL *stop) {
+            [shard mergeObjectIDsByCacheKey:objectIDsByCacheKeyByShard[index] complete:YES];
+            [shard endRecordingRemovals];
+        }];
+        self.pendingSnapshot = nil;
+        RKLogDebug(@"Decoded entity cache snapshot %@ for Entity '%@' by attributes '%@'", snapshot, self.entity.name, self.attributes);
+    }
+    [self enforceCountLimit];
+}
+
+// Begins a load superseding any load in progress, and returns its generation
+- (NSUInteger)beginLoad
+{
+    @synchronized(self) {
+        self.loadGeneration += 1;
+        self.hasEvictedObjects = NO;
+        self.hasFailedToLoadObjects = NO;
+        self.pendingSnapshot = nil;
+        for (RKEntityByAttributeCacheShard *shard in self.shards) [shard beginRecordingRemovals];
+        return self.loadGeneration;
+    }
+}
+
+- (void)notifyLoadProgressWithLoadedCount:(NSUInteger)loadedCount totalCount:(NSUInteger)totalCount
+{
+    void (^loadProgressBlock)(NSUInteger, NSUInteger) = self.loadProgressBlock;
+    if (loadProgressBlock) {
+        dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), ^{
+            loadProgressBlock(loadedCount, totalCount);
+        });
+    }
+}
+
 - (void)load:(void (^)(void))completion
+{
+    NSUInteger loadGeneration = [self beginLoad];
+    if (self.loadBatchSize > 0) {
+        // The cache can be used as soon as loading begins, with lookups of keys not loaded yet falling back to fetches
+        self.loading = YES;
+        self.loaded = YES;
+    }
+    if (! self.snapshotURL) {
+        [self loadFromPersistentStoreWithGeneration:loadGeneration completion:completion];
+        return;
+    }
+
+    dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
+        RKEntityCacheSnapshot *snapshot = [self validSnapshot];
+        if (snapshot) {
+            BOOL finished = NO;
+            @synchronized(self) {
+                if (self.loadGeneration == loadGeneration) {
+                    self.pendingSnapshot = snapshot;
+                    finished = [self finishLoadWithGeneration:loadGeneration complete:YES];
+                }
+            }
+            if (finished) {
+                RKLogDebug(@"Loaded entity cache for Entity '%@' by attributes '%@' from snapshot %@", self.entity.name, self.attributes, snapshot);
+                [self notifyLoadProgressWithLoadedCount:snapshot.count totalCount:snapshot.count];
+            }
+            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        } else {
+            [self loadFromPersistentStoreWithGeneration:loadGeneration completion:completion];
+        }
+    });
+}
+
+// Returns a fetch request for the values of the cache key attributes and the object ID of instances of the entity
+- (NSFetchRequest *)newDictionaryFetchRequest
 {
     NSExpressionDescription* objectIDExpression = [NSExpressionDescription new];
     objectIDExpression.name = @"objectID";
@@ -150,7 +748,17 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
     fetchRequest.entity = self.entity;
     fetchRequest.resultType = NSDictionaryResultType;
     fetchRequest.propertiesToFetch = [self.attributes arrayByAddingObject:objectIDExpression];
+    return fetchRequest;
+}
 
+- (void)loadFromPersistentStoreWithGeneration:(NSUInteger)loadGeneration completion:(void (^)(void))completion
+{
+    if (self.loadBatchSize > 0) {
+        [self loadInBatchesFromPersistentStoreWithGeneration:loadGeneration completion:completion];
+        return;
+    }
+
+    NSFetchRequest *fetchRequest = [self newDictionaryFetchRequest];
     [self.managedObjectContext performBlock:^{
         NSError *error = nil;
         NSArray *dictionaries;
@@ -166,14 +774,16 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             RKLogCoreDataError(error);
         }
 
-        dispatch_barrier_async(self.queue, ^{
+        // Build the contents of the shards off the context's queue
+        dispatch_async(dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^{
             RKLogDebug(@"Loading entity cache for Entity '%@' by attributes '%@' in managed object context %@ (concurrencyType = %ld)",
                        self.entity.name, self.attributes, self.managedObjectContext, (unsigned long)self.managedObjectContext.concurrencyType);
-            self.cacheKeysToObjectIDs = [NSMutableDictionary dictionary];
+            NSArray *objectIDsByCacheKeyByShard = [self newObjectIDsByCacheKeyByShard];
             for (NSDictionary *dictionary in dictionaries) {
-                NSManagedObjectID *objectID = dictionary[@"objectID"];
-                NSDictionary *attributeValues = [dictionary dictionaryWithValuesForKeys:self.attributes];
-                [self cacheObjectID:objectID forAttributeValues:attributeValues];
+                RKAddObjectIDForCacheKeyToShards(objectIDsByCacheKeyByShard, dictionary[@"objectID"], [self cacheKeyForAttributeValues:dictionary]);
+            }
+            if ([self mergeObjectIDsByCacheKeyByShard:objectIDsByCacheKeyByShard complete:(dictionaries != nil) loadGeneration:loadGeneration] && [self finishLoadWithGeneration:loadGeneration complete:(dictionaries != nil)]) {
+                [self notifyLoadProgressWithLoadedCount:[dictionaries count] totalCount:[dictionaries count]];
             }
 
             if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
@@ -181,22 +791,137 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
      }];
 }
 
-- (void)flush:(void (^)(void))completion
+/*
+ Loads the cache in batches of `loadBatchSize` objects. The object IDs of all instances are fetched first, which only reads the primary keys of the rows, and the attribute values are then fetched for consecutive ranges of object IDs. Unlike paging with `fetchOffset`, this neither skips nor repeats rows deleted or inserted while loading.
+
+ Each batch is merged into the shards as soon as it is fetched, and is fetched from a separate block on the queue of the context, so that the targeted fetches of lookups for keys not loaded yet are interleaved with the batches rather than waiting for the whole load.
+ */
+- (void)loadInBatchesFromPersistentStoreWithGeneration:(NSUInteger)loadGeneration completion:(void (^)(void))completion
 {
-    dispatch_barrier_async(self.queue, ^{
-        RKLogDebug(@"Flushing entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
-        self.cacheKeysToObjectIDs = nil;
-        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-    });
+    NSFetchRequest *fetchRequest = [[NSFetchRequest alloc] init];
+    fetchRequest.entity = self.entity;
+    fetchRequest.resultType = NSManagedObjectIDResultType;
+
+    [self.managedObjectContext performBlock:^{
+        NSError *error = nil;
+        NSArray *objectIDs = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+        if (! objectIDs) {
+            RKLogWarning(@"Failed to load entity cache. Failed to execute fetch request: %@", fetchRequest);
+            RKLogCoreDataError(error);
+        }
+        RKLogDebug(@"Loading entity cache for Entity '%@' by attributes '%@' in batches of %ld of %ld objects",
+                   self.entity.name, self.attributes, (long)self.loadBatchSize, (long)[objectIDs count]);
+        [self loadBatchOfObjectIDs:objectIDs fromIndex:0 loadGeneration:loadGeneration completion:completion];
+    }];
 }
 
-- (BOOL)isLoaded
+- (void)loadBatchOfObjectIDs:(NSArray *)objectIDs fromIndex:(NSUInteger)index loadGeneration:(NSUInteger)loadGeneration completion:(void (^)(void))completion
 {
-    __block BOOL isLoaded;
-    dispatch_sync(self.queue, ^{
-        isLoaded = (self.cacheKeysToObjectIDs != nil);
-    });
-    return isLoaded;
+    [self.managedObjectContext performBlock:^{
+        if (self.loadGeneration != loadGeneration) {
+            RKLogDebug(@"Abandoning superseded load of entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
+            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+            return;
+        }
+
+        NSUInteger totalCount = [objectIDs count];
+        NSRange range = NSMakeRange(index, MIN(self.loadBatchSize, totalCount - index));
+        if (range.length > 0) {
+            NSFetchRequest *fetchRequest = [self newDictionaryFetchRequest];
+            fetchRequest.predicate = [NSPredicate predicateWithFormat:@"self IN %@", [objectIDs subarrayWithRange:range]];
+            NSError *error = nil;
+            NSArray *dictionaries = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+            if (! dictionaries) {
+                RKLogWarning(@"Failed to load batch of entity cache. Failed to execute fetch request: %@", fetchRequest);
+                RKLogCoreDataError(error);
+                // The objects of the batch are missing, so the cache must not be considered complete once loaded
+                @synchronized(self) {
+                    if (self.loadGeneration == loadGeneration) self.hasFailedToLoadObjects = YES;
+                }
+            }
+            NSArray *objectIDsByCacheKeyByShard = [self newObjectIDsByCacheKeyByShard];
+            for (NSDictionary *dictionary in dictionaries) {
+                RKAddObjectIDForCacheKeyToShards(objectIDsByCacheKeyByShard, dictionary[@"objectID"], [self cacheKeyForAttributeValues:dictionary]);
+            }
+            // The objects sharing a key may be spread across batches, so a batch does not complete the keys it holds
+            if ([self mergeObjectIDsByCacheKeyByShard:objectIDsByCacheKeyByShard complete:NO loadGeneration:loadGeneration]) {
+                [self notifyLoadProgressWithLoadedCount:NSMaxRange(range) totalCount:totalCount];
+            }
+        }
+
+        if (NSMaxRange(range) < totalCount) {
+            [self loadBatchOfObjectIDs:objectIDs fromIndex:NSMaxRange(range) loadGeneration:loadGeneration completion:completion];
+        } else {
+            if ([self finishLoadWithGeneration:loadGeneration complete:(objectIDs != nil)] && totalCount == 0) [self notifyLoadProgressWithLoadedCount:0 totalCount:0];
+            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
+        }
+    }];
+}
+
+/*
+ Fetches the objects matching the given attribute values and adds them to the receiver. Used by lookups while the receiver is loading in batches, as the objects of their keys may not have been loaded yet, and by lookups of keys missing from the receiver once objects have been evicted, as they may have been evicted.
+ */
+- (void)loadObjectIDsWithAttributeValues:(NSDictionary *)attributeValues
+{
+    NSMutableArray *subpredicates = [NSMutableArray arrayWithCapacity:[_sortedAttributes count]];
+    [_sortedAttributes enumerateObjectsUsingBlock:^(NSString *attributeName, NSUInteger index, BOOL *stop) {
+        id value = attributeValues[attributeName];
+        BOOL isCollection = RKObjectIsCollection(value);
+        NSMutableArray *values = [NSMutableArray array];
+        for (id element in (isCollection ? value : @[ value ])) {
+            id component = RKEntityCacheKeyComponentForAttributeValue(element, self->_sortedAttributeTypes[index]);
+            [values addObject:component];
+        }
+        if (isCollection) {
+            [subpredicates addObject:[NSPredicate predicateWithFormat:@"%K IN %@", attributeName, values]];
+        } else {
+            id component = [values firstObject];
+            [subpredicates addObject:[NSPredicate predicateWithFormat:@"%K == %@", attributeName, (component == [NSNull null]) ? nil : component]];
+        }
+    }];
+
+    NSFetchRequest *fetchRequest = [self newDictionaryFetchRequest];
+    fetchRequest.predicate = [NSCompoundPredicate andPredicateWithSubpredicates:subpredicates];
+    __block NSArray *dictionaries = nil;
+    __block NSError *error = nil;
+    [self.managedObjectContext performBlockAndWait:^{
+        dictionaries = [self.managedObjectContext executeFetchRequest:fetchRequest error:&error];
+    }];
+    if (! dictionaries) {
+        RKLogWarning(@"Failed to fetch objects with attribute values %@ of Entity '%@' while loading: %@", attributeValues, self.entity.name, fetchRequest);
+        RKLogCoreDataError(error);
+    }
+    NSMutableDictionary *objectIDsByCacheKey = [NSMutableDictionary dictionary];
+    for (NSDictionary *dictionary in dictionaries) {
+        id cacheKey = [self cacheKeyForAttributeValues:dictionary];
+        NSMutableSet *objectIDs = objectIDsByCacheKey[cacheKey];
+        if (objectIDs) {
+            [objectIDs addObject:dictionary[@"objectID"]];
+        } else {
+            objectIDsByCacheKey[cacheKey] = [NSMutableSet setWithObject:dictionary[@"objectID"]];
+        }
+    }
+    // The fetch returned every saved object of the keys, completing their entries
+    [objectIDsByCacheKey enumerateKeysAndObjectsUsingBlock:^(id cacheKey, NSSet *objectIDs, BOOL *stop) {
+        [[self shardForCacheKey:cacheKey] addFetchedObjectIDs:objectIDs forCacheKey:cacheKey];
+    }];
+    [self enforceCountLimit];
+}
+
+- (void)flush:(void (^)(void))completion
+{
+    RKLogDebug(@"Flushing entity cache for Entity '%@' by attributes '%@'", self.entity.name, self.attributes);
+    // Supersede any load in progress, so that its results are not merged into the flushed cache
+    @synchronized(self) {
+        self.loadGeneration += 1;
+        self.loaded = NO;
+        self.complete = NO;
+        self.loading = NO;
+        self.hasEvictedObjects = NO;
+        self.pendingSnapshot = nil;
+        for (RKEntityByAttributeCacheShard *shard in self.shards) [shard removeAllObjectIDs];
+    }
+    if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
 }
 
 - (NSManagedObject *)objectForObjectID:(NSManagedObjectID *)objectID inContext:(NSManagedObjectContext *)context
@@ -232,28 +957,47 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 - (NSSet *)objectsWithAttributeValues:(NSDictionary *)attributeValues inContext:(NSManagedObjectContext *)context
 {
     NSMutableSet *objects = [NSMutableSet set];
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
-        __block NSSet *objectIDs = nil;
-        dispatch_sync(self.queue, ^{
-            objectIDs = [[NSSet alloc] initWithSet:(self.cacheKeysToObjectIDs)[cacheKey] copyItems:YES];
-        });
-        if ([objectIDs count]) {
-            /**
-             NOTE:
-             In my benchmarking, retrieving the objects one at a time using existingObjectWithID: is significantly faster
-             than issuing a single fetch request against all object ID's.
-             */
-            for (NSManagedObjectID *objectID in objectIDs) {
-                NSManagedObject *object = [self objectForObjectID:objectID inContext:context];
-                if (object) {
-                    [objects addObject:object];
-                } else {
-                    RKLogDebug(@"Evicting objectID association for attributes %@ of Entity '%@': %@", attributeValues, self.entity.name, objectID);
-                    [self evictObjectID:objectID forAttributeValues:attributeValues];
-                }
+    void (^addObjectsWithObjectIDs)(NSSet *) = ^(NSSet *objectIDs) {
+        /**
+         NOTE:
+         In my benchmarking, retrieving the objects one at a time using existingObjectWithID: is significantly faster
+         than issuing a single fetch request against all object ID's.
+         */
+        for (NSManagedObjectID *objectID in objectIDs) {
+            NSManagedObject *object = [self objectForObjectID:objectID inContext:context];
+            if (object) {
+                [objects addObject:object];
+            } else {
+                RKLogDebug(@"Evicting objectID association for attributes %@ of Entity '%@': %@", attributeValues, self.entity.name, objectID);
+                [self evictObjectID:objectID forAttributeValues:attributeValues];
             }
         }
+    };
+
+    [self decodePendingSnapshotIfNeeded];
+
+    // While loading in batches, the objects sharing a key may be spread across batches, so even keys found in the receiver may only be partly loaded. Once objects have been evicted, missing keys may have been evicted, and keys added back since then may be missing the objects evicted with them.
+    BOOL isLoading = self.isLoading;
+    BOOL hasEvictedObjects = self.hasEvictedObjects;
+    NSMutableArray *cacheKeysToFetch = [NSMutableArray array];
+    [self enumerateCacheKeysForAttributeValues:attributeValues usingBlock:^(id cacheKey) {
+        BOOL isPartial = NO;
+        NSSet *objectIDs = [[self shardForCacheKey:cacheKey] objectIDsForCacheKey:cacheKey partial:&isPartial];
+        if ([objectIDs count]) {
+            atomic_fetch_add_explicit(&self->_hitCount, 1, memory_order_relaxed);
+        } else {
+            atomic_fetch_add_explicit(&self->_missCount, 1, memory_order_relaxed);
+        }
+        if (isLoading || isPartial || (hasEvictedObjects && [objectIDs count] == 0)) {
+            [cacheKeysToFetch addObject:cacheKey];
+        } else {
+            addObjectsWithObjectIDs(objectIDs);
+        }
+    }];
+
+    if ([cacheKeysToFetch count]) {
+        [self loadObjectIDsWithAttributeValues:attributeValues];
+        for (id cacheKey in cacheKeysToFetch) addObjectsWithObjectIDs([[self shardForCacheKey:cacheKey] objectIDsForCacheKey:cacheKey partial:NULL]);
     }
     return objects;
 }
@@ -262,50 +1006,105 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 {
     NSParameterAssert(objectID);
     NSParameterAssert(attributeValues);
-    NSString *cacheKey = RKCacheKeyForEntityWithAttributeValues(self.entity, attributeValues);
-    NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
-    if (objectIDs) {
-        if (! [objectIDs containsObject:objectID]) {
-            [objectIDs addObject:objectID];
-        }
-    } else {
-        objectIDs = [NSMutableSet setWithObject:objectID];
-    }
-
-    if (nil == self.cacheKeysToObjectIDs) self.cacheKeysToObjectIDs = [NSMutableDictionary dictionary];
-    [self.cacheKeysToObjectIDs setValue:objectIDs forKey:cacheKey];
+    [self decodePendingSnapshotIfNeeded];
+    id cacheKey = [self cacheKeyForAttributeValues:attributeValues];
+    [[self shardForCacheKey:cacheKey] addObjectID:objectID forCacheKey:cacheKey];
+    self.loaded = YES;
 }
 
-- (void)deleteObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
+- (void)removeObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
 {
     NSParameterAssert(objectID);
     NSParameterAssert(attributeValues);
-    NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-    for (NSString *cacheKey in cacheKeys) {
-        NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
-        if (objectIDs && [objectIDs containsObject:objectID]) {
-            [objectIDs removeObject:objectID];
-        }
-    }
+    [self decodePendingSnapshotIfNeeded];
+    [self enumerateCacheKeysForAttributeValues:attributeValues usingBlock:^(id cacheKey) {
+        [[self shardForCacheKey:cacheKey] removeObjectID:objectID forCacheKey:cacheKey];
+    }];
 }
 
 - (void)evictObjectID:(NSManagedObjectID *)objectID forAttributeValues:(NSDictionary *)attributeValues
 {
     if (attributeValues && [attributeValues count]) {
-        NSArray *cacheKeys = RKCacheKeysForEntityFromAttributeValues(self.entity, attributeValues);
-        dispatch_barrier_async(self.queue, ^{
-            for (NSString *cacheKey in cacheKeys) {
-                NSMutableSet *objectIDs = (self.cacheKeysToObjectIDs)[cacheKey];
-                if (objectIDs && [objectIDs containsObject:objectID]) {
-                    [objectIDs removeObject:objectID];
-                }
-            }
-        });
+        [self removeObjectID:objectID forAttributeValues:attributeValues];
     } else {
         RKLogWarning(@"Unable to remove object for object ID %@: empty values dictionary for attributes '%@'", objectID, self.attributes);
     }
 }
 
+#pragma mark - Eviction
+
+- (NSUInteger)hitCount
+{
+    return atomic_load_explicit(&_hitCount, memory_order_relaxed);
+}
+
+- (NSUInteger)missCount
+{
+    return atomic_load_explicit(&_missCount, memory_order_relaxed);
+}
+
+- (NSUInteger)evictionCount
+{
+    return atomic_load_explicit(&_evictionCount, memory_order_relaxed);
+}
+
+- (void)enforceCountLimit
+{
+    NSUInteger countLimit = self.countLimit;
+    if (countLimit == 0 || [self count] <= countLimit) return;
+
+    // Evict to below the limit, so that the cost of sweeping is amortized over several additions
+    [self evictObjectsToCount:countLimit - countLimit / 10];
+}
+
+- (void)evictObjectsToCount:(NSUInteger)count
+{
+    NSUInteger currentCount = [self count];
+    if (currentCount <= count) return;
+
+    // Flag the eviction before any key is evicted, so that concurrent lookups of evicted keys fetch them and no snapshot is taken of the receiver
+    self.hasEvictedObjects = YES;
+    self.complete = NO;
+
+    // Keys are spread across the shards by hash, so each shard is trimmed in proportion to its size
+    NSUInteger evictedCount = 0;
+    for (RKEntityByAttributeCacheShard *shard in self.shards) {
+        NSUInteger shardCount = [shard count];
+        evictedCount += [shard evictObjectIDsToCount:(NSUInteger)((unsigned long long)shardCount * count / currentCount)];
+    }
+    if (evictedCount) {
+        atomic_fetch_add_explicit(&_evictionCount, evictedCount, memory_order_relaxed);
+        RKLogDebug(@"Evicted %ld objects from entity cache for Entity '%@' by attributes '%@'", (long)evictedCount, self.entity.name, self.attributes);
+    }
+}
+
+#pragma mark - Snapshots
+
+- (RKEntityCacheSnapshot *)snapshot
+{
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [self persistentStoreCoordinator];
+    if (! self.isComplete || self.isLoading || ! persistentStoreCoordinator) return nil;
+
+    [self decodePendingSnapshotIfNeeded];
+    NSMutableArray *cacheKeys = [NSMutableArray array];
+    NSMutableArray *objectIDs = [NSMutableArray array];
+    for (RKEntityByAttributeCacheShard *shard in self.shards) {
+        [shard enumerateObjectIDsUsingBlock:^(id cacheKey, NSManagedObjectID *objectID) {
+            // Temporary object IDs cannot be resolved once their context is gone
+            if ([objectID isTemporaryID]) return;
+            [cacheKeys addObject:cacheKey];
+            [objectIDs addObject:objectID];
+        }];
+    }
+    return [[RKEntityCacheSnapshot alloc] initWithEntity:self.entity
+                                              attributes:_sortedAttributes
+                                             generations:RKEntityCacheGenerationsOfPersistentStoreCoordinator(persistentStoreCoordinator)
+                                               cacheKeys:cacheKeys
+                                               objectIDs:objectIDs];
+}
+
+#pragma mark - Managing Cached Objects
+
 - (void)addObjects:(NSSet *)managedObjects completion:(void (^)(void))completion
 {
     if ([managedObjects count] == 0) {
@@ -327,17 +1126,12 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             newObjectIDsToAttributeValues[objectID] = attributeValues;
         }
 
-        if ([newObjectIDsToAttributeValues count]) {
-            dispatch_barrier_async(self.queue, ^{
-                [newObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
-                    [self cacheObjectID:objectID forAttributeValues:attributeValues];
-                }];
-
-                if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-            });
-        } else {
-            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-        }
+        // Each object only locks the shard of its own key, so lookups of other keys are not stalled
+        [newObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
+            [self cacheObjectID:objectID forAttributeValues:attributeValues];
+        }];
+        [self enforceCountLimit];
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
     }];
 }
 
@@ -362,17 +1156,10 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
             deletedObjectIDsToAttributeValues[objectID] = attributeValues;
         }
 
-        if ([deletedObjectIDsToAttributeValues count]) {
-            dispatch_barrier_async(self.queue, ^{
-                [deletedObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
-                    [self deleteObjectID:objectID forAttributeValues:attributeValues];
-                }];
-
-                if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-            });
-        } else {
-            if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
-        }
+        [deletedObjectIDsToAttributeValues enumerateKeysAndObjectsUsingBlock:^(NSManagedObjectID *objectID, NSDictionary *attributeValues, BOOL *stop) {
+            [self removeObjectID:objectID forAttributeValues:attributeValues];
+        }];
+        if (completion) dispatch_async(self.callbackQueue ?: dispatch_get_main_queue(), completion);
     }];
 }
 
@@ -383,11 +1170,12 @@ static NSArray *RKCacheKeysForEntityFromAttributeValues(NSEntityDescription *ent
 
 - (BOOL)containsObject:(NSManagedObject *)object
 {
-    __block NSArray *allObjectIDs = nil;
-    dispatch_sync(self.queue, ^{
-        allObjectIDs = [[self.cacheKeysToObjectIDs allValues] valueForKeyPath:@"@distinctUnionOfSets.self"];
-    });
-    return [allObjectIDs containsObject:object.objectID];
+    [self decodePendingSnapshotIfNeeded];
+    NSManagedObjectID *objectID = object.objectID;
+    for (RKEntityByAttributeCacheShard *shard in self.shards) {
+        if ([shard containsObjectID:objectID]) return YES;
+    }
+    return NO;
 }
 
 @end
@@ -55,6 +55,87 @@
  */
 @property (nonatomic, assign) dispatch_queue_t callbackQueue;
 
+///-------------------------------
+/// @name Limiting the Caches
+///-------------------------------
+
+/**
+ The maximum number of object IDs held by all of the attribute caches of the receiver, or `0` for no limit.
+
+ Once the limit is exceeded, the least recently used keys of each attribute cache are evicted in proportion to its size, until the caches hold 90% of the limit. Lookups of evicted keys fetch the matching objects from the store (see `[RKEntityByAttributeCache countLimit]`).
+
+ When the receiver or any of its entities has a count limit, memory warnings evict the least recently used half of the caches instead of flushing them entirely.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger countLimit;
+
+/**
+ Sets the maximum number of object IDs held by each attribute cache of the given entity.
+
+ @param countLimit The maximum number of object IDs, or `0` for no limit.
+ @param entity The entity to limit the attribute caches of.
+ */
+- (void)setCountLimit:(NSUInteger)countLimit forEntity:(NSEntityDescription *)entity;
+
+/**
+ Returns the maximum number of object IDs held by each attribute cache of the given entity, or `0` if there is no limit.
+
+ @param entity The entity to return the count limit of.
+ @return The count limit of the attribute caches of the entity.
+ */
+- (NSUInteger)countLimitForEntity:(NSEntityDescription *)entity;
+
+/**
+ The number of keys looked up and found in the attribute caches of the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of keys looked up and missing from the attribute caches of the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The number of object IDs evicted from the attribute caches of the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger evictionCount;
+
+///-------------------------------
+/// @name Persisting the Caches
+///-------------------------------
+
+/**
+ The file URL of the directory in which snapshots of the attribute caches of the receiver are persisted, typically the directory returned by `RKEntityCacheSnapshotDirectoryURLForPersistentStore` for the SQLite store of the context. When `nil`, caches are always loaded by fetching every instance of their entity.
+
+ When set, attribute caches are loaded from their snapshot whenever it is valid (see `RKEntityCacheSnapshot`), and the receiver observes every managed object context saving directly to the persistent store coordinator of its context. Before a save, the generations recorded in the metadata of the persistent stores are advanced, so that the snapshots on disk are invalidated along with the saved changes. Once the save completes, the saved changes are applied to the attribute caches and fresh snapshots of the fully loaded caches are written in the background. Snapshots are not written while any other save is in flight, nor after a save that failed until its context saves again.
+
+ Snapshots can only be fully trusted if every save to the store happens while a cache persisting snapshots to the same directory is observing it. Attribute caches discard a snapshot whose number of objects differs from the number of instances of its entity in the store, which catches unobserved insertions and deletions but not unobserved changes to the values of cache key attributes.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) NSURL *snapshotDirectoryURL;
+
+///-------------------------------
+/// @name Loading the Caches
+///-------------------------------
+
+/**
+ The number of objects fetched by each batch when loading the attribute caches created by the receiver, or `0` to load each cache with a single fetch.
+
+ **Default**: `0`
+ @see `[RKEntityByAttributeCache loadBatchSize]`
+ */
+@property (nonatomic, assign) NSUInteger loadBatchSize;
+
+/**
+ A block invoked on the `callbackQueue` as the attribute caches created by the receiver are loaded, with the cache being loaded, the number of objects loaded so far and the total number of objects to load.
+
+ **Default**: `nil`
+ @see `[RKEntityByAttributeCache loadProgressBlock]`
+ */
+@property (nonatomic, copy) void (^loadProgressBlock)(RKEntityByAttributeCache *attributeCache, NSUInteger loadedCount, NSUInteger totalCount);
+
 ///------------------------------------
 /// @name Caching Objects by Attributes
 ///------------------------------------
@@ -105,6 +186,8 @@
 /**
  Retrieves the underlying entity attribute cache for a given entity and attribute.
 
+ Attribute caches are indexed by entity and set of attribute names, so the order of the given attribute names is irrelevant and retrieval does not depend on the number of caches.
+
  @param entity The entity to retrieve the entity attribute cache object for.
  @param attributeNames  The attribute to retrieve the entity attribute cache object for.
  @return The entity attribute cache for the given entity and attribute, or nil if none was found.
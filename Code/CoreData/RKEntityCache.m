@@ -25,12 +25,42 @@
 
 #import "RKEntityByAttributeCache.h"
 #import "RKEntityCache.h"
+#import "RKEntityCacheSnapshot.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitCoreDataCache
+
+static dispatch_queue_t RKEntityCacheSnapshotQueue(void)
+{
+    static dispatch_once_t onceToken;
+    static dispatch_queue_t snapshotQueue;
+    dispatch_once(&onceToken, ^{
+        snapshotQueue = dispatch_queue_create("org.restkit.core-data.entity-cache.snapshot-queue", DISPATCH_QUEUE_SERIAL);
+    });
+    return snapshotQueue;
+}
+
+// Attribute caches are indexed by the name of a single attribute, or by the set of names of several attributes, as the order of the attributes of a cache is irrelevant
+static id RKAttributeCacheIndexKeyForAttributeNames(id<NSFastEnumeration> attributeNames, NSUInteger count)
+{
+    if (count == 1) {
+        for (NSString *attributeName in attributeNames) return attributeName;
+    }
+    NSMutableSet *attributeNameSet = [NSMutableSet setWithCapacity:count];
+    for (NSString *attributeName in attributeNames) [attributeNameSet addObject:attributeName];
+    return attributeNameSet;
+}
 
 @interface RKEntityCache ()
-@property (nonatomic, strong) NSMutableSet *attributeCaches;
+@property (nonatomic, strong) NSMutableDictionary *attributeCachesByEntityName;
 @property (nonatomic, strong) NSLock *accessLock;
 @property (nonatomic, strong) NSMutableArray *pendingFlushCompletionBlocks;
 @property (nonatomic) NSInteger accessCount;
+@property (nonatomic, strong) NSMapTable *pendingRemovalsBySavingContext;
+@property (nonatomic, assign) BOOL snapshotWriteScheduled;
+@property (nonatomic, strong) NSMutableDictionary *countLimitsByEntityName;
 @end
 
 @implementation RKEntityCache
@@ -41,9 +71,11 @@
     self = [super init];
     if (self) {
         _managedObjectContext = context;
-        _attributeCaches = [[NSMutableSet alloc] init];
+        _attributeCachesByEntityName = [[NSMutableDictionary alloc] init];
         _accessLock = [NSLock new];
         _pendingFlushCompletionBlocks = [NSMutableArray new];
+        _pendingRemovalsBySavingContext = [NSMapTable weakToStrongObjectsMapTable];
+        _countLimitsByEntityName = [NSMutableDictionary new];
 
 #if TARGET_OS_IPHONE
         [[NSNotificationCenter defaultCenter] addObserver:self
@@ -70,14 +102,35 @@
 {
     NSParameterAssert(entity);
     NSParameterAssert(attributeNames);
+    void (^loadCompletion)(void) = ^{
+        [self enforceCountLimit];
+        if (completion) completion();
+    };
     RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:attributeNames];
     if (attributeCache && !attributeCache.isLoaded) {
-        [attributeCache load:completion];
+        [attributeCache load:loadCompletion];
     } else {
         attributeCache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:attributeNames managedObjectContext:self.managedObjectContext];
         attributeCache.callbackQueue = self.callbackQueue;
-        [attributeCache load:completion];
-        [self.attributeCaches addObject:attributeCache];
+        attributeCache.loadBatchSize = self.loadBatchSize;
+        attributeCache.countLimit = [self countLimitForEntity:entity];
+        void (^loadProgressBlock)(RKEntityByAttributeCache *, NSUInteger, NSUInteger) = self.loadProgressBlock;
+        if (loadProgressBlock) {
+            __weak RKEntityByAttributeCache *weakAttributeCache = attributeCache;
+            attributeCache.loadProgressBlock = ^(NSUInteger loadedCount, NSUInteger totalCount) {
+                loadProgressBlock(weakAttributeCache, loadedCount, totalCount);
+            };
+        }
+        if (self.snapshotDirectoryURL) attributeCache.snapshotURL = RKEntityCacheSnapshotURLForEntity(self.snapshotDirectoryURL, entity, attributeNames);
+        [attributeCache load:loadCompletion];
+        @synchronized(self.attributeCachesByEntityName) {
+            NSMutableDictionary *attributeCachesByAttributes = self.attributeCachesByEntityName[entity.name];
+            if (! attributeCachesByAttributes) {
+                attributeCachesByAttributes = [NSMutableDictionary dictionary];
+                self.attributeCachesByEntityName[entity.name] = attributeCachesByAttributes;
+            }
+            attributeCachesByAttributes[RKAttributeCacheIndexKeyForAttributeNames(attributeNames, [attributeNames count])] = attributeCache;
+        }
     }
 }
 
@@ -94,7 +147,7 @@
     NSParameterAssert(entity);
     NSParameterAssert(attributeValues);
     NSParameterAssert(context);
-    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:[attributeValues allKeys]];
+    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributeIndexKey:RKAttributeCacheIndexKeyForAttributeNames(attributeValues, [attributeValues count])];
     if (attributeCache) {
         return [attributeCache objectWithAttributeValues:attributeValues inContext:context];
     }
@@ -107,7 +160,7 @@
     NSParameterAssert(entity);
     NSParameterAssert(attributeValues);
     NSParameterAssert(context);
-    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributes:[attributeValues allKeys]];
+    RKEntityByAttributeCache *attributeCache = [self attributeCacheForEntity:entity attributeIndexKey:RKAttributeCacheIndexKeyForAttributeNames(attributeValues, [attributeValues count])];
     if (attributeCache) {
         return [attributeCache objectsWithAttributeValues:attributeValues inContext:context];
     }
@@ -115,32 +168,46 @@
     return [NSSet set];
 }
 
+- (RKEntityByAttributeCache *)attributeCacheForEntity:(NSEntityDescription *)entity attributeIndexKey:(id)attributeIndexKey
+{
+    RKEntityByAttributeCache *attributeCache = nil;
+    @synchronized(self.attributeCachesByEntityName) {
+        attributeCache = self.attributeCachesByEntityName[entity.name][attributeIndexKey];
+    }
+    return [attributeCache.entity isEqual:entity] ? attributeCache : nil;
+}
+
 - (RKEntityByAttributeCache *)attributeCacheForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames
 {
     NSParameterAssert(entity);
     NSParameterAssert(attributeNames);
-    for (RKEntityByAttributeCache *cache in [self.attributeCaches copy]) {
-        if ([cache.entity isEqual:entity] && [cache.attributes isEqualToArray:attributeNames]) {
-            return cache;
-        }
-    }
-
-    return nil;
+    return [self attributeCacheForEntity:entity attributeIndexKey:RKAttributeCacheIndexKeyForAttributeNames(attributeNames, [attributeNames count])];
 }
 
 - (NSSet *)attributeCachesForEntity:(NSEntityDescription *)entity
 {
     NSAssert(entity, @"Cannot retrieve attribute caches for a nil entity");
     NSMutableSet *set = [NSMutableSet set];
-    for (RKEntityByAttributeCache *cache in [self.attributeCaches copy]) {
-        if ([cache.entity isEqual:entity]) {
-            [set addObject:cache];
+    @synchronized(self.attributeCachesByEntityName) {
+        for (RKEntityByAttributeCache *cache in [self.attributeCachesByEntityName[entity.name] objectEnumerator]) {
+            if ([cache.entity isEqual:entity]) [set addObject:cache];
         }
     }
 
     return [NSSet setWithSet:set];
 }
 
+- (NSArray *)allAttributeCaches
+{
+    NSMutableArray *attributeCaches = [NSMutableArray array];
+    @synchronized(self.attributeCachesByEntityName) {
+        for (NSDictionary *attributeCachesByAttributes in [self.attributeCachesByEntityName objectEnumerator]) {
+            [attributeCaches addObjectsFromArray:[attributeCachesByAttributes allValues]];
+        }
+    }
+    return attributeCaches;
+}
+
 - (void)waitForDispatchGroup:(dispatch_group_t)dispatchGroup withCompletionBlock:(void (^)(void))completion
 {
     if (completion) {
@@ -170,7 +237,7 @@
 - (void)_flushNow:(void (^)(void))completion
 {
     dispatch_group_t dispatchGroup = completion ? dispatch_group_create() : NULL;
-    for (RKEntityByAttributeCache *cache in self.attributeCaches) {
+    for (RKEntityByAttributeCache *cache in [self allAttributeCaches]) {
         if (dispatchGroup) dispatch_group_enter(dispatchGroup);
         [cache flush:^{
             if (dispatchGroup) dispatch_group_leave(dispatchGroup);
@@ -228,6 +295,7 @@
             }
         }
     }
+    [self enforceCountLimit];
     if (dispatchGroup) [self waitForDispatchGroup:dispatchGroup withCompletionBlock:completion];
 }
 
@@ -288,9 +356,207 @@
 
 }
 
+#pragma mark - Snapshots
+
+- (NSPersistentStoreCoordinator *)persistentStoreCoordinator
+{
+    NSManagedObjectContext *context = self.managedObjectContext;
+    while (context && ! [context persistentStoreCoordinator]) context = [context parentContext];
+    return [context persistentStoreCoordinator];
+}
+
+- (void)setSnapshotDirectoryURL:(NSURL *)snapshotDirectoryURL
+{
+    NSNotificationCenter *notificationCenter = [NSNotificationCenter defaultCenter];
+    if (_snapshotDirectoryURL) {
+        [notificationCenter removeObserver:self name:NSManagedObjectContextWillSaveNotification object:nil];
+        [notificationCenter removeObserver:self name:NSManagedObjectContextDidSaveNotification object:nil];
+    }
+    _snapshotDirectoryURL = [snapshotDirectoryURL copy];
+    for (RKEntityByAttributeCache *attributeCache in [self allAttributeCaches]) {
+        attributeCache.snapshotURL = _snapshotDirectoryURL ? RKEntityCacheSnapshotURLForEntity(_snapshotDirectoryURL, attributeCache.entity, attributeCache.attributes) : nil;
+    }
+    if (_snapshotDirectoryURL) {
+        // Saves are observed from every context, as any context saving to the store invalidates the snapshots
+        [notificationCenter addObserver:self selector:@selector(handleManagedObjectContextWillSaveNotification:) name:NSManagedObjectContextWillSaveNotification object:nil];
+        [notificationCenter addObserver:self selector:@selector(handleManagedObjectContextDidSaveNotification:) name:NSManagedObjectContextDidSaveNotification object:nil];
+    }
+}
+
+- (BOOL)isManagedObjectContextSavingToPersistentStore:(NSManagedObjectContext *)context
+{
+    NSPersistentStoreCoordinator *persistentStoreCoordinator = [self persistentStoreCoordinator];
+    return persistentStoreCoordinator && [context parentContext] == nil && [context persistentStoreCoordinator] == persistentStoreCoordinator;
+}
+
+// Invoked on the queue of the saving context
+- (void)handleManagedObjectContextWillSaveNotification:(NSNotification *)notification
+{
+    NSManagedObjectContext *context = notification.object;
+    if (! [self isManagedObjectContextSavingToPersistentStore:context]) return;
+
+    /**
+     The associations of objects whose cache key attributes are changed or that are deleted are keyed by their committed values, which are no longer available once the save completes.
+     They are removed after the save along with the addition of the saved objects, so that lookups are never missing objects in the meantime.
+     */
+    NSMutableArray *removals = [NSMutableArray array];
+    NSMutableSet *objects = [NSMutableSet setWithSet:[context updatedObjects]];
+    [objects unionSet:[context deletedObjects]];
+    for (NSManagedObject *object in objects) {
+        if ([object.objectID isTemporaryID]) continue;
+        for (RKEntityByAttributeCache *attributeCache in [self attributeCachesForEntity:object.entity]) {
+            if (! [object isDeleted] && ! [[[object changedValues] allKeys] firstObjectCommonWithArray:attributeCache.attributes]) continue;
+            NSMutableDictionary *attributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeCache.attributes count]];
+            NSDictionary *committedValues = [object committedValuesForKeys:attributeCache.attributes];
+            for (NSString *attributeName in attributeCache.attributes) attributeValues[attributeName] = committedValues[attributeName] ?: [NSNull null];
+            NSManagedObjectID *objectID = object.objectID;
+            [removals addObject:^{
+                [attributeCache removeObjectID:objectID forAttributeValues:attributeValues];
+            }];
+        }
+    }
+
+    // The advanced generations are saved along with the changes, invalidating any snapshot taken before the save
+    @synchronized(self.pendingRemovalsBySavingContext) {
+        RKEntityCacheAdvanceGenerationsOfPersistentStoreCoordinator([self persistentStoreCoordinator]);
+        [self.pendingRemovalsBySavingContext setObject:removals forKey:context];
+    }
+}
+
+// Invoked on the queue of the saving context
+- (void)handleManagedObjectContextDidSaveNotification:(NSNotification *)notification
+{
+    NSManagedObjectContext *context = notification.object;
+    if (! [self isManagedObjectContextSavingToPersistentStore:context]) return;
+
+    NSDictionary *userInfo = notification.userInfo;
+    NSMutableSet *objectsToAdd = [NSMutableSet setWithSet:userInfo[NSInsertedObjectsKey]];
+    [objectsToAdd unionSet:userInfo[NSUpdatedObjectsKey]];
+    @synchronized(self.pendingRemovalsBySavingContext) {
+        for (dispatch_block_t removal in [self.pendingRemovalsBySavingContext objectForKey:context]) removal();
+        [self.pendingRemovalsBySavingContext removeObjectForKey:context];
+        [self addObjects:objectsToAdd completion:nil];
+
+        if (! self.snapshotWriteScheduled) {
+            self.snapshotWriteScheduled = YES;
+            dispatch_async(RKEntityCacheSnapshotQueue(), ^{
+                [self writeSnapshots];
+            });
+        }
+    }
+}
+
+- (void)writeSnapshots
+{
+    NSMutableArray *snapshots = [NSMutableArray array];
+    NSMutableArray *snapshotURLs = [NSMutableArray array];
+    @synchronized(self.pendingRemovalsBySavingContext) {
+        self.snapshotWriteScheduled = NO;
+
+        // A snapshot taken while another save is in flight would be tagged with generations whose changes it does not reflect yet. The last save to complete schedules the write.
+        if ([[[self.pendingRemovalsBySavingContext keyEnumerator] allObjects] count] > 0) return;
+        for (RKEntityByAttributeCache *attributeCache in [self allAttributeCaches]) {
+            RKEntityCacheSnapshot *snapshot = attributeCache.snapshotURL ? [attributeCache snapshot] : nil;
+            if (! snapshot) continue;
+            [snapshots addObject:snapshot];
+            [snapshotURLs addObject:attributeCache.snapshotURL];
+        }
+    }
+
+    [snapshots enumerateObjectsUsingBlock:^(RKEntityCacheSnapshot *snapshot, NSUInteger index, BOOL *stop) {
+        NSError *error = nil;
+        if ([snapshot writeToURL:snapshotURLs[index] error:&error]) {
+            RKLogDebug(@"Wrote entity cache snapshot %@ to '%@'", snapshot, snapshotURLs[index]);
+        } else {
+            RKLogWarning(@"Failed to write entity cache snapshot to '%@': %@", snapshotURLs[index], error);
+        }
+    }];
+}
+
+#pragma mark - Eviction
+
+- (void)setCountLimit:(NSUInteger)countLimit forEntity:(NSEntityDescription *)entity
+{
+    NSParameterAssert(entity);
+    @synchronized(self.countLimitsByEntityName) {
+        self.countLimitsByEntityName[entity.name] = @(countLimit);
+    }
+    for (RKEntityByAttributeCache *attributeCache in [self attributeCachesForEntity:entity]) {
+        attributeCache.countLimit = countLimit;
+        if (countLimit && [attributeCache count] > countLimit) [attributeCache evictObjectsToCount:countLimit];
+    }
+}
+
+- (NSUInteger)countLimitForEntity:(NSEntityDescription *)entity
+{
+    @synchronized(self.countLimitsByEntityName) {
+        return [self.countLimitsByEntityName[entity.name] unsignedIntegerValue];
+    }
+}
+
+- (BOOL)hasCountLimits
+{
+    @synchronized(self.countLimitsByEntityName) {
+        return self.countLimit > 0 || [[self.countLimitsByEntityName allValues] indexOfObjectPassingTest:^BOOL(NSNumber *countLimit, NSUInteger index, BOOL *stop) {
+            return [countLimit unsignedIntegerValue] > 0;
+        }] != NSNotFound;
+    }
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit
+{
+    _countLimit = countLimit;
+    [self enforceCountLimit];
+}
+
+- (void)enforceCountLimit
+{
+    NSUInteger countLimit = self.countLimit;
+    if (countLimit == 0) return;
+    NSUInteger count = 0;
+    NSArray *attributeCaches = [self allAttributeCaches];
+    for (RKEntityByAttributeCache *attributeCache in attributeCaches) count += [attributeCache count];
+    if (count <= countLimit) return;
+
+    // Evict to below the limit, so that the cost of sweeping is amortized over several additions
+    [self evictObjectsFromAttributeCaches:attributeCaches ofCount:count toCount:countLimit - countLimit / 10];
+}
+
+// Trims each attribute cache in proportion to its size, evicting its least recently used keys
+- (void)evictObjectsFromAttributeCaches:(NSArray *)attributeCaches ofCount:(NSUInteger)count toCount:(NSUInteger)targetCount
+{
+    if (count == 0) return;
+    for (RKEntityByAttributeCache *attributeCache in attributeCaches) {
+        [attributeCache evictObjectsToCount:(NSUInteger)((unsigned long long)[attributeCache count] * targetCount / count)];
+    }
+}
+
+- (NSUInteger)hitCount
+{
+    return [[[self allAttributeCaches] valueForKeyPath:@"@sum.hitCount"] unsignedIntegerValue];
+}
+
+- (NSUInteger)missCount
+{
+    return [[[self allAttributeCaches] valueForKeyPath:@"@sum.missCount"] unsignedIntegerValue];
+}
+
+- (NSUInteger)evictionCount
+{
+    return [[[self allAttributeCaches] valueForKeyPath:@"@sum.evictionCount"] unsignedIntegerValue];
+}
+
 - (void)didReceiveMemoryWarning:(NSNotification *)notification
 {
-    [self flush:nil];
+    if ([self hasCountLimits]) {
+        // Evicting the coldest half of the caches keeps the keys being mapped cached, rather than leaving the next mapping to reload every cache
+        NSArray *attributeCaches = [self allAttributeCaches];
+        NSUInteger count = 0;
+        for (RKEntityByAttributeCache *attributeCache in attributeCaches) count += [attributeCache count];
+        [self evictObjectsFromAttributeCaches:attributeCaches ofCount:count toCount:count / 2];
+    } else {
+        [self flush:nil];
+    }
 }
 
 @end
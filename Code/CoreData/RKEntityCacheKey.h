@@ -0,0 +1,70 @@
+//
+//  RKEntityCacheKey.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <CoreData/CoreData.h>
+
+/**
+ The `RKEntityCacheKey` class is an immutable composite key identifying managed objects by the values of several attributes. It is used by `RKEntityByAttributeCache` to key objects identified by more than one attribute.
+
+ A key retains the attribute values it was created with, in the order of the attributes of the cache, and compares them with `isEqual:`. Its hash is computed once from the hashes of the values, so the key can be stored in and probed against hash tables without formatting the values into strings. Caches keyed by a single attribute use the attribute value itself as the key. Keys are archived along with the snapshots of their cache (see `RKEntityCacheSnapshot`).
+ */
+@interface RKEntityCacheKey : NSObject <NSCopying, NSSecureCoding>
+
+/**
+ Initializes the receiver with the given attribute values.
+
+ @param values A C array of attribute values. `nil` values must be represented by `[NSNull null]`.
+ @param count The number of values in the array.
+ @return The receiver, initialized with the given values.
+ */
+- (instancetype)initWithValues:(const __unsafe_unretained id *)values count:(NSUInteger)count;
+
+/**
+ The number of attribute values of the receiver.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ Returns the attribute value at the given index.
+
+ @param index The index of the attribute value to return.
+ @return The attribute value at the given index.
+ */
+- (id)valueAtIndex:(NSUInteger)index;
+
+@end
+
+/**
+ Returns the representation of a value within an entity cache key for an attribute of the given type.
+
+ Core Data fetches the values of numeric attributes as `NSNumber` objects and the values of string attributes as `NSString` objects, while values read from an object representation may be of either class. String values of numeric attributes are converted into numbers and numeric values of string attributes are converted into strings, so that they match the values fetched from the store. Values that cannot be converted, along with values of any other attribute type, are returned as is. `nil` is represented by `[NSNull null]`.
+
+ @param value The value of the attribute.
+ @param attributeType The type of the attribute.
+ @return The value with which to build a cache key.
+ */
+id RKEntityCacheKeyComponentForAttributeValue(id value, NSAttributeType attributeType);
+
+/**
+ Returns the classes of the attribute values that entity cache keys are built from, which may be decoded from an archived key with secure coding.
+
+ @return A set of the classes of attribute values.
+ */
+NSSet *RKEntityCacheKeyValueClasses(void);
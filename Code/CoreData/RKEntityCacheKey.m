@@ -0,0 +1,214 @@
+//
+//  RKEntityCacheKey.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <stdlib.h>
+#include <math.h>
+#include <errno.h>
+#include <ctype.h>
+#import "RKEntityCacheKey.h"
+
+@implementation RKEntityCacheKey {
+    __strong id *_values;
+    NSUInteger _count;
+    NSUInteger _hash;
+}
+
+- (instancetype)initWithValues:(const __unsafe_unretained id *)values count:(NSUInteger)count
+{
+    self = [super init];
+    if (self) {
+        _count = count;
+        _values = (__strong id *)calloc(count, sizeof(id));
+        NSUInteger hash = count;
+        for (NSUInteger index = 0; index < count; index++) {
+            _values[index] = values[index];
+            hash = hash * 31 + [values[index] hash];
+        }
+        _hash = hash;
+    }
+
+    return self;
+}
+
+- (instancetype)init
+{
+    return [self initWithValues:NULL count:0];
+}
+
+- (void)dealloc
+{
+    for (NSUInteger index = 0; index < _count; index++) _values[index] = nil;
+    free(_values);
+}
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (instancetype)initWithCoder:(NSCoder *)decoder
+{
+    NSArray *values = [decoder decodeObjectOfClasses:[RKEntityCacheKeyValueClasses() setByAddingObject:[NSArray class]] forKey:@"values"];
+    if (! [values isKindOfClass:[NSArray class]]) return nil;
+    NSUInteger count = [values count];
+    __unsafe_unretained id *buffer = (__unsafe_unretained id *)calloc(count, sizeof(id));
+    [values getObjects:buffer range:NSMakeRange(0, count)];
+    self = [self initWithValues:buffer count:count];
+    free(buffer);
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder
+{
+    [coder encodeObject:[NSArray arrayWithObjects:(const __unsafe_unretained id *)_values count:_count] forKey:@"values"];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    // Keys are immutable
+    return self;
+}
+
+- (NSUInteger)count
+{
+    return _count;
+}
+
+- (id)valueAtIndex:(NSUInteger)index
+{
+    if (index >= _count) [NSException raise:NSRangeException format:@"*** -[%@ %@]: index %lu beyond bounds [0 .. %lu]", NSStringFromClass([self class]), NSStringFromSelector(_cmd), (unsigned long)index, (unsigned long)_count];
+    return _values[index];
+}
+
+- (NSUInteger)hash
+{
+    return _hash;
+}
+
+- (BOOL)isEqual:(id)object
+{
+    if (object == self) return YES;
+    if (! [object isKindOfClass:[RKEntityCacheKey class]]) return NO;
+    RKEntityCacheKey *otherKey = object;
+    if (otherKey->_count != _count || otherKey->_hash != _hash) return NO;
+    for (NSUInteger index = 0; index < _count; index++) {
+        if (! [_values[index] isEqual:otherKey->_values[index]]) return NO;
+    }
+    return YES;
+}
+
+- (NSString *)description
+{
+    NSMutableString *description = [NSMutableString string];
+    for (NSUInteger index = 0; index < _count; index++) {
+        if (index > 0) [description appendString:@":"];
+        [description appendString:[_values[index] description]];
+    }
+    return description;
+}
+
+@end
+
+#pragma mark - Functions
+
+/*
+ Returns the C string of a string to be parsed as a number, or `NULL` if it is empty or starts with whitespace. `strtoll` and `strtod` skip leading whitespace, which would map distinct strings such as " 1" and "1" to the same key.
+ */
+static const char *RKNumericCStringFromString(NSString *string)
+{
+    const char *characters = [string UTF8String];
+    if (! characters || *characters == '\0' || isspace((unsigned char)*characters)) return NULL;
+    return characters;
+}
+
+// Parses a string containing nothing but an integer, such as an identifier read from a JSON string. Out of range integers are not parsed, as they would all saturate to the same value.
+static NSNumber *RKIntegerNumberFromString(NSString *string)
+{
+    const char *characters = RKNumericCStringFromString(string);
+    if (! characters) return nil;
+    char *end = NULL;
+    errno = 0;
+    long long integer = strtoll(characters, &end, 10);
+    if (*end != '\0' || errno == ERANGE) return nil;
+    return @(integer);
+}
+
+static NSNumber *RKFloatingPointNumberFromString(NSString *string, NSAttributeType attributeType)
+{
+    const char *characters = RKNumericCStringFromString(string);
+    if (! characters) return nil;
+    char *end = NULL;
+    errno = 0;
+    double number = strtod(characters, &end);
+    if (*end != '\0' || errno == ERANGE || ! isfinite(number)) return nil;
+    if (attributeType == NSFloatAttributeType) {
+        float floatNumber = (float)number;
+        return isfinite(floatNumber) ? @(floatNumber) : nil;
+    }
+    return @(number);
+}
+
+id RKEntityCacheKeyComponentForAttributeValue(id value, NSAttributeType attributeType)
+{
+    if (! value) return [NSNull null];
+
+    switch (attributeType) {
+        case NSInteger16AttributeType:
+        case NSInteger32AttributeType:
+        case NSInteger64AttributeType:
+        case NSBooleanAttributeType:
+            if ([value isKindOfClass:[NSString class]]) return RKIntegerNumberFromString(value) ?: value;
+            break;
+
+        case NSDoubleAttributeType:
+        case NSFloatAttributeType:
+            if ([value isKindOfClass:[NSString class]]) return RKFloatingPointNumberFromString(value, attributeType) ?: value;
+            break;
+
+        case NSDecimalAttributeType:
+            if ([value isKindOfClass:[NSString class]]) {
+                NSDecimalNumber *decimalNumber = [NSDecimalNumber decimalNumberWithString:value locale:@{ NSLocaleDecimalSeparator: @"." }];
+                NSDecimal decimal = [decimalNumber decimalValue];
+                return NSDecimalIsNotANumber(&decimal) ? value : decimalNumber;
+            } else if ([value isKindOfClass:[NSNumber class]] && ! [value isKindOfClass:[NSDecimalNumber class]]) {
+                return [NSDecimalNumber decimalNumberWithDecimal:[value decimalValue]];
+            }
+            break;
+
+        case NSStringAttributeType:
+            if ([value isKindOfClass:[NSNumber class]]) return [value stringValue];
+            break;
+
+        default:
+            break;
+    }
+
+    return value;
+}
+
+NSSet *RKEntityCacheKeyValueClasses(void)
+{
+    static NSSet *valueClasses;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        valueClasses = [NSSet setWithObjects:[NSString class], [NSNumber class], [NSDecimalNumber class], [NSDate class], [NSData class], [NSUUID class], [NSURL class], [NSNull class], nil];
+    });
+    return valueClasses;
+}
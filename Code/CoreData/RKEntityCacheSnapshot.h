@@ -0,0 +1,167 @@
+//
+//  RKEntityCacheSnapshot.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <CoreData/CoreData.h>
+
+/**
+ The key within the metadata of a persistent store at which the generation of the store is recorded. The generation is advanced by `RKEntityCache` each time a managed object context saves to the store while the cache is persisting snapshots.
+ */
+extern NSString * const RKEntityCacheGenerationMetadataKey;
+
+/**
+ The `RKEntityCacheSnapshot` class is an immutable record of the associations between cache keys and managed object IDs held by an `RKEntityByAttributeCache`, which can be written to disk and read back on a subsequent launch instead of fetching every instance of the cached entity from the persistent store.
+
+ A snapshot records the generations of the persistent stores it was taken from (see `RKEntityCacheGenerationsOfPersistentStoreCoordinator`). It is only valid while the generations of the stores are unchanged: any save to a store advances its generation and invalidates the snapshots taken before it, including those of a process that terminated before it could write a new snapshot. The contents of the stores can also change without advancing their generations, for example when they are written by a process not observing saves, so `RKEntityByAttributeCache` additionally discards a snapshot whose count differs from the number of instances of the entity in the stores.
+
+ Snapshots are archived with `NSKeyedArchiver` using secure coding, and read through memory mapped data. Rather than the URI representation of every managed object ID, a snapshot groups the rows whose URIs differ only by the integer primary key they end with, which are those of the same store and entity. The URI prefix of each group is recorded once, taken from a URI produced by Core Data, along with the packed primary keys of its rows. The object IDs are only built when the snapshot is enumerated with `enumerateObjectIDsWithPersistentStoreCoordinator:usingBlock:`, and a snapshot is only valid if the object ID rebuilt for the first row of each group round trips to the same URI.
+ */
+@interface RKEntityCacheSnapshot : NSObject <NSSecureCoding>
+
+///----------------------------
+/// @name Creating a Snapshot
+///----------------------------
+
+/**
+ Initializes the receiver with the contents of an entity attribute cache.
+
+ @param entity The entity of the cached objects.
+ @param attributeNames The names of the attributes of the cache, in the order in which their values appear in composite cache keys.
+ @param generations A dictionary of the generations of the persistent stores the contents were taken from, keyed by store identifier.
+ @param cacheKeys An array of cache keys.
+ @param objectIDs An array of the permanent managed object IDs cached under the key at the same index of `cacheKeys`.
+ @return The receiver, initialized with the given contents, or `nil` if any of the object IDs is temporary or its URI representation does not end with an integer primary key.
+ */
+- (instancetype)initWithEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames generations:(NSDictionary *)generations cacheKeys:(NSArray *)cacheKeys objectIDs:(NSArray *)objectIDs;
+
+/**
+ Reads a snapshot previously written with `writeToURL:error:`.
+
+ @param URL The file URL to read the snapshot from.
+ @param error A pointer to an error object set if the file could not be read.
+ @return The snapshot read from the file, or `nil` if the file could not be read or does not contain a snapshot.
+ */
++ (instancetype)snapshotWithContentsOfURL:(NSURL *)URL error:(NSError **)error;
+
+///----------------------------------
+/// @name Accessing Snapshot Contents
+///----------------------------------
+
+/**
+ The name of the entity of the cached objects.
+ */
+@property (nonatomic, copy, readonly) NSString *entityName;
+
+/**
+ The version hash of the entity at the time the snapshot was taken.
+ */
+@property (nonatomic, copy, readonly) NSData *entityVersionHash;
+
+/**
+ The names of the attributes of the cache, in the order in which their values appear in composite cache keys.
+ */
+@property (nonatomic, copy, readonly) NSArray *attributes;
+
+/**
+ The generations of the persistent stores at the time the snapshot was taken, keyed by store identifier.
+ */
+@property (nonatomic, copy, readonly) NSDictionary *generations;
+
+/**
+ The number of associations between cache keys and managed object IDs recorded by the snapshot.
+ */
+@property (nonatomic, readonly) NSUInteger count;
+
+/**
+ Enumerates the associations recorded by the snapshot, building the managed object IDs from the recorded store identifiers, entity names and primary keys.
+
+ @param persistentStoreCoordinator The persistent store coordinator to build the managed object IDs with.
+ @param block A block invoked with each cache key and a managed object ID cached under it.
+ */
+- (void)enumerateObjectIDsWithPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator usingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID))block;
+
+/**
+ Enumerates the first association recorded for each store and entity, so that the rows of the snapshot can be checked against the store before it is decoded.
+
+ @param persistentStoreCoordinator The persistent store coordinator to build the managed object IDs with.
+ @param block A block invoked with a cache key and the managed object ID cached under it, which is `nil` if it could not be built. Setting `stop` to `YES` ends the enumeration.
+ */
+- (void)enumerateSampleObjectIDsWithPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator usingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID, BOOL *stop))block;
+
+///----------------------------------
+/// @name Validating and Persisting
+///----------------------------------
+
+/**
+ Returns a Boolean value that indicates whether the receiver still reflects the contents of the persistent stores of the given coordinator for a cache of the given entity and attributes.
+
+ @param entity The entity of the cache.
+ @param attributeNames The names of the attributes of the cache, in the order in which their values appear in composite cache keys.
+ @param persistentStoreCoordinator The persistent store coordinator of the cache.
+ @return `YES` if the entity, attributes and store generations of the receiver match and its rows resolve to object IDs of the stores and entity, else `NO`.
+ */
+- (BOOL)isValidForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames persistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator;
+
+/**
+ Atomically writes the receiver to the given file URL, creating its directory if needed.
+
+ @param URL The file URL to write the snapshot to.
+ @param error A pointer to an error object set if the snapshot could not be written.
+ @return `YES` if the snapshot was written, else `NO`.
+ */
+- (BOOL)writeToURL:(NSURL *)URL error:(NSError **)error;
+
+@end
+
+///----------------------------------
+/// @name Tracking Store Generations
+///----------------------------------
+
+/**
+ Returns the generations of the persistent stores of a coordinator, keyed by store identifier. Stores whose metadata has no generation are of generation `0`.
+
+ @param persistentStoreCoordinator The persistent store coordinator to return the generations of the stores of.
+ @return A dictionary of the generations of the stores.
+ */
+NSDictionary *RKEntityCacheGenerationsOfPersistentStoreCoordinator(NSPersistentStoreCoordinator *persistentStoreCoordinator);
+
+/**
+ Advances the generation recorded in the metadata of each persistent store of a coordinator. Invoked before a managed object context saves, so that the new generations are saved along with the changes.
+
+ @param persistentStoreCoordinator The persistent store coordinator to advance the generations of the stores of.
+ */
+void RKEntityCacheAdvanceGenerationsOfPersistentStoreCoordinator(NSPersistentStoreCoordinator *persistentStoreCoordinator);
+
+/**
+ Returns the URL of the directory next to a persistent store in which to persist entity cache snapshots, or `nil` if the store is not backed by a file.
+
+ @param persistentStore The persistent store to return the snapshot directory URL for.
+ @return The URL of the snapshot directory for the store.
+ */
+NSURL *RKEntityCacheSnapshotDirectoryURLForPersistentStore(NSPersistentStore *persistentStore);
+
+/**
+ Returns the URL of the snapshot of a cache of an entity by the given attributes within a snapshot directory.
+
+ @param directoryURL The URL of the snapshot directory.
+ @param entity The entity of the cache.
+ @param attributeNames The names of the attributes of the cache. Their order is irrelevant.
+ @return The URL of the snapshot file.
+ */
+NSURL *RKEntityCacheSnapshotURLForEntity(NSURL *directoryURL, NSEntityDescription *entity, NSArray *attributeNames);
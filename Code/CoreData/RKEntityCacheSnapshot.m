@@ -0,0 +1,322 @@
+//
+//  RKEntityCacheSnapshot.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#include <errno.h>
+#import "RKEntityCacheSnapshot.h"
+#import "RKEntityCacheKey.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitCoreDataCache
+
+NSString * const RKEntityCacheGenerationMetadataKey = @"RKEntityCacheGeneration";
+
+// Incremented whenever the archived representation of snapshots changes
+static const NSInteger RKEntityCacheSnapshotFormatVersion = 3;
+
+/*
+ Splits the URI representation of a permanent object ID into the prefix it shares with the other objects of its store and entity, and the integer primary key it ends with. Core Data's URI layout is not relied upon: the prefix is taken from the URI itself, and object IDs whose URI is not exactly the prefix followed by the decimal primary key are rejected.
+ */
+static BOOL RKSplitURIRepresentationOfObjectID(NSManagedObjectID *objectID, NSString **URIPrefix, int64_t *primaryKey)
+{
+    if ([objectID isTemporaryID]) return NO;
+    NSString *URIString = [[objectID URIRepresentation] absoluteString];
+    NSUInteger length = [URIString length];
+    NSUInteger index = length;
+    while (index > 0 && [URIString characterAtIndex:index - 1] >= '0' && [URIString characterAtIndex:index - 1] <= '9') index--;
+    if (index == length || index == 0) return NO;
+
+    NSString *digits = [URIString substringFromIndex:index];
+    errno = 0;
+    long long value = strtoll([digits UTF8String], NULL, 10);
+    if (errno == ERANGE || ! [[NSString stringWithFormat:@"%lld", value] isEqualToString:digits]) return NO;
+    *URIPrefix = [URIString substringToIndex:index];
+    *primaryKey = value;
+    return YES;
+}
+
+static NSSet *RKEntityCacheSnapshotCacheKeyClasses(void)
+{
+    return [RKEntityCacheKeyValueClasses() setByAddingObjectsFromArray:@[ [NSArray class], [RKEntityCacheKey class] ]];
+}
+
+/*
+ The rows of a snapshot sharing the URI prefix of their object IDs, which identifies their store and entity. The prefix is recorded once, along with the cache keys and the packed primary keys of the rows.
+ */
+@interface RKEntityCacheSnapshotSegment : NSObject <NSSecureCoding>
+@property (nonatomic, copy, readonly) NSString *URIPrefix;
+@property (nonatomic, strong, readonly) NSMutableArray *cacheKeys;
+@property (nonatomic, strong, readonly) NSMutableData *primaryKeys;
+- (instancetype)initWithURIPrefix:(NSString *)URIPrefix;
+- (void)addCacheKey:(id)cacheKey primaryKey:(int64_t)primaryKey;
+- (NSURL *)URIRepresentationAtIndex:(NSUInteger)index;
+@end
+
+@implementation RKEntityCacheSnapshotSegment
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (instancetype)initWithURIPrefix:(NSString *)URIPrefix
+{
+    self = [super init];
+    if (self) {
+        _URIPrefix = [URIPrefix copy];
+        _cacheKeys = [NSMutableArray array];
+        _primaryKeys = [NSMutableData data];
+    }
+    return self;
+}
+
+- (instancetype)initWithCoder:(NSCoder *)decoder
+{
+    self = [super init];
+    if (self) {
+        _URIPrefix = [decoder decodeObjectOfClass:[NSString class] forKey:@"URIPrefix"];
+        _cacheKeys = [[decoder decodeObjectOfClasses:RKEntityCacheSnapshotCacheKeyClasses() forKey:@"cacheKeys"] mutableCopy];
+        _primaryKeys = [[decoder decodeObjectOfClass:[NSData class] forKey:@"primaryKeys"] mutableCopy];
+        if (! _URIPrefix || ! [_cacheKeys isKindOfClass:[NSArray class]] || [_primaryKeys length] != [_cacheKeys count] * sizeof(uint64_t)) return nil;
+    }
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder
+{
+    [coder encodeObject:self.URIPrefix forKey:@"URIPrefix"];
+    [coder encodeObject:self.cacheKeys forKey:@"cacheKeys"];
+    [coder encodeObject:self.primaryKeys forKey:@"primaryKeys"];
+}
+
+- (void)addCacheKey:(id)cacheKey primaryKey:(int64_t)primaryKey
+{
+    [self.cacheKeys addObject:cacheKey];
+    uint64_t littleEndianPrimaryKey = CFSwapInt64HostToLittle((uint64_t)primaryKey);
+    [self.primaryKeys appendBytes:&littleEndianPrimaryKey length:sizeof(littleEndianPrimaryKey)];
+}
+
+- (NSURL *)URIRepresentationAtIndex:(NSUInteger)index
+{
+    const uint64_t *primaryKeys = [self.primaryKeys bytes];
+    int64_t primaryKey = (int64_t)CFSwapInt64LittleToHost(primaryKeys[index]);
+    return [NSURL URLWithString:[NSString stringWithFormat:@"%@%lld", self.URIPrefix, (long long)primaryKey]];
+}
+
+@end
+
+@interface RKEntityCacheSnapshot ()
+@property (nonatomic, copy) NSArray *segments;
+@property (nonatomic, readwrite) NSUInteger count;
+@end
+
+@implementation RKEntityCacheSnapshot
+
++ (BOOL)supportsSecureCoding
+{
+    return YES;
+}
+
+- (instancetype)initWithEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames generations:(NSDictionary *)generations cacheKeys:(NSArray *)cacheKeys objectIDs:(NSArray *)objectIDs
+{
+    NSParameterAssert(entity);
+    NSParameterAssert(attributeNames);
+    NSParameterAssert(generations);
+    NSAssert([cacheKeys count] == [objectIDs count], @"Cannot create a snapshot with %ld cache keys for %ld object IDs", (long)[cacheKeys count], (long)[objectIDs count]);
+
+    self = [super init];
+    if (self) {
+        _entityName = [entity.name copy];
+        _entityVersionHash = [entity.versionHash copy];
+        _attributes = [attributeNames copy];
+        _generations = [generations copy];
+        _count = [objectIDs count];
+
+        NSMutableDictionary *segmentsByURIPrefix = [NSMutableDictionary dictionary];
+        NSUInteger index = 0;
+        for (NSManagedObjectID *objectID in objectIDs) {
+            NSString *URIPrefix = nil;
+            int64_t primaryKey = 0;
+            if (! RKSplitURIRepresentationOfObjectID(objectID, &URIPrefix, &primaryKey)) {
+                RKLogDebug(@"Cannot snapshot entity cache for Entity '%@': the URI of object ID %@ does not end with an integer primary key", entity.name, objectID);
+                return nil;
+            }
+            RKEntityCacheSnapshotSegment *segment = segmentsByURIPrefix[URIPrefix];
+            if (! segment) {
+                segment = [[RKEntityCacheSnapshotSegment alloc] initWithURIPrefix:URIPrefix];
+                segmentsByURIPrefix[URIPrefix] = segment;
+            }
+            [segment addCacheKey:cacheKeys[index++] primaryKey:primaryKey];
+        }
+        _segments = [segmentsByURIPrefix allValues];
+    }
+
+    return self;
+}
+
+- (instancetype)initWithCoder:(NSCoder *)decoder
+{
+    if ([decoder decodeIntegerForKey:@"formatVersion"] != RKEntityCacheSnapshotFormatVersion) return nil;
+
+    self = [super init];
+    if (self) {
+        NSSet *propertyListClasses = [NSSet setWithObjects:[NSArray class], [NSDictionary class], [NSString class], [NSNumber class], nil];
+        _entityName = [decoder decodeObjectOfClass:[NSString class] forKey:@"entityName"];
+        _entityVersionHash = [decoder decodeObjectOfClass:[NSData class] forKey:@"entityVersionHash"];
+        _attributes = [decoder decodeObjectOfClasses:propertyListClasses forKey:@"attributes"];
+        _generations = [decoder decodeObjectOfClasses:propertyListClasses forKey:@"generations"];
+        _segments = [decoder decodeObjectOfClasses:[NSSet setWithObjects:[NSArray class], [RKEntityCacheSnapshotSegment class], nil] forKey:@"segments"];
+        if (! _entityName || ! [_attributes isKindOfClass:[NSArray class]] || ! [_generations isKindOfClass:[NSDictionary class]] || ! [_segments isKindOfClass:[NSArray class]]) return nil;
+
+        for (RKEntityCacheSnapshotSegment *segment in _segments) _count += [segment.cacheKeys count];
+    }
+
+    return self;
+}
+
+- (void)encodeWithCoder:(NSCoder *)coder
+{
+    [coder encodeInteger:RKEntityCacheSnapshotFormatVersion forKey:@"formatVersion"];
+    [coder encodeObject:self.entityName forKey:@"entityName"];
+    [coder encodeObject:self.entityVersionHash forKey:@"entityVersionHash"];
+    [coder encodeObject:self.attributes forKey:@"attributes"];
+    [coder encodeObject:self.generations forKey:@"generations"];
+    [coder encodeObject:self.segments forKey:@"segments"];
+}
+
++ (instancetype)snapshotWithContentsOfURL:(NSURL *)URL error:(NSError **)error
+{
+    NSData *data = [NSData dataWithContentsOfURL:URL options:NSDataReadingMappedIfSafe error:error];
+    if (! data) return nil;
+
+    RKEntityCacheSnapshot *snapshot = nil;
+    @try {
+        NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:data];
+        unarchiver.requiresSecureCoding = YES;
+        snapshot = [unarchiver decodeObjectOfClass:[RKEntityCacheSnapshot class] forKey:NSKeyedArchiveRootObjectKey];
+        [unarchiver finishDecoding];
+    } @catch (NSException *exception) {
+        RKLogWarning(@"Failed to unarchive entity cache snapshot at '%@': %@", URL, exception.reason);
+        snapshot = nil;
+    }
+    return snapshot;
+}
+
+- (void)enumerateObjectIDsWithPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator usingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID))block
+{
+    for (RKEntityCacheSnapshotSegment *segment in self.segments) {
+        NSUInteger index = 0;
+        for (id cacheKey in segment.cacheKeys) {
+            NSURL *URL = [segment URIRepresentationAtIndex:index++];
+            NSManagedObjectID *objectID = [persistentStoreCoordinator managedObjectIDForURIRepresentation:URL];
+            if (objectID) {
+                block(cacheKey, objectID);
+            } else {
+                RKLogWarning(@"Skipping entity cache snapshot row: failed to resolve object ID '%@'", URL);
+            }
+        }
+    }
+}
+
+- (void)enumerateSampleObjectIDsWithPersistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator usingBlock:(void (^)(id cacheKey, NSManagedObjectID *objectID, BOOL *stop))block
+{
+    BOOL stop = NO;
+    for (RKEntityCacheSnapshotSegment *segment in self.segments) {
+        if ([segment.cacheKeys count] == 0) continue;
+        NSManagedObjectID *objectID = [persistentStoreCoordinator managedObjectIDForURIRepresentation:[segment URIRepresentationAtIndex:0]];
+        block(segment.cacheKeys[0], objectID, &stop);
+        if (stop) break;
+    }
+}
+
+- (BOOL)isValidForEntity:(NSEntityDescription *)entity attributes:(NSArray *)attributeNames persistentStoreCoordinator:(NSPersistentStoreCoordinator *)persistentStoreCoordinator
+{
+    if (! [self.entityName isEqualToString:entity.name]) return NO;
+    if (! [self.entityVersionHash isEqualToData:entity.versionHash]) return NO;
+    if (! [self.attributes isEqualToArray:attributeNames]) return NO;
+    if (! [self.generations isEqualToDictionary:RKEntityCacheGenerationsOfPersistentStoreCoordinator(persistentStoreCoordinator)]) return NO;
+
+    // The object IDs rebuilt from each segment must round trip to the same URI, and belong to the stores and entity of the snapshot
+    for (RKEntityCacheSnapshotSegment *segment in self.segments) {
+        if ([segment.cacheKeys count] == 0) continue;
+        NSURL *URL = [segment URIRepresentationAtIndex:0];
+        NSManagedObjectID *objectID = [persistentStoreCoordinator managedObjectIDForURIRepresentation:URL];
+        if (! objectID || ! [[[objectID URIRepresentation] absoluteString] isEqualToString:[URL absoluteString]]) return NO;
+        if (! self.generations[objectID.persistentStore.identifier] || ! [objectID.entity isKindOfEntity:entity]) return NO;
+    }
+    return YES;
+}
+
+- (BOOL)writeToURL:(NSURL *)URL error:(NSError **)error
+{
+    NSURL *directoryURL = [URL URLByDeletingLastPathComponent];
+    if (! [[NSFileManager defaultManager] createDirectoryAtURL:directoryURL withIntermediateDirectories:YES attributes:nil error:error]) return NO;
+    NSMutableData *data = [NSMutableData data];
+    NSKeyedArchiver *archiver = [[NSKeyedArchiver alloc] initForWritingWithMutableData:data];
+    archiver.requiresSecureCoding = YES;
+    [archiver encodeObject:self forKey:NSKeyedArchiveRootObjectKey];
+    [archiver finishEncoding];
+    return [data writeToURL:URL options:NSDataWritingAtomic error:error];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p entity=%@ attributes=%@ generations=%@ count=%ld>",
+            NSStringFromClass([self class]), self, self.entityName, self.attributes, self.generations, (long)self.count];
+}
+
+@end
+
+#pragma mark - Functions
+
+NSDictionary *RKEntityCacheGenerationsOfPersistentStoreCoordinator(NSPersistentStoreCoordinator *persistentStoreCoordinator)
+{
+    NSMutableDictionary *generations = [NSMutableDictionary dictionary];
+    for (NSPersistentStore *persistentStore in [persistentStoreCoordinator persistentStores]) {
+        NSNumber *generation = [persistentStoreCoordinator metadataForPersistentStore:persistentStore][RKEntityCacheGenerationMetadataKey];
+        generations[persistentStore.identifier] = generation ?: @0;
+    }
+    return generations;
+}
+
+void RKEntityCacheAdvanceGenerationsOfPersistentStoreCoordinator(NSPersistentStoreCoordinator *persistentStoreCoordinator)
+{
+    for (NSPersistentStore *persistentStore in [persistentStoreCoordinator persistentStores]) {
+        if ([persistentStore isReadOnly]) continue;
+        NSMutableDictionary *metadata = [[persistentStoreCoordinator metadataForPersistentStore:persistentStore] mutableCopy];
+        metadata[RKEntityCacheGenerationMetadataKey] = @([metadata[RKEntityCacheGenerationMetadataKey] unsignedLongLongValue] + 1);
+        [persistentStoreCoordinator setMetadata:metadata forPersistentStore:persistentStore];
+    }
+}
+
+NSURL *RKEntityCacheSnapshotDirectoryURLForPersistentStore(NSPersistentStore *persistentStore)
+{
+    NSURL *storeURL = persistentStore.URL;
+    if (! [storeURL isFileURL]) return nil;
+    return [storeURL URLByAppendingPathExtension:@"entitycache"];
+}
+
+NSURL *RKEntityCacheSnapshotURLForEntity(NSURL *directoryURL, NSEntityDescription *entity, NSArray *attributeNames)
+{
+    NSArray *sortedAttributeNames = [attributeNames sortedArrayUsingSelector:@selector(compare:)];
+    NSString *fileName = [NSString stringWithFormat:@"%@-%@.snapshot", entity.name, [sortedAttributeNames componentsJoinedByString:@"+"]];
+    return [directoryURL URLByAppendingPathComponent:fileName];
+}
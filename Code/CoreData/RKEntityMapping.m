@@ -18,6 +18,7 @@
 //  limitations under the License.
 //
 
+#import <objc/runtime.h>
 #import "RKEntityMapping.h"
 #import "RKManagedObjectStore.h"
 #import "RKObjectMappingMatcher.h"
@@ -25,6 +26,7 @@
 #import "RKLog.h"
 #import "RKRelationshipMapping.h"
 #import "RKObjectUtilities.h"
+#import "RKMapping_Private.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -34,6 +36,17 @@ NSString * const RKEntityIdentificationAttributesUserInfoKey = @"RKEntityIdentif
 
 #pragma mark - Functions
 
+/**
+ Returns a Boolean value that indicates if the given property is declared `@dynamic`, in which case its accessors are generated by Core Data rather than implemented by the managed object class.
+ */
+static BOOL RKPropertyIsDynamic(objc_property_t property)
+{
+    char *dynamic = property_copyAttributeValue(property, "D");
+    if (! dynamic) return NO;
+    free(dynamic);
+    return YES;
+}
+
 static NSArray *RKEntityIdentificationAttributesFromUserInfoOfEntity(NSEntityDescription *entity)
 {
     do {
@@ -215,8 +228,15 @@ static BOOL entityIdentificationInferenceEnabled = YES;
     return copy;
 }
 
+- (void)setEntity:(NSEntityDescription *)entity
+{
+    RKRaiseIfFrozen();
+    _entity = entity;
+}
+
 - (void)setIdentificationAttributes:(NSArray *)attributesOrNames
 {
+    RKRaiseIfFrozen();
     if (attributesOrNames && [attributesOrNames count] == 0) [NSException raise:NSInvalidArgumentException format:@"At least one attribute must be provided to identify managed objects"];
     _identificationAttributes = attributesOrNames ? RKArrayOfAttributesForEntityFromAttributesOrNames(self.entity, attributesOrNames) : nil;
 }
@@ -226,6 +246,48 @@ static BOOL entityIdentificationInferenceEnabled = YES;
     return _identificationAttributes;
 }
 
+- (void)setIdentificationPredicate:(NSPredicate *)identificationPredicate
+{
+    RKRaiseIfFrozen();
+    _identificationPredicate = [identificationPredicate copy];
+}
+
+- (void)setIdentificationPredicateBlock:(NSPredicate *(^)(NSDictionary *representation, NSManagedObjectContext *managedObjectContext))identificationPredicateBlock
+{
+    RKRaiseIfFrozen();
+    _identificationPredicateBlock = [identificationPredicateBlock copy];
+}
+
+- (void)setShouldMapRelationshipsIfObjectIsUnmodified:(BOOL)shouldMapRelationshipsIfObjectIsUnmodified
+{
+    RKRaiseIfFrozen();
+    _shouldMapRelationshipsIfObjectIsUnmodified = shouldMapRelationshipsIfObjectIsUnmodified;
+}
+
+- (void)setPersistentStore:(NSPersistentStore *)persistentStore
+{
+    RKRaiseIfFrozen();
+    _persistentStore = persistentStore;
+}
+
+- (void)setFingerprintsRepresentations:(BOOL)fingerprintsRepresentations
+{
+    if (fingerprintsRepresentations) [NSException raise:NSInvalidArgumentException format:@"Entity mappings cannot fingerprint representations: fingerprints stored alongside managed objects do not survive refreshes, rollbacks or merges of the objects"];
+    [super setFingerprintsRepresentations:fingerprintsRepresentations];
+}
+
+- (void)setDiscardsInvalidObjectsOnInsert:(BOOL)discardsInvalidObjectsOnInsert
+{
+    RKRaiseIfFrozen();
+    _discardsInvalidObjectsOnInsert = discardsInvalidObjectsOnInsert;
+}
+
+- (void)setDeletionPredicate:(NSPredicate *)deletionPredicate
+{
+    RKRaiseIfFrozen();
+    _deletionPredicate = [deletionPredicate copy];
+}
+
 - (RKConnectionDescription *)connectionForRelationship:(id)relationshipOrName
 {
     if (!([relationshipOrName isKindOfClass:[NSString class]] || [relationshipOrName isKindOfClass:[NSRelationshipDescription class]])) {
@@ -242,6 +304,7 @@ static BOOL entityIdentificationInferenceEnabled = YES;
 
 - (void)addConnection:(RKConnectionDescription *)connection
 {
+    RKRaiseIfFrozen();
     if (! connection) [NSException raise:NSInvalidArgumentException format:@"connection cannot be nil."];
     RKConnectionDescription *existingConnection = [self connectionForRelationship:connection.relationship];
     if (existingConnection) [NSException raise:NSInternalInconsistencyException format:@"Cannot add connection: An existing connection already exists for the '%@' relationship.", connection.relationship.name];
@@ -251,6 +314,7 @@ static BOOL entityIdentificationInferenceEnabled = YES;
 
 - (void)removeConnection:(RKConnectionDescription *)connection
 {
+    RKRaiseIfFrozen();
     [self.mutableConnections removeObject:connection];
 }
 
@@ -261,6 +325,7 @@ static BOOL entityIdentificationInferenceEnabled = YES;
 
 - (void)addConnectionForRelationship:(id)relationshipOrName connectedBy:(id)connectionSpecifier
 {
+    RKRaiseIfFrozen();
     NSRelationshipDescription *relationship = [relationshipOrName isKindOfClass:[NSRelationshipDescription class]] ? relationshipOrName : [[self.entity relationshipsByName] valueForKey:relationshipOrName];
     NSAssert(relationship, @"No relationship was found named '%@' in the '%@' entity", relationshipOrName, [self.entity name]);
     RKConnectionDescription *connection = nil;
@@ -313,8 +378,18 @@ static BOOL entityIdentificationInferenceEnabled = YES;
     return propertyClass;
 }
 
+- (BOOL)canSetPrimitiveValueForDestinationKey:(NSString *)key
+{
+    if (! [[self.entity attributesByName] objectForKey:key]) return NO;
+
+    // Setters implemented by the managed object class would be bypassed, so only the accessors generated by Core Data for `@dynamic` properties qualify
+    objc_property_t property = class_getProperty(self.objectClass, [key UTF8String]);
+    return property && RKPropertyIsDynamic(property);
+}
+
 - (void)setModificationAttribute:(NSAttributeDescription *)modificationAttribute
 {
+    RKRaiseIfFrozen();
     if (modificationAttribute && ![self.entity.properties containsObject:modificationAttribute]) [NSException raise:NSInvalidArgumentException format:@"The attribute given is not a property of the '%@' entity.", [self.entity name]];
     _modificationAttribute = modificationAttribute;
 }
@@ -330,6 +405,12 @@ static BOOL entityIdentificationInferenceEnabled = YES;
     }
 }
 
+- (void)freezeReachableMappings
+{
+    [super freezeReachableMappings];
+    [self.mutableConnections makeObjectsPerformSelector:@selector(freeze)];
+}
+
 + (void)setEntityIdentificationInferenceEnabled:(BOOL)enabled
 {
     entityIdentificationInferenceEnabled = enabled;
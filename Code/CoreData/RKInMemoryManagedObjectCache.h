@@ -20,6 +20,8 @@
 
 #import "RKManagedObjectCaching.h"
 
+@class RKEntityByAttributeCache;
+
 /**
  Provides a fast managed object cache where-in object instances are retained in memory to avoid hitting the Core Data persistent store. Performance is greatly increased over fetch request based strategy at the expense of memory consumption.
  */
@@ -39,4 +41,72 @@
  */
 - (instancetype)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext NS_DESIGNATED_INITIALIZER;
 
+///-------------------------------
+/// @name Loading the Cache
+///-------------------------------
+
+/**
+ The number of objects fetched by each batch when loading the cache of an entity, or `0` to load it with a single fetch.
+
+ When `0`, the first retrieval of objects of an entity waits for every instance of the entity to be loaded. Otherwise it returns as soon as loading has begun, fetching the objects it needs if their batch has not been loaded yet.
+
+ **Default**: `0`
+ @see `[RKEntityByAttributeCache loadBatchSize]`
+ */
+@property (nonatomic, assign) NSUInteger loadBatchSize;
+
+/**
+ A block invoked as the cache of an entity is loaded, with the entity attribute cache being loaded, the number of objects loaded so far and the total number of objects to load.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) void (^loadProgressBlock)(RKEntityByAttributeCache *attributeCache, NSUInteger loadedCount, NSUInteger totalCount);
+
+///-------------------------------
+/// @name Limiting the Cache
+///-------------------------------
+
+/**
+ The maximum number of object IDs held by the cache across all entities, or `0` for no limit. The least recently used keys are evicted once the limit is exceeded, and fetched back from the store when they are needed again.
+
+ **Default**: `0`
+ @see `[RKEntityCache countLimit]`
+ */
+@property (nonatomic, assign) NSUInteger countLimit;
+
+/**
+ Sets the maximum number of object IDs held by the cache of the given entity.
+
+ @param countLimit The maximum number of object IDs, or `0` for no limit.
+ @param entity The entity to limit the cache of.
+ */
+- (void)setCountLimit:(NSUInteger)countLimit forEntity:(NSEntityDescription *)entity;
+
+/**
+ The number of keys looked up and found in the cache.
+ */
+@property (nonatomic, readonly) NSUInteger hitCount;
+
+/**
+ The number of keys looked up and missing from the cache.
+ */
+@property (nonatomic, readonly) NSUInteger missCount;
+
+/**
+ The number of object IDs evicted from the cache.
+ */
+@property (nonatomic, readonly) NSUInteger evictionCount;
+
+///-------------------------------
+/// @name Persisting the Cache
+///-------------------------------
+
+/**
+ The file URL of the directory in which snapshots of the cache are persisted across launches, so that the identification caches of large entities are not rebuilt by fetching every instance of the entity. Snapshots are typically persisted next to the SQLite store, in the directory returned by `RKEntityCacheSnapshotDirectoryURLForPersistentStore`.
+
+ **Default**: `nil`
+ @see `[RKEntityCache snapshotDirectoryURL]`
+ */
+@property (nonatomic, copy) NSURL *snapshotDirectoryURL;
+
 @end
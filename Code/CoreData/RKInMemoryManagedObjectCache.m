@@ -81,6 +81,66 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     [[NSNotificationCenter defaultCenter] removeObserver:self];
 }
 
+- (NSUInteger)loadBatchSize
+{
+    return self.entityCache.loadBatchSize;
+}
+
+- (void)setLoadBatchSize:(NSUInteger)loadBatchSize
+{
+    self.entityCache.loadBatchSize = loadBatchSize;
+}
+
+- (void (^)(RKEntityByAttributeCache *, NSUInteger, NSUInteger))loadProgressBlock
+{
+    return self.entityCache.loadProgressBlock;
+}
+
+- (void)setLoadProgressBlock:(void (^)(RKEntityByAttributeCache *, NSUInteger, NSUInteger))loadProgressBlock
+{
+    self.entityCache.loadProgressBlock = loadProgressBlock;
+}
+
+- (NSUInteger)countLimit
+{
+    return self.entityCache.countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit
+{
+    self.entityCache.countLimit = countLimit;
+}
+
+- (void)setCountLimit:(NSUInteger)countLimit forEntity:(NSEntityDescription *)entity
+{
+    [self.entityCache setCountLimit:countLimit forEntity:entity];
+}
+
+- (NSUInteger)hitCount
+{
+    return self.entityCache.hitCount;
+}
+
+- (NSUInteger)missCount
+{
+    return self.entityCache.missCount;
+}
+
+- (NSUInteger)evictionCount
+{
+    return self.entityCache.evictionCount;
+}
+
+- (NSURL *)snapshotDirectoryURL
+{
+    return self.entityCache.snapshotDirectoryURL;
+}
+
+- (void)setSnapshotDirectoryURL:(NSURL *)snapshotDirectoryURL
+{
+    self.entityCache.snapshotDirectoryURL = snapshotDirectoryURL;
+}
+
 - (NSSet *)managedObjectsWithEntity:(NSEntityDescription *)entity
                     attributeValues:(NSDictionary *)attributeValues
              inManagedObjectContext:(NSManagedObjectContext *)managedObjectContext
@@ -94,33 +154,60 @@ static dispatch_queue_t RKInMemoryManagedObjectCacheCallbackQueue(void)
     if (! [self.entityCache isEntity:entity cachedByAttributes:attributes]) {
         RKLogInfo(@"Caching instances of Entity '%@' by attributes '%@'", entity.name, [attributes componentsJoinedByString:@", "]);
         dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
-        [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes completion:^{
-            dispatch_semaphore_signal(semaphore);
-        }];
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        if (self.loadBatchSize > 0) {
+            // Lookups fetch the objects they need until the batches containing them are loaded, so there is no need to wait
+            [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes completion:nil];
+        } else {
+            [self.entityCache cacheObjectsForEntity:entity byAttributes:attributes completion:^{
+                dispatch_semaphore_signal(semaphore);
+            }];
+            dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        }
         
         RKEntityByAttributeCache *attributeCache = [self.entityCache attributeCacheForEntity:entity attributes:attributes];
         
-        // Fetch any pending objects and add them to the cache
-        NSFetchRequest *fetchRequest = [NSFetchRequest new];
-        fetchRequest.entity = entity;
-        fetchRequest.includesPendingChanges = YES;
-        
-        [managedObjectContext performBlockAndWait:^{
-            NSError *error = nil;
-            NSArray *objects = nil;
-            objects = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
-            if (objects) {
-                [attributeCache addObjects:[NSSet setWithArray:objects] completion:^{
-                    dispatch_semaphore_signal(semaphore);
+        if (self.loadBatchSize > 0) {
+            // Fetching every instance with pending changes would defeat loading in batches, so the pending objects are collected from the unsaved changes of each context instead
+            NSManagedObjectContext *context = managedObjectContext;
+            while (context) {
+                __block NSMutableSet *pendingObjects = nil;
+                [context performBlockAndWait:^{
+                    pendingObjects = [NSMutableSet setWithSet:[context insertedObjects]];
+                    [pendingObjects unionSet:[context updatedObjects]];
+                    [pendingObjects filterUsingPredicate:[NSPredicate predicateWithBlock:^BOOL(NSManagedObject *object, NSDictionary *bindings) {
+                        return [object.entity isKindOfEntity:entity];
+                    }]];
                 }];
-            } else {
-                RKLogError(@"Fetched pre-loading existing managed objects with error: %@", error);
-                dispatch_semaphore_signal(semaphore);
+                if ([pendingObjects count]) {
+                    [attributeCache addObjects:pendingObjects completion:^{
+                        dispatch_semaphore_signal(semaphore);
+                    }];
+                    dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+                }
+                context = [context parentContext];
             }
-        }];
-        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        } else {
+            // Fetch any pending objects and add them to the cache
+            NSFetchRequest *fetchRequest = [NSFetchRequest new];
+            fetchRequest.entity = entity;
+            fetchRequest.includesPendingChanges = YES;
         
+            [managedObjectContext performBlockAndWait:^{
+                NSError *error = nil;
+                NSArray *objects = nil;
+                objects = [managedObjectContext executeFetchRequest:fetchRequest error:&error];
+                if (objects) {
+                    [attributeCache addObjects:[NSSet setWithArray:objects] completion:^{
+                        dispatch_semaphore_signal(semaphore);
+                    }];
+                } else {
+                    RKLogError(@"Fetched pre-loading existing managed objects with error: %@", error);
+                    dispatch_semaphore_signal(semaphore);
+                }
+            }];
+            dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+        }
+
 #if !OS_OBJECT_USE_OBJC
         dispatch_release(semaphore);
 #endif
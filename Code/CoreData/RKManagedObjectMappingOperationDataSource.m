@@ -33,28 +33,27 @@
 #import "RKRelationshipMapping.h"
 #import "RKObjectUtilities.h"
 #import "NSManagedObject+RKAdditions.h"
+#import "RKObjectMappingPlan.h"
 
 extern NSString * const RKObjectMappingNestingAttributeKeyName;
 
 static void *RKManagedObjectMappingOperationDataSourceAssociatedObjectKey = &RKManagedObjectMappingOperationDataSourceAssociatedObjectKey;
 
-NSArray *RKApplyNestingAttributeValueToMappings(NSString *attributeName, id value, NSArray *propertyMappings);
-
-static id RKValueForAttributeMappingInRepresentation(RKAttributeMapping *attributeMapping, NSDictionary *representation)
+static id RKValueForAttributePlanInRepresentation(RKPropertyMappingPlan *attributePlan, NSDictionary *representation)
 {
-    if ([attributeMapping.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
+    if ([attributePlan.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
         return [[representation allKeys] lastObject];
-    } else if (attributeMapping.sourceKeyPath == nil){
+    } else if (attributePlan.sourceKeyPath == nil){
         return representation[[NSNull null]];
     } else {
-        return [representation valueForKeyPath:attributeMapping.sourceKeyPath];
+        return [attributePlan valueForSourceKeyPathOfRepresentation:representation];
     }
 }
 
-static RKAttributeMapping *RKAttributeMappingForNameInMappings(NSString *name, NSArray *attributeMappings)
+static RKPropertyMappingPlan *RKAttributePlanForNameInPlans(NSString *name, NSArray *attributePlans)
 {
-    for (RKAttributeMapping *attributeMapping in attributeMappings) {
-        if ([[attributeMapping destinationKeyPath] isEqualToString:name]) return attributeMapping;
+    for (RKPropertyMappingPlan *attributePlan in attributePlans) {
+        if ([[attributePlan destinationKeyPath] isEqualToString:name]) return attributePlan;
     }
     
     return nil;
@@ -67,29 +66,34 @@ static NSDictionary *RKEntityIdentificationAttributesForEntityMappingWithReprese
 {
     NSCParameterAssert(entityMapping);
     NSCAssert([representation isKindOfClass:[NSDictionary class]], @"Expected a dictionary representation");
-    NSArray *attributeMappings = entityMapping.attributeMappings;
+    RKObjectMappingPlan *executionPlan = entityMapping.executionPlan;
     __block NSError *error = nil;
 
-    // If the representation is mapped with a nesting attribute, we must apply the nesting value to the representation before constructing the identification attributes
+    // If the representation is mapped with a nesting attribute, we must apply the nesting value to the key path templates before constructing the identification attributes
     RKAttributeMapping *nestingAttributeMapping = [entityMapping mappingForSourceKeyPath:RKObjectMappingNestingAttributeKeyName];
     if (nestingAttributeMapping) {
         Class attributeClass = [entityMapping classForProperty:nestingAttributeMapping.destinationKeyPath];
         id attributeValue = nil;
         id<RKValueTransforming> valueTransformer = nestingAttributeMapping.valueTransformer ?: entityMapping.valueTransformer;
         [valueTransformer transformValue:[[representation allKeys] lastObject] toValue:&attributeValue ofClass:attributeClass error:&error];
-        attributeMappings = RKApplyNestingAttributeValueToMappings(nestingAttributeMapping.destinationKeyPath, attributeValue, attributeMappings);
+        executionPlan = [executionPlan planBySubstitutingValue:attributeValue forNestingAttribute:nestingAttributeMapping.destinationKeyPath objectMapping:entityMapping];
     }
     
     // Map the identification attributes
     NSMutableDictionary *entityIdentifierAttributes = [NSMutableDictionary dictionaryWithCapacity:[entityMapping.identificationAttributes count]];
     [entityMapping.identificationAttributes enumerateObjectsUsingBlock:^(NSAttributeDescription *attribute, NSUInteger idx, BOOL *stop) {
-        RKAttributeMapping *attributeMapping = RKAttributeMappingForNameInMappings([attribute name], attributeMappings);
+        RKPropertyMappingPlan *attributePlan = RKAttributePlanForNameInPlans([attribute name], executionPlan.attributePlans);
         Class attributeClass = [entityMapping classForProperty:[attribute name]];
-        id sourceValue = RKValueForAttributeMappingInRepresentation(attributeMapping, representation);
+        id sourceValue = RKValueForAttributePlanInRepresentation(attributePlan, representation);
         id attributeValue = nil;
-        id<RKValueTransforming> valueTransformer = attributeMapping.valueTransformer ?: entityMapping.valueTransformer;
+        RKPropertyMapping *propertyMapping = attributePlan.propertyMapping;
 
-        if (sourceValue) [valueTransformer transformValue:sourceValue toValue:&attributeValue ofClass:attributeClass error:&error];
+        // Property mappings memoize the transformer resolved for each pair of classes
+        if (sourceValue && propertyMapping) {
+            [propertyMapping transformValue:sourceValue toValue:&attributeValue ofClass:attributeClass error:&error];
+        } else if (sourceValue) {
+            [entityMapping.valueTransformer transformValue:sourceValue toValue:&attributeValue ofClass:attributeClass error:&error];
+        }
         entityIdentifierAttributes[[attribute name]] = attributeValue ?: [NSNull null];
     }];
     
@@ -127,6 +131,15 @@ static BOOL RKDeleteInvalidNewManagedObject(NSManagedObject *managedObject)
     return NO;
 }
 
+/**
+ Objects that are pending insertion and have never been saved are new to the context, so their values are persisted in full when it is saved.
+ */
+static BOOL RKManagedObjectIsUnsavedInsertion(id object)
+{
+    if (! [object isKindOfClass:[NSManagedObject class]]) return NO;
+    return [object isInserted] && [[object objectID] isTemporaryID];
+}
+
 @interface RKManagedObjectDeletionOperation : NSOperation
 
 - (instancetype)initWithManagedObjectContext:(NSManagedObjectContext *)managedObjectContext;
@@ -291,19 +304,123 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
     }
 
     if (managedObject == nil) {
-        NSEntityDescription *localEntity = [NSEntityDescription entityForName:[entity name] inManagedObjectContext:self.managedObjectContext];
-        managedObject = [[NSManagedObject alloc] initWithEntity:localEntity insertIntoManagedObjectContext:self.managedObjectContext];
-        [managedObject setValuesForKeysWithDictionary:entityIdentifierAttributes];        
-        if (entityMapping.persistentStore) [self.managedObjectContext assignObject:managedObject toPersistentStore:entityMapping.persistentStore];
+        managedObject = [self insertNewObjectForEntityMapping:entityMapping withIdentificationAttributes:entityIdentifierAttributes];
+    }
 
-        if ([self.managedObjectCache respondsToSelector:@selector(didCreateObject:)]) {
-            [self.managedObjectCache didCreateObject:managedObject];
-        }
+    return managedObject;
+}
+
+- (NSManagedObject *)insertNewObjectForEntityMapping:(RKEntityMapping *)entityMapping withIdentificationAttributes:(NSDictionary *)entityIdentifierAttributes
+{
+    NSEntityDescription *localEntity = [NSEntityDescription entityForName:[[entityMapping entity] name] inManagedObjectContext:self.managedObjectContext];
+    NSManagedObject *managedObject = [[NSManagedObject alloc] initWithEntity:localEntity insertIntoManagedObjectContext:self.managedObjectContext];
+    [managedObject setValuesForKeysWithDictionary:entityIdentifierAttributes];
+    if (entityMapping.persistentStore) [self.managedObjectContext assignObject:managedObject toPersistentStore:entityMapping.persistentStore];
+
+    if ([self.managedObjectCache respondsToSelector:@selector(didCreateObject:)]) {
+        [self.managedObjectCache didCreateObject:managedObject];
     }
 
     return managedObject;
 }
 
+/**
+ Retrieves the target objects of a collection of representations with a single query of the managed object cache for the union of their identification attribute values, then matches each representation to the fetched objects in memory. Representations with missing identification attribute values are resolved individually, exactly as if the batch method were not implemented.
+ */
+- (NSArray *)mappingOperation:(RKMappingOperation *)mappingOperation targetObjectsForRepresentations:(NSArray *)representations withMapping:(RKObjectMapping *)mapping inRelationship:(RKRelationshipMapping *)relationship
+{
+    NSAssert(self.managedObjectContext, @"%@ must be initialized with a managed object context.", [self class]);
+    if (! [mapping isKindOfClass:[RKEntityMapping class]] || ! self.managedObjectCache) return nil;
+    RKEntityMapping *entityMapping = (RKEntityMapping *)mapping;
+    NSArray *identificationAttributeNames = [entityMapping.identificationAttributes valueForKey:@"name"];
+    if ([identificationAttributeNames count] == 0) return nil;
+
+    // Extract the identification attributes of every representation and collect the distinct values of each attribute
+    NSMutableArray *identificationAttributesOfRepresentations = [NSMutableArray arrayWithCapacity:[representations count]];
+    NSMutableDictionary *attributeValues = [NSMutableDictionary dictionaryWithCapacity:[identificationAttributeNames count]];
+    for (NSString *attributeName in identificationAttributeNames) attributeValues[attributeName] = [NSMutableSet set];
+    for (NSDictionary *representation in representations) {
+        NSDictionary *entityIdentifierAttributes = RKEntityIdentificationAttributesForEntityMappingWithRepresentation(entityMapping, representation);
+        [identificationAttributesOfRepresentations addObject:entityIdentifierAttributes];
+        if ([[entityIdentifierAttributes allValues] containsObject:[NSNull null]]) continue;
+        [entityIdentifierAttributes enumerateKeysAndObjectsUsingBlock:^(NSString *attributeName, id value, BOOL *stop) {
+            [attributeValues[attributeName] addObject:value];
+        }];
+    }
+
+    NSMutableDictionary *objectsByIdentificationAttributes = [NSMutableDictionary dictionary];
+    if ([[attributeValues allValues][0] count]) {
+        NSMutableDictionary *queryAttributeValues = [NSMutableDictionary dictionaryWithCapacity:[attributeValues count]];
+        [attributeValues enumerateKeysAndObjectsUsingBlock:^(NSString *attributeName, NSSet *values, BOOL *stop) {
+            queryAttributeValues[attributeName] = [values allObjects];
+        }];
+        NSSet *objects = [self.managedObjectCache managedObjectsWithEntity:[entityMapping entity]
+                                                           attributeValues:queryAttributeValues
+                                                    inManagedObjectContext:self.managedObjectContext];
+        if (entityMapping.identificationPredicate) objects = [objects filteredSetUsingPredicate:entityMapping.identificationPredicate];
+        for (NSManagedObject *managedObject in objects) {
+            if (managedObject.isDeleted) continue;
+            NSDictionary *identificationAttributeValues = [managedObject dictionaryWithValuesForKeys:identificationAttributeNames];
+            NSMutableArray *matchingObjects = objectsByIdentificationAttributes[identificationAttributeValues];
+            if (! matchingObjects) {
+                matchingObjects = [NSMutableArray arrayWithCapacity:1];
+                objectsByIdentificationAttributes[identificationAttributeValues] = matchingObjects;
+            }
+            [matchingObjects addObject:managedObject];
+        }
+    }
+
+    // If we are mapping within a relationship, an existing object without identification attributes is updated in place of the first object that would be created
+    __block NSManagedObject *unidentifiedExistingObject = nil;
+    if (relationship) {
+        id existingObjectsOfRelationship = [mappingOperation.destinationObject valueForKeyPath:relationship.destinationKeyPath];
+        if (existingObjectsOfRelationship && !RKObjectIsCollection(existingObjectsOfRelationship)) existingObjectsOfRelationship = @[ existingObjectsOfRelationship ];
+        NSSet *setWithNull = [NSSet setWithObject:[NSNull null]];
+        for (NSManagedObject *existingObject in existingObjectsOfRelationship) {
+            if (existingObject.isDeleted) continue;
+            if ([[NSSet setWithArray:[[existingObject dictionaryWithValuesForKeys:identificationAttributeNames] allValues]] isEqualToSet:setWithNull]) {
+                unidentifiedExistingObject = existingObject;
+                break;
+            }
+        }
+    }
+
+    NSMutableArray *targetObjects = [NSMutableArray arrayWithCapacity:[representations count]];
+    [representations enumerateObjectsUsingBlock:^(NSDictionary *representation, NSUInteger index, BOOL *stop) {
+        NSDictionary *entityIdentifierAttributes = identificationAttributesOfRepresentations[index];
+        if ([[entityIdentifierAttributes allValues] containsObject:[NSNull null]]) {
+            id targetObject = [self mappingOperation:mappingOperation targetObjectForRepresentation:representation withMapping:mapping inRelationship:relationship];
+            [targetObjects addObject:targetObject ?: [NSNull null]];
+            return;
+        }
+
+        NSArray *objects = objectsByIdentificationAttributes[entityIdentifierAttributes];
+        if (entityMapping.identificationPredicateBlock && [objects count]) {
+            NSPredicate *predicate = entityMapping.identificationPredicateBlock(representation, self.managedObjectContext);
+            if (predicate) objects = [objects filteredArrayUsingPredicate:predicate];
+        }
+
+        NSManagedObject *managedObject = [objects firstObject];
+        if (managedObject) {
+            if ([objects count] > 1) RKLogWarning(@"Managed object cache returned %ld objects for the identifier configured for the '%@' entity, expected 1.", (long) [objects count], [[entityMapping entity] name]);
+            if ([self.managedObjectCache respondsToSelector:@selector(didFetchObject:)]) {
+                [self.managedObjectCache didFetchObject:managedObject];
+            }
+        } else if (unidentifiedExistingObject) {
+            managedObject = unidentifiedExistingObject;
+            unidentifiedExistingObject = nil;
+        } else {
+            managedObject = [self insertNewObjectForEntityMapping:entityMapping withIdentificationAttributes:entityIdentifierAttributes];
+        }
+
+        // Later representations with the same identifier in the collection are mapped onto the same object
+        if (! objects) objectsByIdentificationAttributes[entityIdentifierAttributes] = [NSMutableArray arrayWithObject:managedObject];
+        [targetObjects addObject:managedObject];
+    }];
+
+    return targetObjects;
+}
+
 // Mapping operations should be executed against managed object contexts with the `NSPrivateQueueConcurrencyType` concurrency type
 - (BOOL)executingConnectionOperationsWouldDeadlock
 {
@@ -470,6 +587,16 @@ extern NSString * const RKObjectMappingNestingAttributeKeyName;
     return [mappingOperation isNewDestinationObject];
 }
 
+- (BOOL)mappingOperationShouldSetPrimitiveValues:(RKMappingOperation *)mappingOperation
+{
+    return RKManagedObjectIsUnsavedInsertion(mappingOperation.destinationObject);
+}
+
+- (BOOL)mappingOperationDidInsertDestinationObject:(RKMappingOperation *)mappingOperation
+{
+    return RKManagedObjectIsUnsavedInsertion(mappingOperation.destinationObject);
+}
+
 - (BOOL)isDestinationObjectNotModifiedInMappingOperation:(RKMappingOperation *)mappingOperation {
     // Use concrete mapping or original mapping if not available
     RKMapping *checkedMapping = mappingOperation.objectMapping ?: mappingOperation.mapping;
@@ -31,18 +31,15 @@
 #define RKLogComponent RKlcl_cRestKitCoreData
 
 @interface RKPropertyInspector ()
-@property (nonatomic, assign) dispatch_queue_t queue;
-@property (nonatomic, strong) NSMutableDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *inspectionCache;
+- (void)cacheInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key;
 @end
 
 @implementation RKPropertyInspector (CoreData)
 
 - (NSDictionary *)propertyInspectionForEntity:(NSEntityDescription *)entity
 {
-    __block NSMutableDictionary *entityInspection;
-    dispatch_sync(self.queue, ^{
-        entityInspection = (self.inspectionCache)[[entity name]];
-    });
+    NSMutableDictionary *entityInspection = (self.inspectionCache)[[entity name]];
     if (entityInspection) return entityInspection;
 
     entityInspection = [NSMutableDictionary dictionary];
@@ -113,10 +110,7 @@
         }
     }
 
-    dispatch_barrier_async(self.queue, ^{
-        (self.inspectionCache)[[entity name]] = entityInspection;
-        RKLogDebug(@"Cached property inspection for Entity '%@': %@", entity, entityInspection);
-    });
+    [self cacheInspection:entityInspection forKey:[entity name]];
     return entityInspection;
 }
 
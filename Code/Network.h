@@ -27,6 +27,7 @@
 #import "RKHTTPUtilities.h"
 #import "RKObjectRequestOperation.h"
 #import "RKObjectParameterization.h"
+#import "RKObjectJSONSerialization.h"
 #import "RKPathMatcher.h"
 
 #if __has_include("CoreData.h")
@@ -0,0 +1,56 @@
+//
+//  RKObjectJSONSerialization.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKRequestDescriptor.h"
+
+/**
+ The `RKObjectJSONSerialization` class serializes local domain objects directly into JSON data by walking the request mapping of a request descriptor.
+
+ The JSON produced is equivalent to serializing the parameters returned by `RKObjectParameterization` as JSON, but the values read from the objects are written directly into the output data: no `RKMappingOperation` is performed and no intermediate dictionaries are created. Values are converted exactly as during parameterization: dates are formatted with the value transformer of their attribute mapping, decimal numbers are written as strings, sets and ordered sets as arrays and the values of Boolean properties as `true` or `false`.
+
+ The key paths of each object mapping are compiled once per serialization, so the cost of serializing a large collection of objects sharing a mapping is dominated by reading the values of the objects. Mappings using features that depend on the state of a mapping operation (such as metadata key paths, nesting attributes or forced collection mapping) and values that cannot be written natively are serialized by falling back to `RKObjectParameterization` and `RKMIMETypeSerialization`, so the output is the same for all mappings.
+ */
+@interface RKObjectJSONSerialization : NSObject
+
+///-------------------------------
+/// @name Serializing Objects
+///-------------------------------
+
+/**
+ Returns JSON data representing the given object, mapped with the mapping of the given request descriptor. If the request descriptor specifies a root key path, the representation of the object is nested within a JSON object under the root key path.
+
+ @param object The object to be serialized.
+ @param requestDescriptor The request descriptor describing how the object is to be mapped.
+ @param error If there is a problem serializing the object, upon return contains a pointer to an instance of `NSError` that describes the problem.
+ @return The JSON data representing the object, or `nil` if an error has occurred.
+ */
++ (NSData *)JSONDataWithObject:(id)object requestDescriptor:(RKRequestDescriptor *)requestDescriptor error:(NSError **)error;
+
+/**
+ Returns JSON data representing an array of the given objects, each mapped with the mapping of the given request descriptor. If the request descriptor specifies a root key path, the array is nested within a JSON object under the root key path.
+
+ @param objects The objects to be serialized.
+ @param requestDescriptor The request descriptor describing how the objects are to be mapped.
+ @param error If there is a problem serializing the objects, upon return contains a pointer to an instance of `NSError` that describes the problem.
+ @return The JSON data representing the objects, or `nil` if an error has occurred.
+ */
++ (NSData *)JSONDataWithObjects:(NSArray *)objects requestDescriptor:(RKRequestDescriptor *)requestDescriptor error:(NSError **)error;
+
+@end
@@ -0,0 +1,475 @@
+//
+//  RKObjectJSONSerialization.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <float.h>
+#import "RKObjectJSONSerialization.h"
+#import "RKObjectParameterization.h"
+#import "RKMIMETypeSerialization.h"
+#import "RKMIMETypes.h"
+#import "RKObjectMapping.h"
+#import "RKObjectMappingPlan.h"
+#import "RKAttributeMapping.h"
+#import "RKRelationshipMapping.h"
+#import "RKDynamicMapping.h"
+#import "RKPropertyInspector.h"
+#import "RKObjectUtilities.h"
+#import "RKBooleanClass.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitNetwork
+
+typedef NS_ENUM(NSInteger, RKObjectJSONWriteResult) {
+    RKObjectJSONWriteResultSkipped,     // Nothing was written, as no value is assigned by the mapping
+    RKObjectJSONWriteResultWritten,
+    RKObjectJSONWriteResultUnsupported  // The value or mapping can only be serialized by parameterization
+};
+
+static void RKObjectJSONAppendString(NSMutableData *data, const char *string)
+{
+    [data appendBytes:string length:strlen(string)];
+}
+
+static void RKObjectJSONAppendEscapedString(NSMutableData *data, NSString *string)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    CFStringRef stringRef = (__bridge CFStringRef)string;
+    CFIndex length = CFStringGetLength(stringRef);
+    CFIndex location = 0;
+    UInt8 buffer[1024];
+    [data appendBytes:"\"" length:1];
+    while (location < length) {
+        CFIndex usedLength = 0;
+        CFIndex convertedLength = CFStringGetBytes(stringRef, CFRangeMake(location, length - location), kCFStringEncodingUTF8, '?', false, buffer, sizeof(buffer), &usedLength);
+        if (convertedLength == 0) break;
+        location += convertedLength;
+
+        // Runs of characters that need no escaping are appended at once
+        CFIndex runStart = 0;
+        for (CFIndex index = 0; index < usedLength; index++) {
+            UInt8 byte = buffer[index];
+            if (byte >= 0x20 && byte != '"' && byte != '\\') continue;
+            if (index > runStart) [data appendBytes:buffer + runStart length:index - runStart];
+            runStart = index + 1;
+            switch (byte) {
+                case '"': RKObjectJSONAppendString(data, "\\\""); break;
+                case '\\': RKObjectJSONAppendString(data, "\\\\"); break;
+                case '\n': RKObjectJSONAppendString(data, "\\n"); break;
+                case '\r': RKObjectJSONAppendString(data, "\\r"); break;
+                case '\t': RKObjectJSONAppendString(data, "\\t"); break;
+                default: {
+                    char escape[] = { '\\', 'u', '0', '0', hexDigits[byte >> 4], hexDigits[byte & 0xF] };
+                    [data appendBytes:escape length:sizeof(escape)];
+                }
+            }
+        }
+        if (usedLength > runStart) [data appendBytes:buffer + runStart length:usedLength - runStart];
+    }
+    [data appendBytes:"\"" length:1];
+}
+
+static BOOL RKObjectJSONAppendNumber(NSMutableData *data, NSNumber *number)
+{
+    if ((__bridge CFBooleanRef)number == kCFBooleanTrue || (__bridge CFBooleanRef)number == kCFBooleanFalse) {
+        RKObjectJSONAppendString(data, [number boolValue] ? "true" : "false");
+        return YES;
+    }
+
+    if ([number isKindOfClass:[NSDecimalNumber class]]) {
+        RKObjectJSONAppendString(data, [[number stringValue] UTF8String]);
+        return YES;
+    }
+
+    char buffer[32];
+    const char *type = [number objCType];
+    if (strcmp(type, @encode(float)) == 0) {
+        float value = [number floatValue];
+        if (! isfinite(value)) return NO;
+        // Floats are written at their own precision, as widening them to doubles adds spurious digits
+        for (int precision = FLT_DIG; precision <= FLT_DECIMAL_DIG; precision++) {
+            snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+            if (strtof(buffer, NULL) == value) break;
+        }
+    } else if (strcmp(type, @encode(double)) == 0) {
+        double value = [number doubleValue];
+        if (! isfinite(value)) return NO;
+        // Use the shortest representation that reads back as the same value
+        for (int precision = 15; precision <= 17; precision++) {
+            snprintf(buffer, sizeof(buffer), "%.*g", precision, value);
+            if (strtod(buffer, NULL) == value) break;
+        }
+    } else if (strcmp(type, @encode(unsigned long long)) == 0) {
+        snprintf(buffer, sizeof(buffer), "%llu", [number unsignedLongLongValue]);
+    } else {
+        snprintf(buffer, sizeof(buffer), "%lld", [number longLongValue]);
+    }
+    RKObjectJSONAppendString(data, buffer);
+    return YES;
+}
+
+// Writes a value of one of the types supported by `NSJSONSerialization`
+static BOOL RKObjectJSONAppendValue(NSMutableData *data, id value)
+{
+    if ([value isKindOfClass:[NSString class]]) {
+        RKObjectJSONAppendEscapedString(data, value);
+    } else if ([value isKindOfClass:[NSNumber class]]) {
+        return RKObjectJSONAppendNumber(data, value);
+    } else if (value == [NSNull null]) {
+        RKObjectJSONAppendString(data, "null");
+    } else if ([value isKindOfClass:[NSArray class]]) {
+        [data appendBytes:"[" length:1];
+        BOOL first = YES;
+        for (id element in value) {
+            if (! first) [data appendBytes:"," length:1];
+            if (! RKObjectJSONAppendValue(data, element)) return NO;
+            first = NO;
+        }
+        [data appendBytes:"]" length:1];
+    } else if ([value isKindOfClass:[NSDictionary class]]) {
+        [data appendBytes:"{" length:1];
+        BOOL first = YES;
+        for (id key in value) {
+            if (! [key isKindOfClass:[NSString class]]) return NO;
+            if (! first) [data appendBytes:"," length:1];
+            RKObjectJSONAppendEscapedString(data, key);
+            [data appendBytes:":" length:1];
+            if (! RKObjectJSONAppendValue(data, [value objectForKey:key])) return NO;
+            first = NO;
+        }
+        [data appendBytes:"}" length:1];
+    } else {
+        return NO;
+    }
+    return YES;
+}
+
+// Metadata key paths can only be evaluated against the source object of a mapping operation
+static BOOL RKObjectJSONCanReadSourceKeyPathOfPlan(RKPropertyMappingPlan *plan)
+{
+    NSString *sourceKeyPath = plan.sourceKeyPath;
+    if (! sourceKeyPath) return NO;
+    if (! plan.requiresKeyValueCodingForSource) return YES;
+    for (NSString *prefix in @[ @"@metadata", @"@parent", @"@root", @"self" ]) {
+        if ([sourceKeyPath hasPrefix:prefix]) return NO;
+    }
+    return YES;
+}
+
+/**
+ A node of the tree of destination keys of an object mapping. Leaf nodes hold the plan of the property mapping assigning the key, while the other nodes stand for the intermediate dictionaries created for destination key paths with multiple components.
+ */
+@interface RKObjectJSONNode : NSObject
+@property (nonatomic, copy) NSString *key;
+@property (nonatomic, strong) NSData *keyData;
+@property (nonatomic, strong) RKPropertyMappingPlan *plan;
+@property (nonatomic, strong) NSMutableArray *childNodes;
+
+// The class of the last object whose source property was inspected, and whether the property is Boolean
+@property (nonatomic, assign) Class inspectedClass;
+@property (nonatomic, assign) BOOL inspectedPropertyIsBoolean;
+@end
+
+@implementation RKObjectJSONNode
+
+- (instancetype)initWithKey:(NSString *)key
+{
+    self = [super init];
+    if (self) {
+        self.key = key;
+        NSMutableData *keyData = [NSMutableData data];
+        RKObjectJSONAppendEscapedString(keyData, key);
+        [keyData appendBytes:":" length:1];
+        self.keyData = keyData;
+    }
+    return self;
+}
+
+- (BOOL)isSourcePropertyBooleanForObject:(id)object
+{
+    Class objectClass = [object class];
+    if (objectClass != self.inspectedClass) {
+        Class propertyClass = RKPropertyInspectorGetClassForPropertyAtKeyPathOfObject(self.plan.sourceKeyPath, object);
+        self.inspectedPropertyIsBoolean = [propertyClass isSubclassOfClass:RK_BOOLEAN_CLASS];
+        self.inspectedClass = objectClass;
+    }
+    return self.inspectedPropertyIsBoolean;
+}
+
+@end
+
+@interface RKObjectJSONSerialization ()
+@property (nonatomic, strong) RKRequestDescriptor *requestDescriptor;
+@property (nonatomic, strong) NSMutableData *data;
+@property (nonatomic, strong) NSMapTable *nodesByObjectMapping;
+@end
+
+@implementation RKObjectJSONSerialization
+
++ (NSData *)JSONDataWithObject:(id)object requestDescriptor:(RKRequestDescriptor *)requestDescriptor error:(NSError **)error
+{
+    NSParameterAssert(object);
+    return [[[self alloc] initWithRequestDescriptor:requestDescriptor] JSONDataWithObjects:@[ object ] inArray:NO error:error];
+}
+
++ (NSData *)JSONDataWithObjects:(NSArray *)objects requestDescriptor:(RKRequestDescriptor *)requestDescriptor error:(NSError **)error
+{
+    NSParameterAssert(objects);
+    return [[[self alloc] initWithRequestDescriptor:requestDescriptor] JSONDataWithObjects:objects inArray:YES error:error];
+}
+
+- (instancetype)initWithRequestDescriptor:(RKRequestDescriptor *)requestDescriptor
+{
+    NSParameterAssert(requestDescriptor);
+
+    self = [super init];
+    if (self) {
+        self.requestDescriptor = requestDescriptor;
+        self.nodesByObjectMapping = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+    }
+    return self;
+}
+
+- (NSData *)JSONDataWithObjects:(NSArray *)objects inArray:(BOOL)inArray error:(NSError **)error
+{
+    NSString *rootKeyPath = self.requestDescriptor.rootKeyPath;
+    self.data = [NSMutableData dataWithCapacity:256 * [objects count]];
+    if (rootKeyPath) {
+        [self.data appendBytes:"{" length:1];
+        RKObjectJSONAppendEscapedString(self.data, rootKeyPath);
+        [self.data appendBytes:":" length:1];
+    }
+    if (inArray) [self.data appendBytes:"[" length:1];
+
+    BOOL first = YES;
+    for (id object in objects) {
+        if (! first) [self.data appendBytes:"," length:1];
+        first = NO;
+        RKObjectMapping *objectMapping = [self objectMappingForObject:object withMapping:self.requestDescriptor.mapping];
+        if (! objectMapping || [self writeObject:object withObjectMapping:objectMapping] == RKObjectJSONWriteResultUnsupported) {
+            RKLogDebug(@"Unable to serialize object '%@' directly to JSON: serializing parameterized representation instead", object);
+            self.data = nil;
+            return [self JSONDataByParameterizingObjects:objects inArray:inArray error:error];
+        }
+    }
+
+    if (inArray) [self.data appendBytes:"]" length:1];
+    if (rootKeyPath) [self.data appendBytes:"}" length:1];
+    NSData *data = self.data;
+    self.data = nil;
+    return data;
+}
+
+// Produces the same output by performing object mapping, for mappings and values that cannot be written directly
+- (NSData *)JSONDataByParameterizingObjects:(NSArray *)objects inArray:(BOOL)inArray error:(NSError **)error
+{
+    NSString *rootKeyPath = self.requestDescriptor.rootKeyPath;
+    NSMutableArray *representations = [NSMutableArray arrayWithCapacity:[objects count]];
+    for (id object in objects) {
+        NSDictionary *parameters = [RKObjectParameterization parametersWithObject:object requestDescriptor:self.requestDescriptor error:error];
+        if (! parameters) return nil;
+        [representations addObject:rootKeyPath ? parameters[rootKeyPath] : parameters];
+    }
+
+    id representation = inArray ? representations : [representations firstObject];
+    if (rootKeyPath) representation = @{ rootKeyPath: representation };
+    return [RKMIMETypeSerialization dataFromObject:representation MIMEType:RKMIMETypeJSON error:error];
+}
+
+- (RKObjectMapping *)objectMappingForObject:(id)object withMapping:(RKMapping *)mapping
+{
+    if ([mapping isKindOfClass:[RKObjectMapping class]]) return (RKObjectMapping *)mapping;
+    if ([mapping isKindOfClass:[RKDynamicMapping class]]) return [(RKDynamicMapping *)mapping objectMappingForRepresentation:object];
+    return nil;
+}
+
+#pragma mark - Compiling Mappings
+
+- (NSArray *)nodesForObjectMapping:(RKObjectMapping *)objectMapping
+{
+    id nodes = [self.nodesByObjectMapping objectForKey:objectMapping];
+    if (! nodes) {
+        nodes = [self compiledNodesForObjectMapping:objectMapping] ?: [NSNull null];
+        [self.nodesByObjectMapping setObject:nodes forKey:objectMapping];
+    }
+    return (nodes == [NSNull null]) ? nil : nodes;
+}
+
+// Returns the tree of destination keys of the object mapping, or `nil` if it can only be applied by a mapping operation
+- (NSArray *)compiledNodesForObjectMapping:(RKObjectMapping *)objectMapping
+{
+    // Transformations to the classes of the properties of a model object depend on the destination object
+    if (! [objectMapping.objectClass isSubclassOfClass:[NSDictionary class]]) return nil;
+    RKObjectMappingPlan *executionPlan = objectMapping.executionPlan;
+    if (executionPlan.attributePlanFromKeyOfRepresentation || executionPlan.attributePlanToKeyOfRepresentation) return nil;
+
+    // Later mappings of a destination key path replace earlier ones, in the order applied by `RKMappingOperation`
+    NSMutableArray *rootNodes = [NSMutableArray array];
+    for (NSArray *plans in @[ executionPlan.keyAttributePlans, executionPlan.relationshipPlans, executionPlan.keyPathAttributePlans ]) {
+        for (RKPropertyMappingPlan *plan in plans) {
+            if (plan.isNestingAttribute || ! RKObjectJSONCanReadSourceKeyPathOfPlan(plan)) return nil;
+            NSArray *keys = plan.destinationKeyPathComponents;
+            if ([keys count] == 0) return nil;
+            if ([plan.propertyMapping isKindOfClass:[RKRelationshipMapping class]]) {
+                // Missing relationships create intermediate dictionaries without assigning a value
+                RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plan.propertyMapping;
+                if ([keys count] > 1 || relationshipMapping.mapping.forceCollectionMapping || relationshipMapping.propertyValueClass) return nil;
+            }
+
+            NSMutableArray *nodes = rootNodes;
+            for (NSUInteger index = 0; index < [keys count]; index++) {
+                NSString *key = keys[index];
+                BOOL isLastKey = (index == [keys count] - 1);
+                RKObjectJSONNode *node = nil;
+                for (RKObjectJSONNode *existingNode in nodes) {
+                    if ([existingNode.key isEqualToString:key]) {
+                        node = existingNode;
+                        break;
+                    }
+                }
+                if (node && (isLastKey ? node.childNodes != nil : node.plan != nil)) return nil;
+                if (! node) {
+                    node = [[RKObjectJSONNode alloc] initWithKey:key];
+                    if (! isLastKey) node.childNodes = [NSMutableArray array];
+                    [nodes addObject:node];
+                }
+                if (isLastKey) {
+                    node.plan = plan;
+                } else {
+                    nodes = node.childNodes;
+                }
+            }
+        }
+    }
+
+    return rootNodes;
+}
+
+#pragma mark - Writing Objects
+
+- (RKObjectJSONWriteResult)writeObject:(id)object withObjectMapping:(RKObjectMapping *)objectMapping
+{
+    NSArray *nodes = [self nodesForObjectMapping:objectMapping];
+    if (! nodes) return RKObjectJSONWriteResultUnsupported;
+    return [self writeNodes:nodes ofObject:object objectMapping:objectMapping];
+}
+
+- (RKObjectJSONWriteResult)writeNodes:(NSArray *)nodes ofObject:(id)object objectMapping:(RKObjectMapping *)objectMapping
+{
+    NSMutableData *data = self.data;
+    [data appendBytes:"{" length:1];
+    BOOL wroteNode = NO;
+    for (RKObjectJSONNode *node in nodes) {
+        NSUInteger length = [data length];
+        if (wroteNode) [data appendBytes:"," length:1];
+        [data appendData:node.keyData];
+
+        RKObjectJSONWriteResult result;
+        if (node.childNodes) {
+            result = [self writeNodes:node.childNodes ofObject:object objectMapping:objectMapping];
+        } else if ([node.plan.propertyMapping isKindOfClass:[RKRelationshipMapping class]]) {
+            result = [self writeRelationshipOfNode:node ofObject:object];
+        } else {
+            result = [self writeAttributeOfNode:node ofObject:object objectMapping:objectMapping];
+        }
+
+        if (result == RKObjectJSONWriteResultUnsupported) return result;
+        if (result == RKObjectJSONWriteResultSkipped) {
+            [data setLength:length];
+        } else {
+            wroteNode = YES;
+        }
+    }
+    [data appendBytes:"}" length:1];
+
+    // Intermediate dictionaries are only created when a value is assigned within them
+    return wroteNode ? RKObjectJSONWriteResultWritten : RKObjectJSONWriteResultSkipped;
+}
+
+// Mirrors the conversion of values performed by `RKObjectParameterization` once they have been mapped
+- (RKObjectJSONWriteResult)writeAttributeOfNode:(RKObjectJSONNode *)node ofObject:(id)object objectMapping:(RKObjectMapping *)objectMapping
+{
+    RKPropertyMappingPlan *plan = node.plan;
+    RKPropertyMapping *attributeMapping = plan.propertyMapping;
+    id value = [plan valueForSourceKeyPathOfRepresentation:object];
+    if (value == nil) {
+        if (! objectMapping.assignsDefaultValueForMissingAttributes) return RKObjectJSONWriteResultSkipped;
+        value = [objectMapping defaultValueForAttribute:plan.destinationKeyPath] ?: [NSNull null];
+    } else if (attributeMapping.propertyValueClass) {
+        id transformedValue = nil;
+        if (! [attributeMapping transformValue:value toValue:&transformedValue ofClass:attributeMapping.propertyValueClass error:nil]) return RKObjectJSONWriteResultUnsupported;
+        value = transformedValue;
+    }
+
+    if ([value isKindOfClass:[NSDate class]]) {
+        id transformedValue = nil;
+        [attributeMapping transformValue:value toValue:&transformedValue ofClass:[NSString class] error:nil];
+        value = transformedValue;
+    } else if ([value isKindOfClass:[NSDecimalNumber class]]) {
+        // Precision numbers are serialized as strings to work around Javascript notation limits
+        value = [(NSDecimalNumber *)value stringValue];
+    } else if ([value isKindOfClass:[NSSet class]]) {
+        value = [value allObjects];
+    } else if ([value isKindOfClass:[NSOrderedSet class]]) {
+        value = [value array];
+    } else if (value != [NSNull null] && [node isSourcePropertyBooleanForObject:object]) {
+        if (! [value respondsToSelector:@selector(boolValue)]) return RKObjectJSONWriteResultUnsupported;
+        value = @([value boolValue]);
+    }
+
+    if (! value || ! RKObjectJSONAppendValue(self.data, value)) return RKObjectJSONWriteResultUnsupported;
+    return RKObjectJSONWriteResultWritten;
+}
+
+- (RKObjectJSONWriteResult)writeRelationshipOfNode:(RKObjectJSONNode *)node ofObject:(id)object
+{
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)node.plan.propertyMapping;
+    id value = [node.plan valueForSourceKeyPathOfRepresentation:object];
+    if (value == nil || value == [NSNull null]) return RKObjectJSONWriteResultSkipped;
+
+    if (! RKObjectIsCollection(value)) {
+        RKObjectMapping *objectMapping = [self objectMappingForObject:value withMapping:relationshipMapping.mapping];
+        if (! objectMapping) return RKObjectJSONWriteResultSkipped;
+        return [self writeNestedObject:value withObjectMapping:objectMapping];
+    }
+
+    NSMutableData *data = self.data;
+    [data appendBytes:"[" length:1];
+    BOOL first = YES;
+    for (id nestedObject in value) {
+        if (nestedObject == [NSNull null] || RKObjectIsCollection(nestedObject)) return RKObjectJSONWriteResultUnsupported;
+        RKObjectMapping *objectMapping = [self objectMappingForObject:nestedObject withMapping:relationshipMapping.mapping];
+        if (! objectMapping) continue;
+        if (! first) [data appendBytes:"," length:1];
+        if ([self writeNestedObject:nestedObject withObjectMapping:objectMapping] == RKObjectJSONWriteResultUnsupported) return RKObjectJSONWriteResultUnsupported;
+        first = NO;
+    }
+    [data appendBytes:"]" length:1];
+    return RKObjectJSONWriteResultWritten;
+}
+
+// Nested objects are assigned even when none of their properties were mapped
+- (RKObjectJSONWriteResult)writeNestedObject:(id)object withObjectMapping:(RKObjectMapping *)objectMapping
+{
+    RKObjectJSONWriteResult result = [self writeObject:object withObjectMapping:objectMapping];
+    return (result == RKObjectJSONWriteResultUnsupported) ? result : RKObjectJSONWriteResultWritten;
+}
+
+@end
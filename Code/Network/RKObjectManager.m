@@ -23,6 +23,8 @@
 
 #import "RKObjectManager.h"
 #import "RKObjectParameterization.h"
+#import "RKObjectJSONSerialization.h"
+#import "RKNSJSONSerialization.h"
 #import "RKRequestDescriptor.h"
 #import "RKResponseDescriptor.h"
 #import "RKDictionaryUtilities.h"
@@ -433,15 +435,9 @@ static NSString *RKMIMETypeFromAFHTTPClientParameterEncoding(AFRKHTTPClientParam
 {
     NSMutableURLRequest* request;
     if (parameters && !([method isEqualToString:@"GET"] || [method isEqualToString:@"HEAD"] || [method isEqualToString:@"DELETE"])) {
-        // NOTE: If the HTTP client has been subclasses, then the developer may be trying to perform signing on the request
-        NSDictionary *parametersForClient = [self.HTTPClient isMemberOfClass:[AFRKHTTPClient class]] ? nil : parameters;
-        request = [self.HTTPClient requestWithMethod:method path:path parameters:parametersForClient];
-		
         NSError *error = nil;
-        NSString *charset = (__bridge NSString *)CFStringConvertEncodingToIANACharSetName(CFStringConvertNSStringEncodingToEncoding(self.HTTPClient.stringEncoding));
-        [request setValue:[NSString stringWithFormat:@"%@; charset=%@", self.requestSerializationMIMEType, charset] forHTTPHeaderField:@"Content-Type"];
         NSData *requestBody = [RKMIMETypeSerialization dataFromObject:parameters MIMEType:self.requestSerializationMIMEType error:&error];
-        [request setHTTPBody:requestBody];
+        request = [self requestWithMethod:method path:path parameters:parameters body:requestBody];
 	} else {
         request = [self.HTTPClient requestWithMethod:method path:path parameters:parameters];
     }
@@ -449,6 +445,25 @@ static NSString *RKMIMETypeFromAFHTTPClientParameterEncoding(AFRKHTTPClientParam
 	return request;
 }
 
+/*
+ Builds a request with a serialized body. Shared by `requestWithMethod:path:parameters:` and the direct JSON serialization of objects, so that both produce the same requests.
+ */
+- (NSMutableURLRequest *)requestWithMethod:(NSString *)method path:(NSString *)path parameters:(NSDictionary *)parameters body:(NSData *)requestBody
+{
+    // NOTE: If the HTTP client has been subclasses, then the developer may be trying to perform signing on the request
+    NSDictionary *parametersForClient = [self.HTTPClient isMemberOfClass:[AFRKHTTPClient class]] ? nil : parameters;
+    NSMutableURLRequest *request = [self.HTTPClient requestWithMethod:method path:path parameters:parametersForClient];
+    [self setHTTPBody:requestBody ofRequest:request];
+    return request;
+}
+
+- (void)setHTTPBody:(NSData *)requestBody ofRequest:(NSMutableURLRequest *)request
+{
+    NSString *charset = (__bridge NSString *)CFStringConvertEncodingToIANACharSetName(CFStringConvertNSStringEncodingToEncoding(self.HTTPClient.stringEncoding));
+    [request setValue:[NSString stringWithFormat:@"%@; charset=%@", self.requestSerializationMIMEType, charset] forHTTPHeaderField:@"Content-Type"];
+    [request setHTTPBody:requestBody];
+}
+
 - (NSMutableURLRequest *)requestWithPathForRouteNamed:(NSString *)routeName
                                                object:(id)object
                                            parameters:(NSDictionary *)parameters
@@ -501,12 +516,42 @@ static NSString *RKMIMETypeFromAFHTTPClientParameterEncoding(AFRKHTTPClientParam
     return requestParameters;
 }
 
+// Objects parameterized by a single request descriptor are serialized directly to JSON when no parameters are merged in
+- (NSData *)JSONDataWithObject:(id)object method:(RKRequestMethod)method
+{
+    if (! object || method == RKRequestMethodGET || method == RKRequestMethodDELETE || method == RKRequestMethodHEAD) return nil;
+    if ([RKMIMETypeSerialization serializationClassForMIMEType:self.requestSerializationMIMEType] != [RKNSJSONSerialization class]) return nil;
+    if (! [self.HTTPClient isMemberOfClass:[AFRKHTTPClient class]]) return nil;
+    // Subclasses overriding `requestWithMethod:path:parameters:` to add headers or sign requests must see every request
+    SEL requestSelector = @selector(requestWithMethod:path:parameters:);
+    if ([self methodForSelector:requestSelector] != [RKObjectManager instanceMethodForSelector:requestSelector]) return nil;
+
+    NSArray *objects = [object isKindOfClass:[NSArray class]] ? object : @[ object ];
+    RKRequestDescriptor *requestDescriptor = nil;
+    for (id objectToSerialize in objects) {
+        RKRequestDescriptor *requestDescriptorForObject = RKRequestDescriptorFromArrayMatchingObjectAndRequestMethod(self.requestDescriptors, objectToSerialize, method);
+        if (! requestDescriptorForObject || (requestDescriptor && requestDescriptorForObject != requestDescriptor)) return nil;
+        requestDescriptor = requestDescriptorForObject;
+    }
+    if (! requestDescriptor) return nil;
+
+    NSError *error = nil;
+    NSData *JSONData = [object isKindOfClass:[NSArray class]] ? [RKObjectJSONSerialization JSONDataWithObjects:object requestDescriptor:requestDescriptor error:&error] : [RKObjectJSONSerialization JSONDataWithObject:object requestDescriptor:requestDescriptor error:&error];
+    if (! JSONData) RKLogDebug(@"Failed serializing %@ request body for object '%@' to JSON: %@", RKStringFromRequestMethod(method), object, error);
+    return JSONData;
+}
+
 - (NSMutableURLRequest *)requestWithObject:(id)object
                                     method:(RKRequestMethod)method
                                       path:(NSString *)path
                                 parameters:(NSDictionary *)parameters;
 {
     NSString *requestPath = (path) ? path : [[self.router URLForObject:object method:method] relativeString];
+    NSData *JSONData = parameters ? nil : [self JSONDataWithObject:object method:method];
+    if (JSONData) {
+        return [self requestWithMethod:RKStringFromRequestMethod(method) path:requestPath parameters:nil body:JSONData];
+    }
+
     id requestParameters = [self mergedParametersWithObject:object method:method parameters:parameters];
     return [self requestWithMethod:RKStringFromRequestMethod(method) path:requestPath parameters:requestParameters];
 }
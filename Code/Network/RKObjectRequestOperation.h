@@ -124,6 +124,15 @@ extern NSString * const RKResponseHasBeenMappedCacheUserInfoKey;
  */
 @property (nonatomic, copy) NSDictionary *mappingMetadata;
 
+/**
+ A Boolean value that indicates if JSON response data is streamed into the object mapper rather than being deserialized in full before mapping begins.
+
+ **Default:** `NO`
+
+ @see `[RKResponseMapperOperation streamsResponseData]`
+ */
+@property (nonatomic, assign) BOOL streamsResponseData;
+
 ///----------------------------------
 /// @name Accessing Operation Results
 ///----------------------------------
@@ -458,6 +458,7 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
                                                                         responseDescriptors:self.responseDescriptors];
     self.responseMapperOperation.targetObject = self.targetObject;
     self.responseMapperOperation.mappingMetadata = self.mappingMetadata;
+    self.responseMapperOperation.streamsResponseData = self.streamsResponseData;
     self.responseMapperOperation.mapperDelegate = self;
     [self.responseMapperOperation setQueuePriority:[self queuePriority]];
     [self.responseMapperOperation setWillMapDeserializedResponseBlock:self.willMapDeserializedResponseBlock];
@@ -538,6 +539,7 @@ static NSString *RKStringDescribingURLResponseWithData(NSURLResponse *response,
     RKObjectRequestOperation *operation = [(RKObjectRequestOperation *)[[self class] allocWithZone:zone] initWithHTTPRequestOperation:[self.HTTPRequestOperation copyWithZone:zone] responseDescriptors:self.responseDescriptors];
     operation.targetObject = self.targetObject;
     operation.mappingMetadata = self.mappingMetadata;
+    operation.streamsResponseData = self.streamsResponseData;
     operation.successCallbackQueue = self.successCallbackQueue;
     operation.failureCallbackQueue = self.failureCallbackQueue;
     operation.willMapDeserializedResponseBlock = self.willMapDeserializedResponseBlock;
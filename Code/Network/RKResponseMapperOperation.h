@@ -35,6 +35,7 @@
  
  1. **Handling Empty Responses**: Empty response data (see note below) requires special handling depending on the status code of the HTTP response. If an empty response is loaded with a status code in 4xx (Client Error) range, an `NSError` in the `RKErrorDomain` is created with the `NSURLErrorBadServerResponse` code to indicate that the response was not processable. If an empty response is loaded with a status code in 2xx (Successful) range, the interpretation of the response is dependent on the value of `treatsEmptyResponseAsSuccess`. When `YES`, empty responses result in the successful completion of the operation with an `RKMappingResult` containing the targetObject of the operation, if any.
  1. **Deserializing Response Data**: When started, the operation attempts to deserialize the response data into a Foundation object representation using the `RKMIMETypeSerialization` class. This deserialized representation is then made available to subclass implementations that perform the actual object mapping work.
+ 1. **Streaming Response Data**: When `streamsResponseData` is enabled, arrays within JSON responses are deserialized incrementally as they are mapped rather than up front.
  
  ## How 'Empty' Responses are Evaluated
  
@@ -134,6 +135,17 @@
  */
 @property (nonatomic, assign) BOOL treatsEmptyResponseAsSuccess;
 
+/**
+ A Boolean value that indicates if JSON response data should be streamed into the object mapper rather than being deserialized in full before mapping begins.
+
+ When `YES`, the response data is read with an `RKJSONStreamReader`. Arrays found at the key paths of the matching response descriptors are deserialized one element at a time as they are mapped, so the Foundation representation of the entire response is never held in memory at once. The structure of the response data is validated before mapping begins so that truncated responses are rejected without mapping any objects. If an element is found to be malformed while mapping, the operation fails with the same error as a response that could not be parsed.
+
+ Streaming is only performed for responses with a MIME type that is deserialized by `RKNSJSONSerialization` and when no `willMapDeserializedResponseBlock` has been set, as that block requires the complete deserialized response. If a response descriptor with a `nil` key path matches the response, it must be the only matching descriptor. Otherwise the response is deserialized in full. Note that the `mapperDelegate` is given an `NSEnumerator` in place of each streamed array.
+
+ **Default:** `NO`
+ */
+@property (nonatomic, assign) BOOL streamsResponseData;
+
 /**
  Returns a dictionary of key path to `RKMapping` objects that are applicable to mapping the response. This is determined by evaluating the URL and status codes of the response against the set of `responseDescriptors`.
 
@@ -244,6 +256,28 @@
  */
 @property (nonatomic, copy) NSManagedObjectID *targetObjectID;
 
+///-----------------------------------
+/// @name Mapping in Time Slices
+///-----------------------------------
+
+/**
+ The maximum number of elements of a collection of representations mapped per block performed on the queue of the `managedObjectContext`, or `0` for no limit.
+
+ When the `managedObjectContext` has the `NSMainQueueConcurrencyType` and the operation is not executed on the main thread, setting a limit maps the response in successive slices, each performed with `performBlockAndWait:`, so that the main queue can process events between slices instead of being blocked for the duration of the mapping. The mapping result is identical to that of mapping in a single block. Contexts with the `NSPrivateQueueConcurrencyType` are always mapped in a single block.
+
+ **Default**: `0`
+
+ @see `[RKMapperOperation sliceExecutionBlock]`
+ */
+@property (nonatomic, assign) NSUInteger maximumObjectsPerSlice;
+
+/**
+ The time after which a block mapping a collection of representations on the queue of the `managedObjectContext` is ended, or `0` for no limit. Applies under the same conditions as the `maximumObjectsPerSlice`.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSTimeInterval maximumSliceDuration;
+
 @end
 
 #endif
@@ -26,6 +26,8 @@
 #import "RKResponseMapperOperation.h"
 #import "RKMappingErrors.h"
 #import "RKMIMETypeSerialization.h"
+#import "RKNSJSONSerialization.h"
+#import "RKJSONStreamReader.h"
 #import "RKDictionaryUtilities.h"
 
 #if __has_include("CoreData.h")
@@ -204,6 +206,16 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
     return self;
 }
 
+- (NSError *)parseErrorWithUnderlyingError:(NSError *)underlyingError
+{
+    NSMutableDictionary *userInfo = [NSMutableDictionary dictionary];
+    [userInfo setValue:[NSString stringWithFormat:@"Loaded an unprocessable response (%ld) with content type '%@'", (long) self.response.statusCode, [self.response MIMEType]]
+                forKey:NSLocalizedDescriptionKey];
+    [userInfo setValue:[self.response URL] forKey:NSURLErrorFailingURLErrorKey];
+    [userInfo setValue:underlyingError forKey:NSUnderlyingErrorKey];
+    return [[NSError alloc] initWithDomain:RKErrorDomain code:NSURLErrorCannotParseResponse userInfo:userInfo];
+}
+
 - (id)parseResponseData:(NSError **)error
 {
     NSString *MIMEType = [self.response MIMEType];
@@ -213,20 +225,35 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
         object = [RKMIMETypeSerialization objectFromData:self.data MIMEType:MIMEType error:&underlyingError];
     });    
     if (! object) {
-        NSMutableDictionary *userInfo = [NSMutableDictionary dictionary];
-        [userInfo setValue:[NSString stringWithFormat:@"Loaded an unprocessable response (%ld) with content type '%@'", (long) self.response.statusCode, MIMEType]
-                    forKey:NSLocalizedDescriptionKey];
-        [userInfo setValue:[self.response URL] forKey:NSURLErrorFailingURLErrorKey];
-        [userInfo setValue:underlyingError forKey:NSUnderlyingErrorKey];
-        NSError *HTTPError = [[NSError alloc] initWithDomain:RKErrorDomain code:NSURLErrorCannotParseResponse userInfo:userInfo];
-
-        if (error) *error = HTTPError;
-
+        if (error) *error = [self parseErrorWithUnderlyingError:underlyingError];
         return nil;
     }
     return object;
 }
 
+- (BOOL)shouldStreamResponseData
+{
+    if (! self.streamsResponseData || self.willMapDeserializedResponseBlock) return NO;
+    if ((Class)[RKMIMETypeSerialization serializationClassForMIMEType:[self.response MIMEType]] != [RKNSJSONSerialization class]) return NO;
+
+    // A root mapping consumes the top level value of the response, which cannot be shared with other key paths without deserializing it in full
+    NSDictionary *mappingsDictionary = self.responseMappingsDictionary;
+    return [mappingsDictionary count] > 0 && (mappingsDictionary[[NSNull null]] == nil || [mappingsDictionary count] == 1);
+}
+
+- (id)representationFromStreamReader:(RKJSONStreamReader *)streamReader error:(NSError **)error
+{
+    NSError *underlyingError = nil;
+    id representation = nil;
+    if ([streamReader validateStructure:&underlyingError]) {
+        // Nested key paths are located by the mapper as it searches the reader
+        representation = self.responseMappingsDictionary[[NSNull null]] ? [streamReader valueAtKeyPath:nil] : streamReader;
+        if (! representation) underlyingError = streamReader.error;
+    }
+    if (! representation && error) *error = [self parseErrorWithUnderlyingError:underlyingError];
+    return representation;
+}
+
 - (NSArray *)buildMatchingResponseDescriptors
 {
     NSIndexSet *indexSet = [self.responseDescriptors indexesOfObjectsPassingTest:^BOOL(RKResponseDescriptor *responseDescriptor, NSUInteger idx, BOOL *stop) {
@@ -355,7 +382,8 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
 
     // Parse the response
     NSError *error;
-    id parsedBody = [self parseResponseData:&error];
+    RKJSONStreamReader *streamReader = [self shouldStreamResponseData] ? [[RKJSONStreamReader alloc] initWithData:self.data] : nil;
+    id parsedBody = streamReader ? [self representationFromStreamReader:streamReader error:&error] : [self parseResponseData:&error];
     if (self.isCancelled) return [self willFinish];
     if (! parsedBody) {
         RKLogError(@"Failed to parse response data: %@", [error localizedDescription]);
@@ -379,6 +407,15 @@ static NSMutableDictionary *RKRegisteredResponseMapperOperationDataSourceClasses
 
     // Object map the response
     self.mappingResult = [self performMappingWithObject:parsedBody error:&error];    
+
+    // The elements of a streamed response are only deserialized as they are mapped
+    if (streamReader.error) {
+        RKLogError(@"Failed to parse response data: %@", [streamReader.error localizedDescription]);
+        self.mappingResult = nil;
+        self.error = [self parseErrorWithUnderlyingError:streamReader.error];
+        [self willFinish];
+        return;
+    }
     
     // If the response is a client error return either the mapping error or the mapped result to the caller as the error
     if (isErrorStatusCode) {
@@ -461,14 +498,23 @@ static inline NSManagedObjectID *RKObjectIDFromObjectIfManaged(id object)
     [self.operationQueue cancelAllOperations];
 }
 
+// Mapping is sliced only when it would otherwise block the main queue for its whole duration
+- (BOOL)shouldMapInSlices
+{
+    if (! self.maximumObjectsPerSlice && self.maximumSliceDuration <= 0) return NO;
+    return self.managedObjectContext.concurrencyType == NSMainQueueConcurrencyType && ! [NSThread isMainThread];
+}
+
 - (RKMappingResult *)performMappingWithObject:(id)sourceObject error:(NSError **)error
 {
     NSAssert(self.managedObjectContext, @"Unable to perform mapping: No `managedObjectContext` assigned. (Mapping response.URL = %@)", self.response.URL);
 
     __block NSError *blockError = nil;
     __block RKMappingResult *mappingResult = nil;
+    __block BOOL mapsInSlices = NO;
     self.operationQueue = [NSOperationQueue new];
-    [self.managedObjectContext performBlockAndWait:^{
+    NSManagedObjectContext *managedObjectContext = self.managedObjectContext;
+    [managedObjectContext performBlockAndWait:^{
         // We may have been cancelled before we made it onto the MOC's queue
         if ([self isCancelled]) return;
 
@@ -513,10 +559,28 @@ static inline NSManagedObjectID *RKObjectIDFromObjectIfManaged(id object)
             RKLogInfo(@"Non-successful status code encountered: performing mapping with nil target object.");
         }
 
+        // The mapper performs each slice on the queue of the context from the current thread
+        if ([self shouldMapInSlices]) {
+            self.mapperOperation.sliceExecutionBlock = ^(void (^mappingBlock)(void)) {
+                [managedObjectContext performBlockAndWait:mappingBlock];
+            };
+            self.mapperOperation.maximumObjectsPerSlice = self.maximumObjectsPerSlice;
+            self.mapperOperation.maximumSliceDuration = self.maximumSliceDuration;
+            mapsInSlices = YES;
+            return;
+        }
+
         [self.mapperOperation start];
         blockError = self.mapperOperation.error;
         mappingResult = self.mapperOperation.mappingResult;
     }];
+
+    if (mapsInSlices && ! [self isCancelled]) {
+        RKLogDebug(@"Mapping response in slices of at most %ld objects and %.3f seconds on the main queue", (long) self.maximumObjectsPerSlice, self.maximumSliceDuration);
+        [self.mapperOperation start];
+        blockError = self.mapperOperation.error;
+        mappingResult = self.mapperOperation.mappingResult;
+    }
     
     if (self.isCancelled) return nil;
 
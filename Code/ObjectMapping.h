@@ -27,3 +27,6 @@
 #import "RKMapperOperation.h"
 #import "RKDynamicMapping.h"
 #import "RKErrorMessage.h"
+#import "RKMappingProfiler.h"
+#import "RKMappingChangeSet.h"
+#import "RKGeneratedMapping.h"
@@ -0,0 +1,61 @@
+//
+//  RKCompoundValueTransformer+RKAdditions.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKValueTransformers.h"
+
+/**
+ The `RKAdditions` category on `RKCompoundValueTransformer` allows compound value transformers to be frozen, and lets the transformers resolved from them be memoized against a snapshot of their contents.
+
+ `RKCompoundValueTransformer` is provided by the RKValueTransformers library and is left unmodified: frozen compound value transformers are instances of a private subclass rejecting mutation.
+ */
+@interface RKCompoundValueTransformer (RKAdditions)
+
+/**
+ Returns a Boolean value that indicates if the receiver is frozen. Adding, inserting or removing value transformers from a frozen compound value transformer raises an `NSInternalInconsistencyException`.
+ */
+@property (nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
+/**
+ Returns a frozen copy of the receiver, or the receiver itself if it is already frozen. Copies of a frozen compound value transformer are mutable.
+
+ Frozen mappings replace their compound value transformers with frozen copies, so that the transformers they resolve can no longer change underneath them.
+ */
+- (RKCompoundValueTransformer *)frozenCopy;
+
+@end
+
+/**
+ Returns an array of the value transformers of a compound value transformer, in the order in which they are consulted.
+
+ Objects memoizing the transformers resolved from a compound value transformer record the array at the time of resolution, and discard their memo once `RKCompoundValueTransformerContainsValueTransformers` no longer holds.
+
+ @param compoundValueTransformer The compound value transformer to return the value transformers of.
+ @return An array of the value transformers of the compound value transformer.
+ */
+NSArray *RKValueTransformersOfCompoundValueTransformer(RKCompoundValueTransformer *compoundValueTransformer);
+
+/**
+ Returns a Boolean value that indicates if a compound value transformer contains exactly the given value transformers, compared by identity and in order.
+
+ @param compoundValueTransformer The compound value transformer to compare.
+ @param valueTransformers An array of value transformers, as returned by `RKValueTransformersOfCompoundValueTransformer`.
+ @return `YES` if the compound value transformer contains the same value transformers in the same order, else `NO`.
+ */
+BOOL RKCompoundValueTransformerContainsValueTransformers(RKCompoundValueTransformer *compoundValueTransformer, NSArray *valueTransformers);
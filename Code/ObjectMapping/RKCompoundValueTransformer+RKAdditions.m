@@ -0,0 +1,96 @@
+//
+//  RKCompoundValueTransformer+RKAdditions.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKCompoundValueTransformer+RKAdditions.h"
+#import "RKMapping_Private.h"
+
+/**
+ A compound value transformer rejecting mutation once frozen. Instances are only created by `frozenCopy`, which adds the value transformers of the original before freezing the copy.
+ */
+@interface RKFrozenCompoundValueTransformer : RKCompoundValueTransformer
+@property (nonatomic, assign, getter=isFrozen) BOOL frozen;
+@end
+
+@implementation RKFrozenCompoundValueTransformer
+
+@synthesize frozen = _frozen;
+
+- (void)addValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    RKRaiseIfFrozen();
+    [super addValueTransformer:valueTransformer];
+}
+
+- (void)removeValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    RKRaiseIfFrozen();
+    [super removeValueTransformer:valueTransformer];
+}
+
+- (void)insertValueTransformer:(id<RKValueTransforming>)valueTransformer atIndex:(NSUInteger)index
+{
+    RKRaiseIfFrozen();
+    [super insertValueTransformer:valueTransformer atIndex:index];
+}
+
+- (id)copyWithZone:(NSZone *)zone
+{
+    RKCompoundValueTransformer *copy = [[RKCompoundValueTransformer allocWithZone:zone] init];
+    for (id<RKValueTransforming> valueTransformer in self) [copy addValueTransformer:valueTransformer];
+    return copy;
+}
+
+@end
+
+@implementation RKCompoundValueTransformer (RKAdditions)
+
+- (BOOL)isFrozen
+{
+    return NO;
+}
+
+- (RKCompoundValueTransformer *)frozenCopy
+{
+    if ([self isFrozen]) return self;
+    RKFrozenCompoundValueTransformer *frozenCopy = [RKFrozenCompoundValueTransformer new];
+    for (id<RKValueTransforming> valueTransformer in self) [frozenCopy addValueTransformer:valueTransformer];
+    frozenCopy.frozen = YES;
+    return frozenCopy;
+}
+
+@end
+
+NSArray *RKValueTransformersOfCompoundValueTransformer(RKCompoundValueTransformer *compoundValueTransformer)
+{
+    NSMutableArray *valueTransformers = [NSMutableArray arrayWithCapacity:[compoundValueTransformer numberOfValueTransformers]];
+    for (id<RKValueTransforming> valueTransformer in compoundValueTransformer) [valueTransformers addObject:valueTransformer];
+    return valueTransformers;
+}
+
+BOOL RKCompoundValueTransformerContainsValueTransformers(RKCompoundValueTransformer *compoundValueTransformer, NSArray *valueTransformers)
+{
+    NSUInteger count = [valueTransformers count];
+    if ([compoundValueTransformer numberOfValueTransformers] != count) return NO;
+    NSUInteger index = 0;
+    for (id<RKValueTransforming> valueTransformer in compoundValueTransformer) {
+        if (index >= count || valueTransformer != valueTransformers[index++]) return NO;
+    }
+    return YES;
+}
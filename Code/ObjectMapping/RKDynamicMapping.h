@@ -64,6 +64,8 @@
 /**
  Sets a block to be invoked to determine the appropriate concrete object mapping with which to map an object representation.
 
+ Once the receiver has been frozen, the object mappings returned by the block are frozen before they are used. If the receiver is shared across threads, the block must be safe to invoke concurrently.
+
  @param block The block object to invoke to select the object mapping with which to map the given object representation. The block returns an object mapping and accepts a single parameter: the object representation being mapped.
  */
 - (void)setObjectMappingForRepresentationBlock:(RKObjectMapping *(^)(id representation))block;
@@ -21,15 +21,103 @@
 #import "RKDynamicMapping.h"
 #import "RKObjectMappingMatcher.h"
 #import "RKLog.h"
+#import "RKMapping_Private.h"
 
 // Set Logging Component
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitObjectMapping
 
+// Duplicating interface from `RKObjectMappingMatcher.m`
+@interface RKObjectMappingMatcher (Indexing)
+- (NSString *)indexedKeyPath;
+- (NSDictionary *)objectMappingsByIndexedValue;
+@end
+
+/**
+ A run of consecutive matchers that select an object mapping by looking up the value at a key path. Each key path is read from the representation once and the first matcher in registration order that would have matched wins.
+ */
+@interface RKDynamicMappingValueIndex : NSObject
+- (void)addMatcher:(RKObjectMappingMatcher *)matcher order:(NSUInteger)order;
+- (RKObjectMapping *)objectMappingForRepresentation:(id)representation;
+@end
+
+@implementation RKDynamicMappingValueIndex {
+    NSMutableArray *_keyPaths;
+    NSMutableDictionary *_mappingsByValueByKeyPath; // key path => value => RKObjectMapping
+    NSMutableDictionary *_ordersByValueByKeyPath; // key path => value => registration order of the matcher
+}
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        _keyPaths = [NSMutableArray array];
+        _mappingsByValueByKeyPath = [NSMutableDictionary dictionary];
+        _ordersByValueByKeyPath = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (void)addMatcher:(RKObjectMappingMatcher *)matcher order:(NSUInteger)order
+{
+    NSString *keyPath = [matcher indexedKeyPath];
+    NSMutableDictionary *mappingsByValue = _mappingsByValueByKeyPath[keyPath];
+    NSMutableDictionary *ordersByValue = _ordersByValueByKeyPath[keyPath];
+    if (! mappingsByValue) {
+        [_keyPaths addObject:keyPath];
+        mappingsByValue = [NSMutableDictionary dictionary];
+        ordersByValue = [NSMutableDictionary dictionary];
+        _mappingsByValueByKeyPath[keyPath] = mappingsByValue;
+        _ordersByValueByKeyPath[keyPath] = ordersByValue;
+    }
+    [[matcher objectMappingsByIndexedValue] enumerateKeysAndObjectsUsingBlock:^(id value, RKObjectMapping *objectMapping, BOOL *stop) {
+        // An earlier matcher for the same value takes precedence
+        if (mappingsByValue[value]) return;
+        mappingsByValue[value] = objectMapping;
+        ordersByValue[value] = @(order);
+    }];
+}
+
+- (void)freezeReachableMappings
+{
+    [self matchersCompiledIntoValueIndexes];
+    [self.possibleObjectMappings makeObjectsPerformSelector:@selector(freeze)];
+}
+
+- (RKObjectMapping *)objectMappingForRepresentation:(id)representation
+{
+    if ([_keyPaths count] == 1) {
+        NSString *keyPath = _keyPaths[0];
+        id value = [representation valueForKeyPath:keyPath];
+        return value ? _mappingsByValueByKeyPath[keyPath][value] : nil;
+    }
+
+    RKObjectMapping *objectMapping = nil;
+    NSUInteger objectMappingOrder = NSNotFound;
+    for (NSString *keyPath in _keyPaths) {
+        id value = [representation valueForKeyPath:keyPath];
+        if (! value) continue;
+        NSNumber *order = _ordersByValueByKeyPath[keyPath][value];
+        if (order && [order unsignedIntegerValue] < objectMappingOrder) {
+            objectMappingOrder = [order unsignedIntegerValue];
+            objectMapping = _mappingsByValueByKeyPath[keyPath][value];
+        }
+    }
+    return objectMapping;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p mappingsByValueByKeyPath=%@>", NSStringFromClass([self class]), self, _mappingsByValueByKeyPath];
+}
+
+@end
+
 @interface RKDynamicMapping ()
 @property (nonatomic, strong) NSMutableArray *mutableMatchers;
 @property (nonatomic, strong) NSArray *possibleObjectMappings;
 @property (nonatomic, copy) RKObjectMapping *(^objectMappingForRepresentationBlock)(id representation);
+@property (atomic, strong) NSArray *compiledMatchers;
 @end
 
 @implementation RKDynamicMapping
@@ -55,9 +143,17 @@
     return self.possibleObjectMappings;
 }
 
+- (void)setObjectMappingForRepresentationBlock:(RKObjectMapping *(^)(id representation))block
+{
+    RKRaiseIfFrozen();
+    _objectMappingForRepresentationBlock = [block copy];
+}
+
 - (void)addMatcher:(RKObjectMappingMatcher *)matcher
 {
     NSParameterAssert(matcher);
+    RKRaiseIfFrozen();
+    self.compiledMatchers = nil;
     if ([self.mutableMatchers containsObject:matcher]) {
         [self.mutableMatchers removeObject:matcher];
         [self.mutableMatchers insertObject:matcher atIndex:0];
@@ -74,8 +170,10 @@
 - (void)removeMatcher:(RKObjectMappingMatcher *)matcher
 {
     NSParameterAssert(matcher);
+    RKRaiseIfFrozen();
 
     if ([self.mutableMatchers containsObject:matcher]) {
+        self.compiledMatchers = nil;
         NSMutableArray *mappings = [self.possibleObjectMappings mutableCopy];
         for (RKObjectMapping *mapping in [matcher possibleObjectMappings]) {
             /* removeObject will remove *all* instances; if we have dups we just want to remove one */
@@ -88,6 +186,32 @@
     }
 }
 
+// Collapses runs of consecutive key path value matchers into hash indexes. Other matchers are retained in place, preserving the registration order of evaluation.
+- (NSArray *)matchersCompiledIntoValueIndexes
+{
+    NSArray *compiledMatchers = self.compiledMatchers;
+    if (compiledMatchers) return compiledMatchers;
+
+    NSMutableArray *stages = [NSMutableArray arrayWithCapacity:[self.mutableMatchers count]];
+    RKDynamicMappingValueIndex *valueIndex = nil;
+    NSUInteger order = 0;
+    for (RKObjectMappingMatcher *matcher in self.mutableMatchers) {
+        if ([matcher indexedKeyPath]) {
+            if (! valueIndex) {
+                valueIndex = [RKDynamicMappingValueIndex new];
+                [stages addObject:valueIndex];
+            }
+            [valueIndex addMatcher:matcher order:order];
+        } else {
+            valueIndex = nil;
+            [stages addObject:matcher];
+        }
+        order++;
+    }
+    self.compiledMatchers = stages;
+    return stages;
+}
+
 - (RKObjectMapping *)objectMappingForRepresentation:(id)representation
 {
     RKObjectMapping *mapping = nil;
@@ -95,16 +219,24 @@
     RKLogTrace(@"Performing dynamic object mapping for object representation: %@", representation);
 
     // Consult the declarative matchers first
-    for (RKObjectMappingMatcher *matcher in self.mutableMatchers) {
-        if ([matcher matches:representation]) {
-            RKLogTrace(@"Found declarative match for matcher: %@.", matcher);
-            return matcher.objectMapping;
+    for (id stage in [self matchersCompiledIntoValueIndexes]) {
+        if ([stage isKindOfClass:[RKDynamicMappingValueIndex class]]) {
+            mapping = [(RKDynamicMappingValueIndex *)stage objectMappingForRepresentation:representation];
+            if (mapping) {
+                RKLogTrace(@"Found declarative match in value index: %@.", stage);
+                return mapping;
+            }
+        } else if ([(RKObjectMappingMatcher *)stage matches:representation]) {
+            RKLogTrace(@"Found declarative match for matcher: %@.", stage);
+            return [(RKObjectMappingMatcher *)stage objectMapping];
         }
     }
 
     // Otherwise consult the block
     if (self.objectMappingForRepresentationBlock) {
         mapping = self.objectMappingForRepresentationBlock(representation);
+        // The mappings returned by the block are not reachable when the receiver is frozen, so they are frozen as they are selected
+        if (mapping && self.isFrozen) [mapping freeze];
         if (mapping) RKLogTrace(@"Determined concrete `RKObjectMapping` using object mapping for representation block");
     }
 
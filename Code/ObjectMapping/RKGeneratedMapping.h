@@ -0,0 +1,107 @@
+//
+//  RKGeneratedMapping.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RKMappingOperation, RKObjectMappingPlan, RKPropertyMappingPlan;
+
+/**
+ A generated mapping function applies the single key attribute mappings of an object mapping (the `keyAttributePlans` of its execution plan) to a destination object, in place of the generic implementation of `RKMappingOperation`.
+
+ Generated mapping functions are emitted by `RKMappingCodeGenerator` and registered with `RKRegisterGeneratedMappingFunction` under the signature of the mapping they were generated from. When an object mapping is compiled, the function registered for its signature (if any) is retained by the execution plan and invoked by `RKMappingOperation` whenever the representation being mapped is a dictionary and no delegate of the operation observes individual values. Generated functions read the values of the representation by their hard-coded keys and invoke the accessors of the destination class directly. Attributes that cannot be assigned directly are handed back to the mapping operation via `RKGeneratedMappingApplyAttribute` or `RKGeneratedMappingApplyAttributeValue`.
+
+ @param operation The mapping operation applying the attribute mappings.
+ @param representation The dictionary representation being mapped.
+ @param destinationObject The object the representation is being mapped to.
+ @param appliedMappings Upon return, `YES` if any attribute mapping was applied.
+ @return `YES` if the function applied the attribute mappings, or `NO` if it declined to do so without modifying the destination object, in which case the mapping operation applies them itself.
+ */
+typedef BOOL (*RKGeneratedMappingFunction)(RKMappingOperation *operation, NSDictionary *representation, id destinationObject, BOOL *appliedMappings);
+
+///-----------------------------------------
+/// @name Registering Generated Mappings
+///-----------------------------------------
+
+/**
+ Returns the signature identifying the single key attribute mappings of the given execution plan.
+
+ The signature describes the target class of the plan and, in order, the source and destination key paths, the destination class and the kind of value transformation of every single key attribute mapping. A generated function is only used for a plan whose signature is identical to that of the mapping it was generated from, so modifying a mapping in a way that invalidates the generated code causes the mapping operation to fall back to its generic implementation. Note that changes made to the value transformers of a mapping after it has been compiled are not reflected in its signature.
+
+ @param plan The execution plan of an object mapping.
+ @return The signature of the plan, or `nil` if the plan has no target class.
+ */
+NSString *RKGeneratedMappingSignatureForPlan(RKObjectMappingPlan *plan);
+
+/**
+ Returns a Boolean value that indicates if values of the destination class of the given attribute plan are assigned as is, rather than being transformed by the value transformer of the property mapping.
+
+ This is the case when the property mapping does not specify a `propertyValueClass` and the first transformer of its compound value transformer able to transform the destination class into itself is the identity value transformer.
+
+ @param plan The plan of an attribute mapping.
+ @return `YES` if values of the destination class are mapped without transformation.
+ */
+BOOL RKPropertyMappingPlanUsesIdentityTransformation(RKPropertyMappingPlan *plan);
+
+/**
+ Registers a generated mapping function for the given signature, replacing any previously registered function.
+
+ Functions must be registered before the object mappings they apply to are compiled. Generated source files register their functions from a constructor function, before `main` is invoked.
+
+ @param signature The signature of the mapping the function was generated from, as returned by `RKGeneratedMappingSignatureForPlan`.
+ @param function The function to register, or `NULL` to remove the registered function.
+ */
+void RKRegisterGeneratedMappingFunction(NSString *signature, RKGeneratedMappingFunction function);
+
+/**
+ Returns the generated mapping function registered for the given signature.
+
+ @param signature The signature of a mapping.
+ @return The registered function, or `NULL` if none has been registered.
+ */
+RKGeneratedMappingFunction RKGeneratedMappingFunctionForSignature(NSString *signature);
+
+///-----------------------------------------
+/// @name Support for Generated Code
+///-----------------------------------------
+
+/**
+ Returns a Boolean value that indicates if the given operation sets values that are equal to the current values of the destination object.
+ */
+BOOL RKGeneratedMappingShouldSetUnchangedValues(RKMappingOperation *operation);
+
+/**
+ Validates a value for the given key of the destination object of the operation, if the object mapping of the operation performs key-value validation. The error of the operation is set if validation fails.
+ */
+BOOL RKGeneratedMappingValidateValue(RKMappingOperation *operation, id *value, NSString *key);
+
+/**
+ Records that the attribute mapping at the given index of the `keyAttributePlans` of the operation has been applied.
+ */
+void RKGeneratedMappingDidMapAttribute(RKMappingOperation *operation, NSUInteger index);
+
+/**
+ Applies the attribute mapping at the given index of the `keyAttributePlans` of the operation with the generic implementation, reading the value from the source object of the operation. Returns `YES` if a value was mapped.
+ */
+BOOL RKGeneratedMappingApplyAttribute(RKMappingOperation *operation, NSUInteger index);
+
+/**
+ Applies the attribute mapping at the given index of the `keyAttributePlans` of the operation with the generic implementation, using a value already read from the representation. Returns `YES` if the value was mapped.
+ */
+BOOL RKGeneratedMappingApplyAttributeValue(RKMappingOperation *operation, NSUInteger index, id value);
@@ -0,0 +1,82 @@
+//
+//  RKGeneratedMapping.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKGeneratedMapping.h"
+#import "RKObjectMappingPlan.h"
+#import "RKPropertyMapping.h"
+#import "RKValueTransformers.h"
+
+static NSMutableDictionary *RKGeneratedMappingFunctions(void)
+{
+    static NSMutableDictionary *functions = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        functions = [NSMutableDictionary new];
+    });
+    return functions;
+}
+
+BOOL RKPropertyMappingPlanUsesIdentityTransformation(RKPropertyMappingPlan *plan)
+{
+    Class destinationClass = plan.destinationClass;
+    RKPropertyMapping *propertyMapping = plan.propertyMapping;
+    if (! destinationClass || propertyMapping.propertyValueClass) return NO;
+
+    id<RKValueTransforming> valueTransformer = propertyMapping.valueTransformer;
+    if (! [valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) return NO;
+    NSArray *valueTransformers = [(RKCompoundValueTransformer *)valueTransformer valueTransformersForTransformingFromClass:destinationClass toClass:destinationClass];
+    return [valueTransformers firstObject] == [RKValueTransformer identityValueTransformer];
+}
+
+NSString *RKGeneratedMappingSignatureForPlan(RKObjectMappingPlan *plan)
+{
+    Class objectClass = plan.objectClass;
+    if (! objectClass) return nil;
+
+    NSMutableString *signature = [NSStringFromClass(objectClass) mutableCopy];
+    for (RKPropertyMappingPlan *attributePlan in plan.keyAttributePlans) {
+        NSString *transformation = attributePlan.isNestingAttribute ? @"-" : (RKPropertyMappingPlanUsesIdentityTransformation(attributePlan) ? @"i" : @"t");
+        NSString *destinationClassName = NSStringFromClass(attributePlan.propertyMapping.propertyValueClass ?: attributePlan.destinationClass) ?: @"";
+        [signature appendFormat:@"|%@>%@:%@=%@", attributePlan.sourceKeyPath ?: @"", attributePlan.destinationKeyPath ?: @"", destinationClassName, transformation];
+    }
+    return signature;
+}
+
+void RKRegisterGeneratedMappingFunction(NSString *signature, RKGeneratedMappingFunction function)
+{
+    NSCParameterAssert(signature);
+    NSMutableDictionary *functions = RKGeneratedMappingFunctions();
+    @synchronized(functions) {
+        if (function) {
+            functions[signature] = [NSValue valueWithPointer:(const void *)function];
+        } else {
+            [functions removeObjectForKey:signature];
+        }
+    }
+}
+
+RKGeneratedMappingFunction RKGeneratedMappingFunctionForSignature(NSString *signature)
+{
+    if (! signature) return NULL;
+    NSMutableDictionary *functions = RKGeneratedMappingFunctions();
+    @synchronized(functions) {
+        return (RKGeneratedMappingFunction)[functions[signature] pointerValue];
+    }
+}
@@ -55,6 +55,10 @@
  
  Note that it is possible to map the same representation with multiple mappings, including a combination of a root key mapping and nested keypaths.
 
+ ### Mapping Streamed Representations
+
+ A collection of representations may also be given as an `NSEnumerator`, either as the `representation` itself or as the value at a key path of the `representation`. Each object produced by the enumerator is mapped as an element of the collection and released once it has been mapped, so that representations read incrementally (such as by an `RKJSONStreamReader`) need never be held in memory all at once. Collections given as enumerators are always mapped serially.
+
  ## Data Source
 
  The data source is used to instantiate new objects or find existing objects to be updated during the mapping process. The object set as the `mappingOperationDataSource` will be set as the `dataSource` for the `RKMappingOperation` objects created by the mapper.
@@ -150,6 +154,83 @@
  */
 @property (nonatomic, copy) NSDictionary *metadata;
 
+/**
+ The profiler assigned to every mapping operation started by the receiver, or `nil` if the mapping is not profiled.
+
+ The stacks recorded by the profiler are rooted at the key paths of the `mappingsDictionary`. **Default**: `nil`
+
+ @see `RKMappingProfiler`
+ */
+@property (nonatomic, strong) RKMappingProfiler *profiler;
+
+/**
+ A Boolean value that determines if the receiver collects the objects inserted, updated and left unchanged by the mapping into the `changeSet` of the `mappingResult`.
+
+ The change set is built from the decisions taken by the mapping operations as they map, so it allows consumers of the mapping result to find the objects that need to be refreshed without comparing the result to their previous state. Objects whose mapping operation failed are not included in the change set. Mapping operations that record changes do not use generated mapping functions. When collections or key paths are mapped concurrently, the change set lists objects in the same order as when they are mapped serially.
+
+ **Default**: `NO`
+
+ @see `RKMappingChangeSet`
+ */
+@property (nonatomic, assign) BOOL collectsChangeSet;
+
+///--------------------------------
+/// @name Configuring Concurrency
+///--------------------------------
+
+/**
+ A Boolean value that determines if the receiver maps the elements of large collections of object representations concurrently.
+
+ When `YES`, collections found in the `representation` are split into contiguous ranges that are mapped in parallel on the global concurrent dispatch queue. The mapped objects are returned in the same order as the source collection, the `@metadata.mapping.collectionIndex` of each element is unchanged, and errors and mapping info are merged in collection order, so the outcome is identical to serial mapping.
+
+ Concurrent mapping is only performed when it is known to be safe: the mapping for the key path must be a plain `RKObjectMapping`, the `mappingOperationDataSource` must be an `RKObjectMappingOperationDataSource`, no `targetObject` may be configured and the delegate must not implement `mapper:willStartMappingOperation:forKeyPath:`. In all other cases the collection is mapped serially. When a collection is mapped concurrently, the `mapper:didFinishMappingOperation:forKeyPath:` and `mapper:didFailMappingOperation:forKeyPath:withError:` delegate messages are sent on the thread executing the receiver, in collection order, once the entire collection has been mapped.
+
+ **Default**: `NO`
+
+ @warning The value transformers and property accessors invoked while mapping the collection must be safe to execute concurrently.
+ */
+@property (nonatomic, assign) BOOL mapsCollectionsConcurrently;
+
+/**
+ A Boolean value that determines if the receiver maps the representations found at different key paths of the `mappingsDictionary` concurrently.
+
+ When `YES` and more than one key path of the `mappingsDictionary` matches content in the `representation`, the representations are located serially (sending the key path search delegate messages in order) and then mapped in parallel on the global concurrent dispatch queue. The results are assembled into a single `mappingResult`, and errors and mapping info are merged in the order in which the key paths were searched.
+
+ Key paths are only mapped concurrently when the mapped objects cannot share state: every mapping in the `mappingsDictionary` must be a plain `RKObjectMapping`, the `mappingOperationDataSource` must be an `RKObjectMappingOperationDataSource`, no `targetObject` may be configured and the delegate must not implement any of the child mapping operation status messages. In all other cases the key paths are mapped serially.
+
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL mapsKeyPathsConcurrently;
+
+///----------------------------------
+/// @name Mapping in Time Slices
+///----------------------------------
+
+/**
+ A block that executes a slice of the mapping work, or `nil` if the receiver maps all of its content at once.
+
+ When set, the receiver performs all work that accesses the mapped objects in slices, by passing a block that performs a slice of the work to `sliceExecutionBlock`, which must execute it synchronously. A collection of representations is split into successive slices bounded by the `maximumObjectsPerSlice` and `maximumSliceDuration`, and each representation mapped outside of a collection is mapped in a slice of its own. The delegate is informed of the start and the end of the mapping in slices of their own. Locating the representations in the `representation` and assembling the `mappingResult` is done on the thread executing the receiver, between slices.
+
+ Slicing allows the mapping to share the queue of a managed object context with other work, by performing each slice with `performBlockAndWait:` from a background thread: the queue of the context is free to process other blocks between slices. The mapping result is identical to that of mapping without slices. Collections are never mapped concurrently while the slice execution block is set.
+
+ **Default**: `nil`
+ */
+@property (nonatomic, copy) void (^sliceExecutionBlock)(void (^mappingBlock)(void));
+
+/**
+ The maximum number of elements of a collection of representations mapped in a single slice, or `0` for no limit.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger maximumObjectsPerSlice;
+
+/**
+ The time after which a slice mapping a collection of representations is ended, or `0` for no limit. At least one element is mapped in each slice, and the time taken by the element being mapped when the limit is reached is not bounded.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSTimeInterval maximumSliceDuration;
+
 ///------------------------------
 /// @name Executing the Operation
 ///------------------------------
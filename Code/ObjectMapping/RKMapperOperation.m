@@ -26,9 +26,13 @@
 #import "RKDynamicMapping.h"
 #import "RKLog.h"
 #import "RKDictionaryUtilities.h"
+#import "RKMappingChangeSet.h"
 
 NSString * const RKMappingErrorKeyPathErrorKey = @"keyPath";
 
+// The minimum number of representations in a collection for concurrent mapping to be worthwhile
+static NSUInteger const RKMapperOperationConcurrentMappingThreshold = 64;
+
 // Set Logging Component
 #undef RKLogComponent
 #define RKLogComponent RKlcl_cRestKitObjectMapping
@@ -57,6 +61,7 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 
 @interface RKMappingOperation (Private)
 @property (nonatomic, readwrite, getter=isNewDestinationObject) BOOL newDestinationObject;
+@property (nonatomic, copy) NSString *profilerKeyPath;
 @end
 
 @interface RKMapperMetadata : NSObject
@@ -76,6 +81,11 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 @property (nonatomic, strong) id representation;
 @property (nonatomic, strong, readwrite) NSDictionary *mappingsDictionary;
 @property (nonatomic, strong) NSMutableDictionary *mutableMappingInfo;
+@property (nonatomic, strong) RKMappingOperation *reusableMappingOperation;
+@property (nonatomic, strong) RKMappingChangeSet *changeSet;
+
+- (RKMappingOperation *)startMappingOperationForRepresentation:(id)mappableObject toObject:(id)destinationObject isNew:(BOOL)newDestination atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadataList:(NSArray *)metadataList;
+- (BOOL)finishMappingOperation:(RKMappingOperation *)mappingOperation atKeyPath:(NSString *)keyPath;
 @end
 
 @implementation RKMapperOperation
@@ -213,6 +223,10 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     NSAssert(representations != nil, @"Cannot map without an collection of mappable objects");
     NSAssert(mapping != nil, @"Cannot map without a mapping to consult");
 
+    if ([representations isKindOfClass:[NSEnumerator class]]) {
+        return [self mapRepresentationsFromEnumerator:representations atKeyPath:keyPath usingMapping:mapping];
+    }
+
     NSArray *objectsToMap = representations;
     if (mapping.forceCollectionMapping) {
         // If we have forced mapping of a dictionary, map each subdictionary
@@ -227,7 +241,15 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
             RKLogWarning(@"Collection mapping forced but representations is of type '%@' rather than NSDictionary", NSStringFromClass([representations class]));
         }
     }
-    
+
+    if (self.sliceExecutionBlock) {
+        return [self mapRepresentationsFromEnumerator:[objectsToMap objectEnumerator] atKeyPath:keyPath usingMapping:mapping];
+    }
+
+    if ([self shouldMapRepresentationsConcurrently:objectsToMap usingMapping:mapping]) {
+        return [self mapRepresentationsConcurrently:objectsToMap atKeyPath:keyPath usingMapping:(RKObjectMapping *)mapping];
+    }
+
     RKMapperMetadata *mappingData = [RKMapperMetadata new];
     mappingData.rootKeyPath = keyPath;
     NSDictionary *metadata = @{ @"mapping": mappingData };
@@ -248,6 +270,123 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     return mappedObjects;
 }
 
+// Maps representations as they are produced by an enumerator, discarding each representation once it has been mapped. When mapping in time slices, the representations are mapped in successive slices of bounded size and duration
+- (NSArray *)mapRepresentationsFromEnumerator:(NSEnumerator *)enumerator atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping
+{
+    RKMapperMetadata *mappingData = [RKMapperMetadata new];
+    mappingData.rootKeyPath = keyPath;
+    NSArray *metadataList = [NSArray arrayWithObjects:@{ @"mapping": mappingData }, self.metadata, nil];
+    NSMutableArray *mappedObjects = [NSMutableArray array];
+    BOOL mapsInSlices = (self.sliceExecutionBlock != nil);
+    NSUInteger maximumObjectsPerSlice = mapsInSlices ? self.maximumObjectsPerSlice : 0;
+    NSTimeInterval maximumSliceDuration = mapsInSlices ? self.maximumSliceDuration : 0;
+    __block NSUInteger index = 0;
+    __block BOOL finished = NO;
+    while (! finished && ! [self isCancelled]) {
+        [self performSlice:^{
+            CFAbsoluteTime sliceStartTime = CFAbsoluteTimeGetCurrent();
+            NSUInteger sliceCount = 0;
+            while (! [self isCancelled]) {
+                if (sliceCount > 0 && ((maximumObjectsPerSlice && sliceCount >= maximumObjectsPerSlice) ||
+                                       (maximumSliceDuration > 0 && CFAbsoluteTimeGetCurrent() - sliceStartTime >= maximumSliceDuration))) break;
+                @autoreleasepool {
+                    id mappableObject = [enumerator nextObject];
+                    if (! mappableObject) {
+                        finished = YES;
+                        break;
+                    }
+                    if (mappableObject != [NSNull null]) {
+                        id destinationObject = [self objectForRepresentation:mappableObject withMapping:mapping];
+                        if (destinationObject) {
+                            mappingData.collectionIndex = index;
+                            BOOL success = [self mapRepresentation:mappableObject toObject:destinationObject isNew:YES atKeyPath:keyPath usingMapping:mapping metadataList:metadataList];
+                            if (success) [mappedObjects addObject:destinationObject];
+                        }
+                    }
+                    index++;
+                    sliceCount++;
+                }
+            }
+        }];
+    }
+
+    return mappedObjects;
+}
+
+// Executes a block accessing the mapped objects, in a slice of its own if the receiver maps in time slices
+- (void)performSlice:(void (^)(void))block
+{
+    void (^sliceExecutionBlock)(void (^)(void)) = self.sliceExecutionBlock;
+    if (sliceExecutionBlock) {
+        sliceExecutionBlock(block);
+    } else {
+        block();
+    }
+}
+
+- (BOOL)shouldMapRepresentationsConcurrently:(id)representations usingMapping:(RKMapping *)mapping
+{
+    if (! self.mapsCollectionsConcurrently) return NO;
+    if (! [representations isKindOfClass:[NSArray class]] || [representations count] < RKMapperOperationConcurrentMappingThreshold) return NO;
+
+    // Concurrency is restricted to transient objects created by the stateless object data source
+    if (! [mapping isMemberOfClass:[RKObjectMapping class]]) return NO;
+    if (! [self.mappingOperationDataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]]) return NO;
+    if (self.targetObject) return NO;
+
+    // The delegate must be informed before each operation starts, which cannot be done in order from multiple threads
+    if ([self.delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)]) return NO;
+
+    return YES;
+}
+
+// Maps contiguous ranges of the collection in parallel, then merges the results in collection order
+- (NSArray *)mapRepresentationsConcurrently:(NSArray *)representations atKeyPath:(NSString *)keyPath usingMapping:(RKObjectMapping *)mapping
+{
+    NSUInteger count = [representations count];
+    NSUInteger chunkCount = MIN(count, [[NSProcessInfo processInfo] activeProcessorCount] * 4);
+    NSUInteger chunkSize = (count + chunkCount - 1) / chunkCount;
+    RKLogDebug(@"Mapping collection of %ld representations at keyPath '%@' concurrently in %ld chunks", (long) count, keyPath, (long) chunkCount);
+
+    // Compile the mapping graph up front so that the execution plans are not built redundantly on each thread
+    [mapping compile];
+
+    NSMutableArray *operationsByChunk = [NSMutableArray arrayWithCapacity:chunkCount];
+    for (NSUInteger chunk = 0; chunk < chunkCount; chunk++) {
+        [operationsByChunk addObject:[NSMutableArray arrayWithCapacity:chunkSize]];
+    }
+    NSDictionary *metadata = self.metadata;
+    dispatch_apply(chunkCount, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t chunk) {
+        NSMutableArray *operations = operationsByChunk[chunk];
+        RKMapperMetadata *mappingData = [RKMapperMetadata new];
+        mappingData.rootKeyPath = keyPath;
+        NSArray *metadataList = [NSArray arrayWithObjects:@{ @"mapping": mappingData }, metadata, nil];
+        NSUInteger endIndex = MIN((chunk + 1) * chunkSize, count);
+        for (NSUInteger index = chunk * chunkSize; index < endIndex; index++) {
+            if ([self isCancelled]) return;
+            @autoreleasepool {
+                id mappableObject = representations[index];
+                if (mappableObject == [NSNull null]) continue;
+
+                id destinationObject = [self objectForRepresentation:mappableObject withMapping:mapping];
+                if (! destinationObject) continue;
+                mappingData.collectionIndex = index;
+                RKMappingOperation *mappingOperation = [self startMappingOperationForRepresentation:mappableObject toObject:destinationObject isNew:YES atKeyPath:keyPath usingMapping:mapping metadataList:metadataList];
+                [operations addObject:mappingOperation];
+            }
+        }
+    });
+
+    NSMutableArray *mappedObjects = [NSMutableArray arrayWithCapacity:count];
+    for (NSArray *operations in operationsByChunk) {
+        for (RKMappingOperation *mappingOperation in operations) {
+            if ([self finishMappingOperation:mappingOperation atKeyPath:keyPath]) [mappedObjects addObject:mappingOperation.destinationObject];
+        }
+    }
+
+    return mappedObjects;
+}
+
 // The workhorse of this entire process. Emits object loading operations
 - (BOOL)mapRepresentation:(id)mappableObject toObject:(id)destinationObject isNew:(BOOL)newDestination atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadataList:(NSArray *)metadataList
 {
@@ -257,13 +396,61 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 
     RKLogDebug(@"Asked to map source object %@ with mapping %@", mappableObject, mapping);
 
+    if (! [self canReuseMappingOperations]) {
+        self.reusableMappingOperation = nil;
+        RKMappingOperation *mappingOperation = [self startMappingOperationForRepresentation:mappableObject toObject:destinationObject isNew:newDestination atKeyPath:keyPath usingMapping:mapping metadataList:metadataList];
+        return [self finishMappingOperation:mappingOperation atKeyPath:keyPath];
+    }
+
+    RKMappingOperation *mappingOperation = self.reusableMappingOperation;
+    if (mappingOperation) {
+        [mappingOperation prepareForReuseWithSourceObject:mappableObject destinationObject:destinationObject mapping:mapping metadataList:metadataList];
+    } else {
+        mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:mappableObject destinationObject:destinationObject mapping:mapping metadataList:metadataList];
+        self.reusableMappingOperation = mappingOperation;
+    }
+    [self startMappingOperation:mappingOperation isNew:newDestination atKeyPath:keyPath];
+    return [self finishMappingOperation:mappingOperation atKeyPath:keyPath];
+}
+
+/**
+ Returns `YES` if a single mapping operation can be reset and reused for mapping each representation in turn. Reuse is restricted to the stateless object data source and to delegates that are not handed the mapping operations, as any other object may retain an operation after it has finished.
+ */
+- (BOOL)canReuseMappingOperations
+{
+    if (! [self.mappingOperationDataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]]) return NO;
+
+    id<RKMapperOperationDelegate> delegate = self.delegate;
+    return ! ([delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)] ||
+              [delegate respondsToSelector:@selector(mapper:didFinishMappingOperation:forKeyPath:)] ||
+              [delegate respondsToSelector:@selector(mapper:didFailMappingOperation:forKeyPath:withError:)]);
+}
+
+// Creates and executes a mapping operation. Does not mutate the state of the receiver, so it may be called concurrently
+- (RKMappingOperation *)startMappingOperationForRepresentation:(id)mappableObject toObject:(id)destinationObject isNew:(BOOL)newDestination atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping metadataList:(NSArray *)metadataList
+{
     RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:mappableObject destinationObject:destinationObject mapping:mapping metadataList:metadataList];
+    [self startMappingOperation:mappingOperation isNew:newDestination atKeyPath:keyPath];
+    return mappingOperation;
+}
+
+- (void)startMappingOperation:(RKMappingOperation *)mappingOperation isNew:(BOOL)newDestination atKeyPath:(NSString *)keyPath
+{
     mappingOperation.dataSource = self.mappingOperationDataSource;
     mappingOperation.newDestinationObject = newDestination;
+    mappingOperation.profiler = self.profiler;
+    mappingOperation.profilerKeyPath = RKDelegateKeyPathFromKeyPath(keyPath);
+    // Each operation records into a change set of its own, merged in order once it has finished successfully
+    mappingOperation.changeSet = self.collectsChangeSet ? [RKMappingChangeSet new] : nil;
     if ([self.delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)]) {
         [self.delegate mapper:self willStartMappingOperation:mappingOperation forKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
     }
     [mappingOperation start];
+}
+
+// Records the outcome of a finished mapping operation and informs the delegate
+- (BOOL)finishMappingOperation:(RKMappingOperation *)mappingOperation atKeyPath:(NSString *)keyPath
+{
     if (mappingOperation.error) {
         if ([self.delegate respondsToSelector:@selector(mapper:didFailMappingOperation:forKeyPath:withError:)]) {
             [self.delegate mapper:self didFailMappingOperation:mappingOperation forKeyPath:RKDelegateKeyPathFromKeyPath(keyPath) withError:mappingOperation.error];
@@ -275,6 +462,7 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
         if ([self.delegate respondsToSelector:@selector(mapper:didFinishMappingOperation:forKeyPath:)]) {
             [self.delegate mapper:self didFinishMappingOperation:mappingOperation forKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
         }
+        if (mappingOperation.changeSet) [self.changeSet addEntriesFromChangeSet:mappingOperation.changeSet];
         
         if (mappingOperation.mappingInfo) {
             id infoKey = keyPath ?: [NSNull null];
@@ -330,12 +518,16 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 - (id)mapRepresentationOrRepresentations:(id)mappableValue atKeyPath:(NSString *)keyPath usingMapping:(RKMapping *)mapping
 {
     id mappingResult;
-    if (mapping.forceCollectionMapping || [mappableValue isKindOfClass:[NSArray class]] || [mappableValue isKindOfClass:[NSSet class]]) {
+    if (mapping.forceCollectionMapping || [mappableValue isKindOfClass:[NSArray class]] || [mappableValue isKindOfClass:[NSSet class]] || [mappableValue isKindOfClass:[NSEnumerator class]]) {
         RKLogDebug(@"Found mappable collection at keyPath '%@': %@", keyPath, mappableValue);
         mappingResult = [self mapRepresentations:mappableValue atKeyPath:keyPath usingMapping:mapping];
     } else {
         RKLogDebug(@"Found mappable data at keyPath '%@': %@", keyPath, mappableValue);
-        mappingResult = [self mapRepresentation:mappableValue atKeyPath:keyPath usingMapping:mapping];
+        __block id mappedObject = nil;
+        [self performSlice:^{
+            mappedObject = [self mapRepresentation:mappableValue atKeyPath:keyPath usingMapping:mapping];
+        }];
+        mappingResult = mappedObject;
     }
 
     return mappingResult;
@@ -343,43 +535,128 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
 
 #pragma mark -
 
-- (NSMutableDictionary *)mapSourceRepresentationWithMappingsDictionary:(NSDictionary *)mappingsByKeyPath
+- (BOOL)shouldMapKeyPathsConcurrently:(NSDictionary *)mappingsByKeyPath
 {
-    BOOL foundMappable = NO;
-    NSMutableDictionary *results = [NSMutableDictionary dictionary];
+    if (! self.mapsKeyPathsConcurrently || [mappingsByKeyPath count] < 2) return NO;
+    if (self.sliceExecutionBlock) return NO;
+    if (! [self.mappingOperationDataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]]) return NO;
+    if (self.targetObject) return NO;
+
+    id<RKMapperOperationDelegate> delegate = self.delegate;
+    if ([delegate respondsToSelector:@selector(mapper:willStartMappingOperation:forKeyPath:)] ||
+        [delegate respondsToSelector:@selector(mapper:didFinishMappingOperation:forKeyPath:)] ||
+        [delegate respondsToSelector:@selector(mapper:didFailMappingOperation:forKeyPath:withError:)]) return NO;
+
+    for (RKMapping *mapping in [mappingsByKeyPath allValues]) {
+        if (! [mapping isMemberOfClass:[RKObjectMapping class]]) return NO;
+    }
+
+    return YES;
+}
+
+// Returns the representation nested at the given key path, informing the delegate if it was found or not. Returns `nil` if there is nothing to map.
+- (id)nestedRepresentationAtKeyPath:(NSString *)keyPath
+{
+    id nestedRepresentation = nil;
+
+    RKLogTrace(@"Examining keyPath '%@' for mappable content...", keyPath);
+
+    if ([keyPath isEqual:[NSNull null]] || [keyPath isEqualToString:@""]) {
+        nestedRepresentation = self.representation;
+    } else {
+        nestedRepresentation = [self.representation valueForKeyPath:keyPath];
+    }
+
+    // Not found...
+    if (nestedRepresentation == nil || nestedRepresentation == [NSNull null] || [self isNullCollection:nestedRepresentation]) {
+        RKLogDebug(@"Found unmappable value at keyPath: %@", keyPath);
+
+        if ([self.delegate respondsToSelector:@selector(mapper:didNotFindRepresentationOrArrayOfRepresentationsAtKeyPath:)]) {
+            [self.delegate mapper:self didNotFindRepresentationOrArrayOfRepresentationsAtKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
+        }
+
+        return nil;
+    }
+
+    if ([self.delegate respondsToSelector:@selector(mapper:didFindRepresentationOrArrayOfRepresentations:atKeyPath:)]) {
+        [self.delegate mapper:self didFindRepresentationOrArrayOfRepresentations:nestedRepresentation atKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
+    }
+
+    return nestedRepresentation;
+}
+
+- (NSMutableDictionary *)mapSourceRepresentationConcurrentlyWithMappingsDictionary:(NSDictionary *)mappingsByKeyPath
+{
+    // Locate the nested representations serially so the delegate observes the same sequence of search messages
+    NSMutableArray *keyPaths = [NSMutableArray arrayWithCapacity:[mappingsByKeyPath count]];
     for (NSString *keyPath in mappingsByKeyPath) {
         if ([self isCancelled]) return nil;
-        
-        @autoreleasepool {
-            id mappingResult = nil;
-            id nestedRepresentation = nil;
-
-            RKLogTrace(@"Examining keyPath '%@' for mappable content...", keyPath);
+        if ([self nestedRepresentationAtKeyPath:keyPath]) [keyPaths addObject:keyPath];
+    }
+    if ([keyPaths count] == 0) return nil;
+
+    // Each key path is mapped by a private mapper so that results, errors and mapping info are accumulated independently
+    NSMutableArray *keyPathMappers = [NSMutableArray arrayWithCapacity:[keyPaths count]];
+    for (NSString *keyPath in keyPaths) {
+        RKObjectMapping *mapping = mappingsByKeyPath[keyPath];
+        [mapping compile];
+        RKMapperOperation *keyPathMapper = [[RKMapperOperation alloc] initWithRepresentation:self.representation mappingsDictionary:@{ keyPath: mapping }];
+        keyPathMapper.mappingOperationDataSource = self.mappingOperationDataSource;
+        keyPathMapper.metadata = self.metadata;
+        keyPathMapper.mapsCollectionsConcurrently = self.mapsCollectionsConcurrently;
+        keyPathMapper.collectsChangeSet = self.collectsChangeSet;
+        keyPathMapper.profiler = self.profiler;
+        [keyPathMappers addObject:keyPathMapper];
+    }
 
-            if ([keyPath isEqual:[NSNull null]] || [keyPath isEqualToString:@""]) {
-                nestedRepresentation = self.representation;
+    RKLogDebug(@"Mapping %ld key paths concurrently: %@", (long) [keyPaths count], keyPaths);
+    dispatch_apply([keyPathMappers count], dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        if ([self isCancelled]) return;
+        @autoreleasepool {
+            [keyPathMappers[index] start];
+        }
+    });
+    if ([self isCancelled]) return nil;
+
+    // Merge in search order
+    NSMutableDictionary *results = [NSMutableDictionary dictionaryWithCapacity:[keyPaths count]];
+    for (RKMapperOperation *keyPathMapper in keyPathMappers) {
+        [self.mappingErrors addObjectsFromArray:keyPathMapper.mappingErrors];
+        if (keyPathMapper.error) self.error = keyPathMapper.error;
+        [keyPathMapper.mutableMappingInfo enumerateKeysAndObjectsUsingBlock:^(id infoKey, NSArray *mappingInfo, BOOL *stop) {
+            NSMutableArray *infoForKeyPath = (self.mutableMappingInfo)[infoKey];
+            if (infoForKeyPath) {
+                [infoForKeyPath addObjectsFromArray:mappingInfo];
             } else {
-                nestedRepresentation = [self.representation valueForKeyPath:keyPath];
+                [self.mutableMappingInfo setValue:[mappingInfo mutableCopy] forKey:infoKey];
             }
+        }];
+        if (keyPathMapper.mappingResult) [results addEntriesFromDictionary:[keyPathMapper.mappingResult dictionary]];
+        if (keyPathMapper.mappingResult.changeSet) [self.changeSet addEntriesFromChangeSet:keyPathMapper.mappingResult.changeSet];
+    }
 
-            // Not found...
-            if (nestedRepresentation == nil || nestedRepresentation == [NSNull null] || [self isNullCollection:nestedRepresentation]) {
-                RKLogDebug(@"Found unmappable value at keyPath: %@", keyPath);
+    return results;
+}
 
-                if ([self.delegate respondsToSelector:@selector(mapper:didNotFindRepresentationOrArrayOfRepresentationsAtKeyPath:)]) {
-                    [self.delegate mapper:self didNotFindRepresentationOrArrayOfRepresentationsAtKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
-                }
+- (NSMutableDictionary *)mapSourceRepresentationWithMappingsDictionary:(NSDictionary *)mappingsByKeyPath
+{
+    if ([self shouldMapKeyPathsConcurrently:mappingsByKeyPath]) {
+        return [self mapSourceRepresentationConcurrentlyWithMappingsDictionary:mappingsByKeyPath];
+    }
 
-                continue;
-            }
+    BOOL foundMappable = NO;
+    NSMutableDictionary *results = [NSMutableDictionary dictionary];
+    for (NSString *keyPath in mappingsByKeyPath) {
+        if ([self isCancelled]) return nil;
+        
+        @autoreleasepool {
+            id mappingResult = nil;
+            id nestedRepresentation = [self nestedRepresentationAtKeyPath:keyPath];
+            if (! nestedRepresentation) continue;
 
             // Found something to map
             foundMappable = YES;
             RKMapping *mapping = mappingsByKeyPath[keyPath];
-            if ([self.delegate respondsToSelector:@selector(mapper:didFindRepresentationOrArrayOfRepresentations:atKeyPath:)]) {
-                [self.delegate mapper:self didFindRepresentationOrArrayOfRepresentations:nestedRepresentation atKeyPath:RKDelegateKeyPathFromKeyPath(keyPath)];
-            }
-
             mappingResult = [self mapRepresentationOrRepresentations:nestedRepresentation atKeyPath:keyPath usingMapping:mapping];
 
             if (mappingResult) {
@@ -410,16 +687,21 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
     if ([self isCancelled]) return;
     self.mutableMappingInfo = [NSMutableDictionary dictionary];
     self.mappingErrors = [NSMutableArray new];
+    self.changeSet = self.collectsChangeSet ? [RKMappingChangeSet new] : nil;
 
-    RKLogDebug(@"Executing mapping operation for representation: %@\n and targetObject: %@", self.representation, self.targetObject);
+    // The target object and the delegate may access the mapped objects, so they are only consulted within a slice
+    [self performSlice:^{
+        RKLogDebug(@"Executing mapping operation for representation: %@\n and targetObject: %@", self.representation, self.targetObject);
 
-    if ([self.delegate respondsToSelector:@selector(mapperWillStartMapping:)]) {
-        [self.delegate mapperWillStartMapping:self];
-    }
+        if ([self.delegate respondsToSelector:@selector(mapperWillStartMapping:)]) {
+            [self.delegate mapperWillStartMapping:self];
+        }
+    }];
 
     // Perform the mapping
     BOOL foundMappable = NO;
     NSMutableDictionary *results = [self mapSourceRepresentationWithMappingsDictionary:self.mappingsDictionary];
+    self.reusableMappingOperation = nil;
     if ([self isCancelled]) return;
     foundMappable = (results != nil);    
 
@@ -434,13 +716,15 @@ static NSString *RKFailureReasonErrorStringForMappingNotFoundError(id representa
         NSError *compositeError = [[NSError alloc] initWithDomain:RKErrorDomain code:RKMappingErrorNotFound userInfo:userInfo];
         self.error = compositeError;
     } else {
-        if (results) self.mappingResult = [[RKMappingResult alloc] initWithDictionary:results];
+        if (results) self.mappingResult = [[RKMappingResult alloc] initWithDictionary:results changeSet:self.changeSet];
     }
 
-    RKLogDebug(@"Finished performing object mapping. Results: %@", results);
-    if ([self.delegate respondsToSelector:@selector(mapperDidFinishMapping:)]) {
-        [self.delegate mapperDidFinishMapping:self];
-    }
+    [self performSlice:^{
+        RKLogDebug(@"Finished performing object mapping. Results: %@", results);
+        if ([self.delegate respondsToSelector:@selector(mapperDidFinishMapping:)]) {
+            [self.delegate mapperDidFinishMapping:self];
+        }
+    }];
 }
 
 - (BOOL)execute:(NSError **)error
@@ -47,6 +47,26 @@
  */
 @property (nonatomic, assign) BOOL forceCollectionMapping;
 
+///-------------------------
+/// @name Freezing Mappings
+///-------------------------
+
+/**
+ Makes the receiver and every mapping reachable from it immutable, so that the mapping graph can be shared by mapping operations executing concurrently on any number of threads.
+
+ Freezing an object mapping compiles its `executionPlan` and freezes its property mappings along with the mappings targeted by its relationships. A compound `valueTransformer` of the object mapping or its property mappings is replaced with a frozen copy, which raises an `NSInternalInconsistencyException` when value transformers are added to or removed from it. Freezing an entity mapping additionally freezes its connection descriptions. Freezing a dynamic mapping compiles its matchers and freezes the object mappings they select; object mappings returned by its `objectMappingForRepresentationBlock` are frozen as the block returns them.
+
+ Once frozen, invoking any method that mutates the configuration of the receiver raises an `NSInternalInconsistencyException`, so the compiled state read during mapping can no longer be invalidated. Freezing cannot be undone: copies of a frozen mapping are mutable, but reference the same frozen mappings through their relationships.
+
+ Mappings are typically frozen once they have been configured, before they are handed to other threads.
+ */
+- (void)freeze;
+
+/**
+ Returns a Boolean value that indicates if the receiver has been frozen.
+ */
+@property (nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
 
 ///-------------------------
 /// @name Comparing Mappings
@@ -6,11 +6,50 @@
 //  Copyright (c) 2009-2012 RestKit. All rights reserved.
 //
 
-#import "RKMapping.h"
+#import <stdatomic.h>
+#import "RKMapping_Private.h"
 
-@implementation RKMapping
+// The mappings marked as frozen by the outermost invocation of `freeze`, which are published together once the whole graph has been frozen
+static NSMutableArray *RKMappingsBeingFrozen = nil;
+
+@implementation RKMapping {
+    // YES once the receiver and every mapping reachable from it have been frozen
+    atomic_bool _reachableMappingsFrozen;
+}
 
 @synthesize forceCollectionMapping;
+@synthesize frozen = _frozen;
+
+- (void)setForceCollectionMapping:(BOOL)shouldForceCollectionMapping
+{
+    RKRaiseIfFrozen();
+    forceCollectionMapping = shouldForceCollectionMapping;
+}
+
+- (void)freeze
+{
+    if (atomic_load_explicit(&_reachableMappingsFrozen, memory_order_acquire)) return;
+
+    // Freezing is serialized, so that a thread freezing a mapping being frozen by another thread waits until the whole graph has been frozen.
+    // The lock is recursive and the receiver is marked first, so that cycles in the mapping graph terminate.
+    @synchronized([RKMapping class]) {
+        if (_frozen) return;
+        _frozen = YES;
+        BOOL outermost = (RKMappingsBeingFrozen == nil);
+        if (outermost) RKMappingsBeingFrozen = [NSMutableArray array];
+        [RKMappingsBeingFrozen addObject:self];
+        [self freezeReachableMappings];
+        if (outermost) {
+            for (RKMapping *mapping in RKMappingsBeingFrozen) atomic_store_explicit(&mapping->_reachableMappingsFrozen, true, memory_order_release);
+            RKMappingsBeingFrozen = nil;
+        }
+    }
+}
+
+- (void)freezeReachableMappings
+{
+    // Subclasses freeze their compiled state and the mappings reachable from them
+}
 
 - (BOOL)isEqualToMapping:(RKMapping *)otherMapping
 {
@@ -0,0 +1,79 @@
+//
+//  RKMappingChangeSet.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ The `RKMappingChangeSet` class describes the effect of a mapping on the objects it mapped: the objects that were inserted, the objects that were updated along with the key paths that changed, and the objects that were mapped without being changed.
+
+ A change set is collected by an `RKMapperOperation` whose `collectsChangeSet` property is `YES` and is made available by the `changeSet` of its `mappingResult`. It covers all objects mapped by the mapper, including the objects mapped through relationships, and is built from the knowledge of the mapping operations: an object is inserted if the data source of the operation created it rather than retrieving an existing object (see `mappingOperationDidInsertDestinationObject:`), and a key path is changed if a value was assigned to it. Key paths whose values were found to be unchanged are not reported. Since mapping operations set all values of new objects, the changed key paths of inserted objects are all of their mapped key paths.
+
+ Objects are compared by identity. An object mapped more than once is reported once, as inserted if any of its mappings inserted it, with the union of the key paths changed by all of its mappings. Objects are listed in the order in which their mapping finished, so the objects mapped through the relationships of an object precede it.
+ */
+@interface RKMappingChangeSet : NSObject
+
+///-----------------------------------
+/// @name Accessing Changes
+///-----------------------------------
+
+/**
+ The objects that were inserted by the data source of the mapping.
+ */
+@property (nonatomic, readonly) NSArray *insertedObjects;
+
+/**
+ The existing objects that had at least one value changed by the mapping.
+ */
+@property (nonatomic, readonly) NSArray *updatedObjects;
+
+/**
+ The existing objects that were mapped without any of their values being changed.
+ */
+@property (nonatomic, readonly) NSArray *unchangedObjects;
+
+/**
+ Returns the destination key paths of the values that were assigned to the given object.
+
+ @param object An object recorded in the receiver.
+ @return A set of the changed key paths of the object, which is empty for unchanged objects, or `nil` if the object was not mapped.
+ */
+- (NSSet *)changedKeyPathsForObject:(id)object;
+
+///-----------------------------------
+/// @name Recording Changes
+///-----------------------------------
+
+/**
+ Records the mapping of an object. This method is safe to call from multiple threads.
+
+ @param object The object that was mapped.
+ @param inserted A Boolean value that indicates if the object was inserted by the mapping.
+ @param changedKeyPaths The key paths of the values that were assigned to the object, or `nil` if none were.
+ */
+- (void)recordMappingOfObject:(id)object inserted:(BOOL)inserted changedKeyPaths:(NSSet *)changedKeyPaths;
+
+/**
+ Records all of the mappings recorded by the given change set, in order.
+
+ @param changeSet The change set whose entries are merged into the receiver.
+ */
+- (void)addEntriesFromChangeSet:(RKMappingChangeSet *)changeSet;
+
+@end
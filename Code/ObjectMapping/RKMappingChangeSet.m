@@ -0,0 +1,129 @@
+//
+//  RKMappingChangeSet.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKMappingChangeSet.h"
+
+@interface RKMappingChangeSetEntry : NSObject
+@property (nonatomic, assign) BOOL inserted;
+@property (nonatomic, strong) NSMutableSet *changedKeyPaths;
+@end
+
+@implementation RKMappingChangeSetEntry
+@end
+
+@interface RKMappingChangeSet ()
+@property (nonatomic, strong) NSMapTable *entriesByObject;
+@property (nonatomic, strong) NSMutableArray *objects; // In the order in which they were first recorded
+@end
+
+@implementation RKMappingChangeSet
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        // Mapped objects such as mutable dictionaries may change their hash as they are mapped, so they are keyed by identity
+        self.entriesByObject = [[NSMapTable alloc] initWithKeyOptions:NSPointerFunctionsStrongMemory | NSPointerFunctionsObjectPointerPersonality
+                                                         valueOptions:NSPointerFunctionsStrongMemory capacity:0];
+        self.objects = [NSMutableArray array];
+    }
+    return self;
+}
+
+- (NSArray *)objectsPassingTest:(BOOL (^)(RKMappingChangeSetEntry *entry))predicate
+{
+    @synchronized(self) {
+        NSMutableArray *objects = [NSMutableArray array];
+        for (id object in self.objects) {
+            if (predicate([self.entriesByObject objectForKey:object])) [objects addObject:object];
+        }
+        return objects;
+    }
+}
+
+- (NSArray *)insertedObjects
+{
+    return [self objectsPassingTest:^BOOL(RKMappingChangeSetEntry *entry) {
+        return entry.inserted;
+    }];
+}
+
+- (NSArray *)updatedObjects
+{
+    return [self objectsPassingTest:^BOOL(RKMappingChangeSetEntry *entry) {
+        return ! entry.inserted && [entry.changedKeyPaths count] > 0;
+    }];
+}
+
+- (NSArray *)unchangedObjects
+{
+    return [self objectsPassingTest:^BOOL(RKMappingChangeSetEntry *entry) {
+        return ! entry.inserted && [entry.changedKeyPaths count] == 0;
+    }];
+}
+
+- (NSSet *)changedKeyPathsForObject:(id)object
+{
+    @synchronized(self) {
+        return [[[self.entriesByObject objectForKey:object] changedKeyPaths] copy];
+    }
+}
+
+- (void)recordMappingOfObject:(id)object inserted:(BOOL)inserted changedKeyPaths:(NSSet *)changedKeyPaths
+{
+    NSParameterAssert(object);
+    @synchronized(self) {
+        RKMappingChangeSetEntry *entry = [self.entriesByObject objectForKey:object];
+        if (! entry) {
+            entry = [RKMappingChangeSetEntry new];
+            entry.changedKeyPaths = [NSMutableSet set];
+            [self.entriesByObject setObject:entry forKey:object];
+            [self.objects addObject:object];
+        }
+        if (inserted) entry.inserted = YES;
+        if (changedKeyPaths) [entry.changedKeyPaths unionSet:changedKeyPaths];
+    }
+}
+
+- (void)addEntriesFromChangeSet:(RKMappingChangeSet *)changeSet
+{
+    NSArray *objects;
+    NSMapTable *entriesByObject;
+    @synchronized(changeSet) {
+        objects = [changeSet.objects copy];
+        entriesByObject = [changeSet.entriesByObject copy];
+    }
+    for (id object in objects) {
+        RKMappingChangeSetEntry *entry = [entriesByObject objectForKey:object];
+        [self recordMappingOfObject:object inserted:entry.inserted changedKeyPaths:entry.changedKeyPaths];
+    }
+}
+
+- (NSString *)description
+{
+    @synchronized(self) {
+        NSUInteger insertedCount = [[self insertedObjects] count];
+        NSUInteger updatedCount = [[self updatedObjects] count];
+        return [NSString stringWithFormat:@"<%@: %p inserted=%ld, updated=%ld, unchanged=%ld>", NSStringFromClass([self class]), self,
+                (long) insertedCount, (long) updatedCount, (long) ([self.objects count] - insertedCount - updatedCount)];
+    }
+}
+
+@end
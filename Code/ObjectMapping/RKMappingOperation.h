@@ -25,7 +25,7 @@
 #import "RKObjectMapping.h"
 #import "RKAttributeMapping.h"
 
-@class RKMappingOperation, RKDynamicMapping, RKConnectionDescription, RKMappingInfo;
+@class RKMappingOperation, RKDynamicMapping, RKConnectionDescription, RKMappingInfo, RKMappingProfiler, RKMappingChangeSet;
 @protocol RKMappingOperationDataSource;
 
 /**
@@ -253,6 +253,18 @@
  */
 - (instancetype)initWithSourceObject:(id)sourceObject destinationObject:(id)destinationObject mapping:(RKMapping *)objectOrDynamicMapping metadataList:(NSArray *)metadataList;
 
+/**
+ Resets the receiver so that it can perform another mapping with a new source object, destination object, mapping and metadata list, as if it had just been initialized with them.
+
+ The delegate and data source of the receiver are retained along with the callbacks resolved for them. Sending `start` to a reset operation reuses the proxy of the source object and the metadata frames pushed for nested objects from the previous mapping. This removes the allocations of a new operation when mapping many representations in succession. An operation must only be reset once no other object retains its `sourceObject`, its `metadataList` or the operation itself, i.e. once the delegate and the data source have no further use for it. `RKMapperOperation` reuses its operations only in that case.
+
+ @param sourceObject The source object to be mapped. Cannot be `nil`.
+ @param destinationObject The destination object the results are to be mapped onto. May be `nil`, in which case a new object target object will be obtained from the `dataSource`.
+ @param objectOrDynamicMapping An instance of `RKObjectMapping` or `RKDynamicMapping` defining how the mapping is to be performed.
+ @param metadataList A list of objects which provide metadata to the operation, as for `initWithSourceObject:destinationObject:mapping:metadataList:`.
+ */
+- (void)prepareForReuseWithSourceObject:(id)sourceObject destinationObject:(id)destinationObject mapping:(RKMapping *)objectOrDynamicMapping metadataList:(NSArray *)metadataList;
+
 ///--------------------------------------
 /// @name Accessing Mapping Configuration
 ///--------------------------------------
@@ -309,6 +321,22 @@
  */
 @property (nonatomic, weak) id<RKMappingOperationDataSource> dataSource;
 
+/**
+ The profiler recording the time spent by the operation in each object mapping, property mapping and value transformer, or `nil` if the operation is not profiled.
+
+ The profiler is propagated to the operations mapping nested objects. **Default**: `nil`
+ */
+@property (nonatomic, strong) RKMappingProfiler *profiler;
+
+/**
+ The change set into which the operation records its destination object, along with the key paths it assigned values to, once it has mapped it successfully, or `nil` if changes are not recorded.
+
+ The change set is propagated to the operations mapping nested objects. **Default**: `nil`
+
+ @see `RKMappingChangeSet`
+ */
+@property (nonatomic, strong) RKMappingChangeSet *changeSet;
+
 ///--------------------------------
 /// @name Accessing Mapping Details
 ///--------------------------------
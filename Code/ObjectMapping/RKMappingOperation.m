@@ -32,6 +32,12 @@
 #import "RKObjectUtilities.h"
 #import "RKValueTransformers.h"
 #import "RKDictionaryUtilities.h"
+#import "RKObjectMappingPlan.h"
+#import "RKDateParsing.h"
+#import "RKDotNetDateFormatter.h"
+#import "ISO8601DateFormatterValueTransformer.h"
+#import "RKMappingProfiler.h"
+#import "RKMappingChangeSet.h"
 
 // Set Logging Component
 #undef RKLogComponent
@@ -39,8 +45,6 @@
 
 #pragma mark - Mapping utilities
 
-extern NSString * const RKObjectMappingNestingAttributeKeyName;
-
 /**
  This function ensures that attribute mappings apply cleanly to an `NSMutableDictionary` target class to support mapping to nested keyPaths. See issue #882
  */
@@ -112,6 +116,58 @@ static BOOL RKObjectContainsValueForMappings(id representation, NSArray *propert
     return NO;
 }
 
+#pragma mark - Callback resolution
+
+/**
+ The optional delegate and data source methods implemented by the collaborators of a mapping operation. Resolved once per operation tree rather than testing `respondsToSelector:` for every mapped value.
+ */
+typedef NS_OPTIONS(NSUInteger, RKMappingOperationCallbacks) {
+    RKMappingOperationDelegateDidFindValue                      = 1 << 0,
+    RKMappingOperationDelegateDidNotFindValue                   = 1 << 1,
+    RKMappingOperationDelegateShouldSetValue                    = 1 << 2,
+    RKMappingOperationDelegateDidSetValue                       = 1 << 3,
+    RKMappingOperationDelegateDidNotSetUnchangedValue           = 1 << 4,
+    RKMappingOperationDelegateDidSelectObjectMapping            = 1 << 5,
+    RKMappingOperationDelegateDidFailWithError                  = 1 << 6,
+    RKMappingOperationDataSourceTargetObjectForMapping          = 1 << 7,
+    RKMappingOperationDataSourceDeleteExistingRelationshipValue = 1 << 8,
+    RKMappingOperationDataSourceShouldCollectMappingInfo        = 1 << 9,
+    RKMappingOperationDataSourceShouldSetUnchangedValues        = 1 << 10,
+    RKMappingOperationDataSourceShouldSkipAttributeMapping      = 1 << 11,
+    RKMappingOperationDataSourceShouldSkipRelationshipMapping   = 1 << 12,
+    RKMappingOperationDataSourceCommitChanges                   = 1 << 13,
+    RKMappingOperationDataSourceTargetObjectsForRepresentations = 1 << 14,
+    RKMappingOperationDataSourceShouldSetPrimitiveValues        = 1 << 15,
+    RKMappingOperationDataSourceDidInsertDestinationObject      = 1 << 16,
+};
+
+static const RKMappingOperationCallbacks RKMappingOperationDelegateValueCallbacks = (RKMappingOperationDelegateDidFindValue | RKMappingOperationDelegateDidNotFindValue |
+                                                                                    RKMappingOperationDelegateShouldSetValue | RKMappingOperationDelegateDidSetValue |
+                                                                                    RKMappingOperationDelegateDidNotSetUnchangedValue);
+
+static RKMappingOperationCallbacks RKMappingOperationCallbacksForDelegateAndDataSource(id delegate, id dataSource)
+{
+    RKMappingOperationCallbacks callbacks = 0;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didFindValue:forKeyPath:mapping:)]) callbacks |= RKMappingOperationDelegateDidFindValue;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didNotFindValueForKeyPath:mapping:)]) callbacks |= RKMappingOperationDelegateDidNotFindValue;
+    if ([delegate respondsToSelector:@selector(mappingOperation:shouldSetValue:forKeyPath:usingMapping:)]) callbacks |= RKMappingOperationDelegateShouldSetValue;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didSetValue:forKeyPath:usingMapping:)]) callbacks |= RKMappingOperationDelegateDidSetValue;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didNotSetUnchangedValue:forKeyPath:usingMapping:)]) callbacks |= RKMappingOperationDelegateDidNotSetUnchangedValue;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didSelectObjectMapping:forDynamicMapping:)]) callbacks |= RKMappingOperationDelegateDidSelectObjectMapping;
+    if ([delegate respondsToSelector:@selector(mappingOperation:didFailWithError:)]) callbacks |= RKMappingOperationDelegateDidFailWithError;
+    if ([dataSource respondsToSelector:@selector(mappingOperation:targetObjectForMapping:inRelationship:)]) callbacks |= RKMappingOperationDataSourceTargetObjectForMapping;
+    if ([dataSource respondsToSelector:@selector(mappingOperation:deleteExistingValueOfRelationshipWithMapping:error:)]) callbacks |= RKMappingOperationDataSourceDeleteExistingRelationshipValue;
+    if ([dataSource respondsToSelector:@selector(mappingOperationShouldCollectMappingInfo:)]) callbacks |= RKMappingOperationDataSourceShouldCollectMappingInfo;
+    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSetUnchangedValues:)]) callbacks |= RKMappingOperationDataSourceShouldSetUnchangedValues;
+    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSkipAttributeMapping:)]) callbacks |= RKMappingOperationDataSourceShouldSkipAttributeMapping;
+    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSkipRelationshipMapping:)]) callbacks |= RKMappingOperationDataSourceShouldSkipRelationshipMapping;
+    if ([dataSource respondsToSelector:@selector(commitChangesForMappingOperation:error:)]) callbacks |= RKMappingOperationDataSourceCommitChanges;
+    if ([dataSource respondsToSelector:@selector(mappingOperation:targetObjectsForRepresentations:withMapping:inRelationship:)]) callbacks |= RKMappingOperationDataSourceTargetObjectsForRepresentations;
+    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSetPrimitiveValues:)]) callbacks |= RKMappingOperationDataSourceShouldSetPrimitiveValues;
+    if ([dataSource respondsToSelector:@selector(mappingOperationDidInsertDestinationObject:)]) callbacks |= RKMappingOperationDataSourceDidInsertDestinationObject;
+    return callbacks;
+}
+
 #pragma mark - Metadata utilities
 
 static NSString *const RKMetadataKey = @"@metadata";
@@ -382,8 +438,37 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 @end
 
 
+// Reads the value for the source key path of a plan, walking dictionary representations directly when the key path does not require the proxy
+static id RKValueForSourceKeyPathOfPlan(id sourceObject, RKPropertyMappingPlan *plan)
+{
+    // NOTE: `RKMappingSourceObject` forwards `class` and `isKindOfClass:` to the wrapped object, so the runtime class is inspected
+    if (! plan.requiresKeyValueCodingForSource && object_getClass(sourceObject) == [RKMappingSourceObject class]) {
+        return [plan valueForSourceKeyPathOfRepresentation:[(RKMappingSourceObject *)sourceObject object]];
+    }
+    return [sourceObject valueForKeyPath:plan.sourceKeyPath];
+}
+
+static const void *RKRepresentationFingerprintsKey = &RKRepresentationFingerprintsKey;
+
+// Returns the fingerprints of the representations an object was last mapped from, keyed by object mapping
+static NSMapTable *RKRepresentationFingerprintsForObject(id object, BOOL createIfNeeded)
+{
+    NSMapTable *fingerprints = objc_getAssociatedObject(object, RKRepresentationFingerprintsKey);
+    if (! fingerprints && createIfNeeded) {
+        fingerprints = [NSMapTable weakToStrongObjectsMapTable];
+        objc_setAssociatedObject(object, RKRepresentationFingerprintsKey, fingerprints, OBJC_ASSOCIATION_RETAIN_NONATOMIC);
+    }
+    return fingerprints;
+}
+
 #pragma mark - RKMappingInfo
 
+@interface RKObjectMapping ()
+@property (atomic, strong) NSCache *parsedDateCache;
+// Returns the parsed date cache, emptied if the contents of the compound value transformer have changed since the cached dates were parsed
+- (NSCache *)parsedDateCacheForValueTransformer;
+@end
+
 @interface RKMappingInfo ()
 @property (nonatomic, assign, readwrite) NSUInteger collectionIndex;
 @property (nonatomic, strong) NSMutableSet *mutablePropertyMappings;
@@ -401,29 +486,30 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     if (self) {
         _objectMapping = objectMapping;
         _dynamicMapping = dynamicMapping;
-        _mutablePropertyMappings = [NSMutableSet setWithCapacity:[objectMapping.propertyMappings count]];
-        _mutableRelationshipMappingInfo = [NSMutableDictionary dictionaryWithCapacity:[objectMapping.relationshipMappings count]];
     }
     return self;
 }
 
 - (NSSet *)propertyMappings
 {
-    return [self.mutablePropertyMappings copy];
+    return [self.mutablePropertyMappings copy] ?: [NSSet set];
 }
 
 - (NSDictionary *)relationshipMappingInfo
 {
-    return [self.mutableRelationshipMappingInfo copy];
+    return [self.mutableRelationshipMappingInfo copy] ?: @{};
 }
 
+// The containers are allocated on first use, as the info of most nested objects records few mappings
 - (void)addPropertyMapping:(RKPropertyMapping *)propertyMapping
 {
+    if (! self.mutablePropertyMappings) self.mutablePropertyMappings = [NSMutableSet setWithCapacity:[self.objectMapping.propertyMappings count]];
     [self.mutablePropertyMappings addObject:propertyMapping];
 }
 
 - (void)addMappingInfo:(RKMappingInfo *)mappingInfo forRelationshipMapping:(RKRelationshipMapping *)relationshipMapping
 {
+    if (! self.mutableRelationshipMappingInfo) self.mutableRelationshipMappingInfo = [NSMutableDictionary dictionaryWithCapacity:[self.objectMapping.relationshipMappings count]];
     NSMutableArray *arrayOfMappingInfo = (self.mutableRelationshipMappingInfo)[relationshipMapping.destinationKeyPath];
     if (arrayOfMappingInfo) {
         [arrayOfMappingInfo addObject:mappingInfo];
@@ -458,17 +544,45 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 @property (nonatomic, strong) id nestedAttributeSubstitutionValue;
 @property (nonatomic, strong, readwrite) NSError *error;
 @property (nonatomic, strong, readwrite) RKObjectMapping *objectMapping; // The concrete mapping
-@property (nonatomic, strong) NSArray *nestedAttributeMappings;
-@property (nonatomic, strong) NSArray *simpleAttributeMappings;
-@property (nonatomic, strong) NSArray *keyPathAttributeMappings;
-@property (nonatomic, strong) NSArray *relationshipMappings;
+@property (nonatomic, strong) RKObjectMappingPlan *plan;
+@property (nonatomic, assign) RKMappingOperationCallbacks callbacks;
+@property (nonatomic, assign) BOOL callbacksResolved;
 @property (nonatomic, strong) RKMappingInfo *mappingInfo;
 @property (nonatomic, getter=isCancelled) BOOL cancelled;
 @property (nonatomic) BOOL collectsMappingInfo;
 @property (nonatomic) BOOL shouldSetUnchangedValues;
+@property (nonatomic) BOOL setsPrimitiveValues;
+@property (nonatomic, strong) NSMutableSet *changedKeyPaths; // The key paths assigned by the receiver, collected for the change set
 @property (nonatomic, readwrite, getter=isNewDestinationObject) BOOL newDestinationObject;
+
+// State retained across reuses of the receiver
+@property (nonatomic, strong) RKMappingSourceObject *reusableSourceObject;
+@property (nonatomic, strong) RKMappingOperation *reusableSubOperation;
+@property (nonatomic, assign) BOOL reusesSubOperations;
+
+// Metadata frames pushed for nested objects, built once per metadata list and updated in place
+@property (nonatomic, strong) RKMappingIndexMetadata *indexMetadata;
+@property (nonatomic, strong) NSArray *indexedMetadataList;
+@property (nonatomic, strong) NSArray *unindexedMetadataList;
+@property (nonatomic, strong) RKMappingMetadata *targetObjectMetadata;
+@property (nonatomic, strong) NSArray *targetObjectMetadataList;
+
+// Profiling state. The key path and parent stack are assigned by the owner of the operation
+@property (nonatomic, copy) NSString *profilerKeyPath;
+@property (nonatomic, copy) NSString *profilerParentStack;
+@property (nonatomic, copy) NSString *profilerStack;
+@property (nonatomic, assign) NSTimeInterval profiledDuration;
+@property (nonatomic, assign) NSTimeInterval profiledChildDuration;
 @end
 
+/**
+ Returns `YES` if sub-operations can be reused for mapping successive nested objects. This is restricted to the stateless object data source without a delegate, as any other object handed a sub-operation may retain it.
+ */
+static BOOL RKMappingOperationCanReuseSubOperations(id delegate, id dataSource)
+{
+    return delegate == nil && [dataSource isMemberOfClass:[RKObjectMappingOperationDataSource class]];
+}
+
 @implementation RKMappingOperation
 
 - (instancetype)initWithSourceObject:(id)sourceObject destinationObject:(id)destinationObject mapping:(RKMapping *)objectOrDynamicMapping
@@ -493,6 +607,71 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return self;
 }
 
+- (void)prepareForReuseWithSourceObject:(id)sourceObject destinationObject:(id)destinationObject mapping:(RKMapping *)objectOrDynamicMapping metadataList:(NSArray *)metadataList
+{
+    NSAssert(sourceObject != nil, @"Cannot perform a mapping operation without a sourceObject object");
+    NSAssert(objectOrDynamicMapping != nil, @"Cannot perform a mapping operation without a mapping");
+
+    if (object_getClass(self.sourceObject) == [RKMappingSourceObject class]) self.reusableSourceObject = self.sourceObject;
+    self.sourceObject = sourceObject;
+    self.rootSourceObject = sourceObject;
+    self.parentSourceObject = nil;
+    self.destinationObject = destinationObject;
+    self.mapping = objectOrDynamicMapping;
+    self.metadataList = metadataList;
+    self.objectMapping = nil;
+    self.plan = nil;
+    self.nestedAttributeSubstitutionKey = nil;
+    self.nestedAttributeSubstitutionValue = nil;
+    self.error = nil;
+    self.mappingInfo = nil;
+    self.cancelled = NO;
+    self.newDestinationObject = NO;
+}
+
+- (void)setDelegate:(id<RKMappingOperationDelegate>)delegate
+{
+    if (delegate != _delegate) self.callbacksResolved = NO;
+    _delegate = delegate;
+}
+
+- (void)setDataSource:(id<RKMappingOperationDataSource>)dataSource
+{
+    if (dataSource != _dataSource) self.callbacksResolved = NO;
+    _dataSource = dataSource;
+}
+
+- (void)setMetadataList:(NSArray *)metadataList
+{
+    if (metadataList == _metadataList) return;
+    _metadataList = metadataList;
+    self.indexedMetadataList = nil;
+    self.unindexedMetadataList = nil;
+    self.targetObjectMetadataList = nil;
+}
+
+// Returns the metadata list of the sub-operations mapping the elements of a to-many relationship, whose index is set on `indexMetadata`
+- (NSArray *)metadataListForIndexedSubOperations
+{
+    if (! self.indexedMetadataList) {
+        if (! self.indexMetadata) self.indexMetadata = [RKMappingIndexMetadata new];
+        self.indexedMetadataList = RKInsertInMetadataList(self.metadataList, self.indexMetadata, nil);
+    }
+    return self.indexedMetadataList;
+}
+
+- (NSArray *)metadataListForUnindexedSubOperations
+{
+    static dispatch_once_t onceToken;
+    static NSDictionary *noIndexMetadata;
+    dispatch_once(&onceToken, ^{
+        noIndexMetadata = @{ @"mapping" : @{ @"collectionIndex" : [NSNull null] } };
+    });
+
+    if (! self.unindexedMetadataList) self.unindexedMetadataList = RKInsertInMetadataList(self.metadataList, noIndexMetadata, nil);
+    return self.unindexedMetadataList;
+}
+
 - (id)parentObjectForRelationshipMapping:(RKRelationshipMapping *)mapping
 {
     id parentSourceObject = self.sourceObject;
@@ -516,39 +695,112 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return parentSourceObject;
 }
 
-- (id)destinationObjectForMappingRepresentation:(id)representation parentRepresentation:(id)parentRepresentation withMapping:(RKMapping *)mapping inRelationship:(RKRelationshipMapping *)relationshipMapping
+// Returns the object mapping with which to map the given representation, or `nil` if a dynamic mapping declined to map it
+- (RKObjectMapping *)concreteMappingForRepresentation:(id)representation withMapping:(RKMapping *)mapping
 {
-    RKObjectMapping *concreteMapping = nil;
     if ([mapping isKindOfClass:[RKDynamicMapping class]]) {
-        concreteMapping = [(RKDynamicMapping *)mapping objectMappingForRepresentation:representation];
+        RKObjectMapping *concreteMapping = [(RKDynamicMapping *)mapping objectMappingForRepresentation:representation];
         if (! concreteMapping) {
             RKLogDebug(@"Unable to determine concrete object mapping from dynamic mapping %@ with which to map object representation: %@", mapping, representation);
-            return nil;
         }
+        return concreteMapping;
     } else if ([mapping isKindOfClass:[RKObjectMapping class]]) {
-        concreteMapping = (RKObjectMapping *)mapping;
+        return (RKObjectMapping *)mapping;
     }
+    return nil;
+}
+
+// Returns the source object given to the data source when retrieving the target object for a nested representation
+- (RKMappingSourceObject *)sourceObjectForTargetObjectOfRepresentation:(id)representation parentRepresentation:(id)parentRepresentation metadata:(NSArray *)metadata
+{
+    NSDictionary *dictionaryRepresentation = [representation isKindOfClass:[NSDictionary class]] ? representation : @{ [NSNull null] : representation };
+    return [[RKMappingSourceObject alloc] initWithObject:dictionaryRepresentation parentObject:parentRepresentation rootObject:self.rootSourceObject metadata:metadata];
+}
+
+- (NSArray *)metadataForTargetObjectRetrieval
+{
+    if (! self.targetObjectMetadata) self.targetObjectMetadata = [RKMappingMetadata new];
+    if (! self.targetObjectMetadataList) self.targetObjectMetadataList = RKInsertInMetadataList(self.metadataList, self.targetObjectMetadata, nil);
+    self.targetObjectMetadata.parentObject = self.destinationObject ?: [NSNull null];
+    return self.targetObjectMetadataList;
+}
+
+- (id)destinationObjectForMappingRepresentation:(id)representation parentRepresentation:(id)parentRepresentation withMapping:(RKMapping *)mapping inRelationship:(RKRelationshipMapping *)relationshipMapping
+{
+    RKObjectMapping *concreteMapping = [self concreteMappingForRepresentation:representation withMapping:mapping];
+    if (! concreteMapping && [mapping isKindOfClass:[RKDynamicMapping class]]) return nil;
     
     id destinationObject = nil;
     id dataSource = self.dataSource;
-    if ([dataSource respondsToSelector:@selector(mappingOperation:targetObjectForMapping:inRelationship:)])
+    if (_callbacks & RKMappingOperationDataSourceTargetObjectForMapping)
     {
         destinationObject = [dataSource mappingOperation:self targetObjectForMapping:concreteMapping inRelationship:relationshipMapping];
     }
     
     if (destinationObject == nil)
     {
-        NSDictionary *dictionaryRepresentation = [representation isKindOfClass:[NSDictionary class]] ? representation : @{ [NSNull null] : representation };
-        RKMappingMetadata *parentMetadata = [RKMappingMetadata new];
-        parentMetadata.parentObject = self.destinationObject ?: [NSNull null];
-        NSArray *metadata = RKInsertInMetadataList(self.metadataList, parentMetadata, nil);
-        RKMappingSourceObject *sourceObject = [[RKMappingSourceObject alloc] initWithObject:dictionaryRepresentation parentObject:parentRepresentation rootObject:self.rootSourceObject metadata:metadata];
+        RKMappingSourceObject *sourceObject = [self sourceObjectForTargetObjectOfRepresentation:representation parentRepresentation:parentRepresentation metadata:[self metadataForTargetObjectRetrieval]];
         destinationObject = [dataSource mappingOperation:self targetObjectForRepresentation:(NSDictionary *)sourceObject withMapping:concreteMapping inRelationship:relationshipMapping];
     }
 
     return destinationObject;
 }
 
+/**
+ Retrieves the destination objects for all elements of a to-many relationship from the data source with one batch request per concrete object mapping. Returns an array containing the destination object of each element or `NSNull` for declined elements, or `nil` if the data source does not retrieve target objects in batches.
+ */
+- (NSArray *)destinationObjectsForMappingRepresentations:(NSArray *)representations parentRepresentation:(id)parentRepresentation withMapping:(RKMapping *)mapping inRelationship:(RKRelationshipMapping *)relationshipMapping
+{
+    if (! (_callbacks & RKMappingOperationDataSourceTargetObjectsForRepresentations)) return nil;
+    if (! [mapping isKindOfClass:[RKObjectMapping class]] && ! [mapping isKindOfClass:[RKDynamicMapping class]]) return nil;
+
+    id dataSource = self.dataSource;
+    NSArray *metadata = [self metadataForTargetObjectRetrieval];
+    NSMutableArray *destinationObjects = [NSMutableArray arrayWithCapacity:[representations count]];
+    NSMutableArray *sourceObjects = [NSMutableArray arrayWithCapacity:[representations count]];
+    NSMapTable *indexesByMapping = [NSMapTable strongToStrongObjectsMapTable];
+    [representations enumerateObjectsUsingBlock:^(id representation, NSUInteger index, BOOL *stop) {
+        [destinationObjects addObject:[NSNull null]];
+        [sourceObjects addObject:[NSNull null]];
+        RKObjectMapping *concreteMapping = [self concreteMappingForRepresentation:representation withMapping:mapping];
+        if (! concreteMapping) return;
+
+        if (_callbacks & RKMappingOperationDataSourceTargetObjectForMapping) {
+            id destinationObject = [dataSource mappingOperation:self targetObjectForMapping:concreteMapping inRelationship:relationshipMapping];
+            if (destinationObject) {
+                destinationObjects[index] = destinationObject;
+                return;
+            }
+        }
+
+        sourceObjects[index] = [self sourceObjectForTargetObjectOfRepresentation:representation parentRepresentation:parentRepresentation metadata:metadata];
+        NSMutableIndexSet *indexes = [indexesByMapping objectForKey:concreteMapping];
+        if (! indexes) {
+            indexes = [NSMutableIndexSet indexSet];
+            [indexesByMapping setObject:indexes forKey:concreteMapping];
+        }
+        [indexes addIndex:index];
+    }];
+
+    for (RKObjectMapping *concreteMapping in indexesByMapping) {
+        NSIndexSet *indexes = [indexesByMapping objectForKey:concreteMapping];
+        NSArray *mappingSourceObjects = [sourceObjects objectsAtIndexes:indexes];
+        NSArray *targetObjects = [dataSource mappingOperation:self targetObjectsForRepresentations:mappingSourceObjects withMapping:concreteMapping inRelationship:relationshipMapping];
+        if (targetObjects && [targetObjects count] != [mappingSourceObjects count]) {
+            RKLogWarning(@"Data source %@ returned %ld target objects for %ld representations: retrieving target objects individually.", dataSource, (long) [targetObjects count], (long) [mappingSourceObjects count]);
+            targetObjects = nil;
+        }
+
+        __block NSUInteger position = 0;
+        [indexes enumerateIndexesUsingBlock:^(NSUInteger index, BOOL *stop) {
+            id targetObject = targetObjects ? targetObjects[position++] : [dataSource mappingOperation:self targetObjectForRepresentation:sourceObjects[index] withMapping:concreteMapping inRelationship:relationshipMapping];
+            if (targetObject) destinationObjects[index] = targetObject;
+        }];
+    }
+
+    return destinationObjects;
+}
+
 - (BOOL)validateValue:(id *)value atKeyPath:(NSString *)keyPath
 {
     BOOL success = YES;
@@ -577,7 +829,14 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
 - (BOOL)shouldSetValue:(id *)value forKeyPath:(NSString *)keyPath usingMapping:(RKPropertyMapping *)propertyMapping
 {
-    if ([self.delegate respondsToSelector:@selector(mappingOperation:shouldSetValue:forKeyPath:usingMapping:)]) {
+    BOOL shouldSetValue = [self shouldSetChangedValue:value forKeyPath:keyPath usingMapping:propertyMapping];
+    if (shouldSetValue && keyPath) [_changedKeyPaths addObject:keyPath];
+    return shouldSetValue;
+}
+
+- (BOOL)shouldSetChangedValue:(id *)value forKeyPath:(NSString *)keyPath usingMapping:(RKPropertyMapping *)propertyMapping
+{
+    if (_callbacks & RKMappingOperationDelegateShouldSetValue) {
         return [self.delegate mappingOperation:self shouldSetValue:*value forKeyPath:keyPath usingMapping:propertyMapping];
     }
     
@@ -615,71 +874,59 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return NO;
 }
 
-- (NSArray *)applyNestingToMappings:(NSArray *)propertyMappings
+- (RKObjectMappingPlan *)plan
 {
-    if (self.nestedAttributeSubstitutionKey == nil) return propertyMappings;
-    
-    return RKApplyNestingAttributeValueToMappings(self.nestedAttributeSubstitutionKey, self.nestedAttributeSubstitutionValue, propertyMappings);
-}
-
-- (void)cacheMappingsIfNeeded
-{
-    if (!_nestedAttributeMappings)
-    {
-        RKObjectMapping *mapping = self.objectMapping;
-
-        if (self.nestedAttributeSubstitutionKey == nil) {
-            _relationshipMappings = mapping.relationshipMappings;
-            _nestedAttributeMappings = mapping.attributeMappings;
-            _simpleAttributeMappings = mapping.keyAttributeMappings;
-            _keyPathAttributeMappings = mapping.keyPathAttributeMappings;
-        }
-        else {
-            _nestedAttributeMappings = [self applyNestingToMappings:mapping.attributeMappings];
-            _relationshipMappings = [self applyNestingToMappings:mapping.relationshipMappings];
-            NSMutableArray *simpleList = [[NSMutableArray alloc] initWithCapacity:[_nestedAttributeMappings count]];
-            NSMutableArray *keyPathList = [[NSMutableArray alloc] initWithCapacity:[_nestedAttributeMappings count]];
-            
-            // The nested substitution may have changed which properties are simple vs keyPath, so we have to
-            // re-check based on the nesting result.
-            for (RKPropertyMapping *mapping in _nestedAttributeMappings) {
-                BOOL isSimple = [mapping.sourceKeyPath rangeOfString:@"." options:NSLiteralSearch].length == 0;
-                NSMutableArray *arrayToAdd = isSimple? simpleList : keyPathList;
-                [arrayToAdd addObject:mapping];
-            }
-            
-            _simpleAttributeMappings = simpleList;
-            _keyPathAttributeMappings = keyPathList;
-        }
+    if (! _plan) {
+        RKObjectMapping *objectMapping = self.objectMapping;
+        _plan = [objectMapping.executionPlan planBySubstitutingValue:self.nestedAttributeSubstitutionValue forNestingAttribute:self.nestedAttributeSubstitutionKey objectMapping:objectMapping];
     }
+    return _plan;
 }
 
-- (NSArray *)nestedAttributeMappings
+// Returns YES if the destination property of the given plan is a primitive type on the destination object
+- (BOOL)isDestinationPrimitiveForPlan:(RKPropertyMappingPlan *)plan
 {
-    [self cacheMappingsIfNeeded];
-    return _nestedAttributeMappings;
+    id destinationObject = self.destinationObject;
+    if ([destinationObject class] == self.objectMapping.objectClass && !RKIsManagedObject(destinationObject)) {
+        return plan.isDestinationPrimitive;
+    }
+    return RKPropertyInspectorIsPropertyAtKeyPathOfObjectPrimitive(plan.destinationKeyPath, destinationObject);
 }
 
-- (NSArray *)simpleAttributeMappings
+// Transforms a string into a date, setting `appliedValueTransformer` to the transformer that parsed the string, or the formatter whose result was reproduced natively. Dates served by the parsed date cache have no transformer
+- (BOOL)transformString:(NSString *)string toDate:(__autoreleasing id *)outputValue withPropertyMapping:(RKPropertyMapping *)propertyMapping appliedValueTransformer:(__autoreleasing id<RKValueTransforming> *)appliedValueTransformer error:(NSError *__autoreleasing *)error
 {
-    [self cacheMappingsIfNeeded];
-    return _simpleAttributeMappings;
-}
+    id<RKValueTransforming> valueTransformer = propertyMapping.valueTransformer;
+    RKObjectMapping *objectMapping = propertyMapping.objectMapping;
+    NSCache *parsedDateCache = (valueTransformer == objectMapping.valueTransformer) ? [objectMapping parsedDateCacheForValueTransformer] : nil;
+    id date = [parsedDateCache objectForKey:string];
+    if (date) {
+        *appliedValueTransformer = nil;
+        *outputValue = date;
+        return YES;
+    }
 
-- (NSArray *)keyPathAttributeMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _keyPathAttributeMappings;
-}
+    // Parse natively when the result is identical to that of the formatter the property mapping would consult first
+    NSTimeInterval timeInterval;
+    id<RKValueTransforming> dateTransformer = [[propertyMapping valueTransformersForTransformingFromClass:[string class] toClass:[NSDate class]] firstObject];
+    Class dateTransformerClass = [dateTransformer class];
+    if ((dateTransformerClass == [RKISO8601DateFormatter class] && RKGetTimeIntervalFromISO8601String(string, &timeInterval)) ||
+        (dateTransformerClass == [RKDotNetDateFormatter class] && RKGetTimeIntervalFromDotNetDateString(string, &timeInterval))) {
+        *appliedValueTransformer = dateTransformer;
+        date = [NSDate dateWithTimeIntervalSince1970:timeInterval];
+    } else if (! [propertyMapping transformValue:string toValue:&date ofClass:[NSDate class] appliedValueTransformer:appliedValueTransformer error:error]) {
+        return NO;
+    }
 
-- (NSArray *)relationshipMappings
-{
-    [self cacheMappingsIfNeeded];
-    return _relationshipMappings;
+    // Cache keys are not copied by `NSCache`, so guard against mutable strings
+    if (date) [parsedDateCache setObject:date forKey:[string copy]];
+    *outputValue = date;
+    return YES;
 }
 
-- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPropertyMapping:(RKPropertyMapping *)propertyMapping error:(NSError *__autoreleasing *)error
+- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue withPropertyMappingPlan:(RKPropertyMappingPlan *)plan error:(NSError *__autoreleasing *)error
 {
+    RKPropertyMapping *propertyMapping = plan.propertyMapping;
     if (! inputValue) {
         // We only want to consider the transformation successful and assign the default if the mapping calls for it
         if (propertyMapping.objectMapping.assignsDefaultValueForMissingAttributes) {
@@ -690,36 +937,59 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
             return NO;
         }
     }
-    Class transformedValueClass = propertyMapping.propertyValueClass ?: [self.objectMapping classForKeyPath:propertyMapping.destinationKeyPath];
+    Class transformedValueClass = propertyMapping.propertyValueClass ?: plan.destinationClass;
     if (! transformedValueClass) {
         *outputValue = inputValue;
         return YES;
     }
     RKLogTrace(@"Found transformable value at keyPath '%@'. Transforming from class '%@' to '%@'", propertyMapping.sourceKeyPath, NSStringFromClass([inputValue class]), NSStringFromClass(transformedValueClass));
-    BOOL success = [propertyMapping.valueTransformer transformValue:inputValue toValue:outputValue ofClass:transformedValueClass error:error];
+    RKMappingProfiler *profiler = self.profiler;
+    NSTimeInterval startTime = profiler ? RKMappingProfilerCurrentTime() : 0;
+    BOOL success;
+    id<RKValueTransforming> appliedValueTransformer = nil;
+    if (transformedValueClass == [NSDate class] && [inputValue isKindOfClass:[NSString class]]) {
+        success = [self transformString:inputValue toDate:outputValue withPropertyMapping:propertyMapping appliedValueTransformer:&appliedValueTransformer error:error];
+    } else {
+        success = [propertyMapping transformValue:inputValue toValue:outputValue ofClass:transformedValueClass appliedValueTransformer:&appliedValueTransformer error:error];
+    }
+    if (profiler) [profiler recordTransformationWithValueTransformer:appliedValueTransformer propertyMapping:propertyMapping duration:RKMappingProfilerCurrentTime() - startTime];
     if (! success) RKLogError(@"Failed transformation of value at keyPath '%@' to representation of type '%@': %@", propertyMapping.sourceKeyPath, transformedValueClass, *error);
     return success;
 }
 
-- (BOOL)applyAttributeMapping:(RKAttributeMapping *)attributeMapping withValue:(id)value
+- (BOOL)applyAttributeMappingPlan:(RKPropertyMappingPlan *)plan withValue:(id)value
+{
+    RKMappingProfiler *profiler = self.profiler;
+    if (! profiler) return [self mapAttributeValue:value withPlan:plan];
+
+    NSTimeInterval startTime = RKMappingProfilerCurrentTime();
+    BOOL success = [self mapAttributeValue:value withPlan:plan];
+    NSTimeInterval duration = RKMappingProfilerCurrentTime() - startTime;
+    self.profiledChildDuration += duration;
+    [profiler recordPropertyMapping:plan.propertyMapping stack:self.profilerStack duration:duration];
+    return success;
+}
+
+- (BOOL)mapAttributeValue:(id)value withPlan:(RKPropertyMappingPlan *)plan
 {
     id transformedValue = nil;
     NSError *error = nil;
-    if (! [self transformValue:value toValue:&transformedValue withPropertyMapping:attributeMapping error:&error]) return NO;
+    if (! [self transformValue:value toValue:&transformedValue withPropertyMappingPlan:plan error:&error]) return NO;
 
-    NSString *destinationKeyPath = attributeMapping.destinationKeyPath;
+    RKAttributeMapping *attributeMapping = (RKAttributeMapping *)plan.propertyMapping;
+    NSString *destinationKeyPath = plan.destinationKeyPath;
     id destinationObject = self.destinationObject;
     id delegate = self.delegate;
 
-    if ([delegate respondsToSelector:@selector(mappingOperation:didFindValue:forKeyPath:mapping:)]) {
-        [delegate mappingOperation:self didFindValue:value forKeyPath:attributeMapping.sourceKeyPath mapping:attributeMapping];
+    if (_callbacks & RKMappingOperationDelegateDidFindValue) {
+        [delegate mappingOperation:self didFindValue:value forKeyPath:plan.sourceKeyPath mapping:attributeMapping];
     }
     RKLogTrace(@"Mapping attribute value keyPath '%@' to '%@'", attributeMapping.sourceKeyPath, destinationKeyPath);
     
     // If we have a nil value for a primitive property, we need to coerce it into a KVC usable value or bail out
-    if (transformedValue == nil && RKPropertyInspectorIsPropertyAtKeyPathOfObjectPrimitive(destinationKeyPath, destinationObject)) {
+    if (transformedValue == nil && [self isDestinationPrimitiveForPlan:plan]) {
         RKLogDebug(@"Detected `nil` value transformation for primitive property at keyPath '%@'", destinationKeyPath);
-        transformedValue = RKPrimitiveValueForNilValueOfClass([self.objectMapping classForKeyPath:destinationKeyPath]);
+        transformedValue = RKPrimitiveValueForNilValueOfClass(plan.destinationClass);
         if (! transformedValue) {
             RKLogTrace(@"Skipped mapping of attribute value from keyPath '%@ to keyPath '%@' -- Unable to transform `nil` into primitive value representation", attributeMapping.sourceKeyPath, destinationKeyPath);
             return NO;
@@ -732,8 +1002,10 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     if ([self shouldSetValue:&transformedValue forKeyPath:destinationKeyPath usingMapping:attributeMapping]) {
         RKLogTrace(@"Mapped attribute value from keyPath '%@' to '%@'. Value: %@", attributeMapping.sourceKeyPath, destinationKeyPath, transformedValue);
         
-        if (destinationKeyPath) {
-            [destinationObject setValue:transformedValue forKeyPath:destinationKeyPath];
+        if (_setsPrimitiveValues && plan.canSetPrimitiveValue) {
+            [plan setPrimitiveValue:transformedValue onObject:destinationObject];
+        } else if (destinationKeyPath) {
+            [plan setValue:transformedValue onObject:destinationObject];
         } else {
             if ([destinationObject isKindOfClass:[NSMutableDictionary class]] && [transformedValue isKindOfClass:[NSDictionary class]]) {
                 [destinationObject setDictionary:transformedValue];
@@ -741,12 +1013,12 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
                 [NSException raise:NSInvalidArgumentException format:@"Unable to set value for destination object of type '%@': Can only directly set destination object for `NSMutableDictionary` targets. (transformedValue=%@)", [destinationObject class], transformedValue];
             }
         }
-        if ([delegate respondsToSelector:@selector(mappingOperation:didSetValue:forKeyPath:usingMapping:)]) {
+        if (_callbacks & RKMappingOperationDelegateDidSetValue) {
             [delegate mappingOperation:self didSetValue:transformedValue forKeyPath:destinationKeyPath usingMapping:attributeMapping];
         }
     } else {
         RKLogTrace(@"Skipped mapping of attribute value from keyPath '%@ to keyPath '%@' -- value is unchanged (%@)", attributeMapping.sourceKeyPath, destinationKeyPath, transformedValue);
-        if ([delegate respondsToSelector:@selector(mappingOperation:didNotSetUnchangedValue:forKeyPath:usingMapping:)]) {
+        if (_callbacks & RKMappingOperationDelegateDidNotSetUnchangedValue) {
             [delegate mappingOperation:self didNotSetUnchangedValue:transformedValue forKeyPath:destinationKeyPath usingMapping:attributeMapping];
         }
     }
@@ -757,7 +1029,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 }
 
 // Return YES if we mapped any attributes
-- (BOOL)applyAttributeMappings:(NSArray *)attributeMappings
+- (BOOL)applyAttributeMappingPlans:(NSArray *)attributePlans
 {
     // If we have a nesting substitution value, we have already succeeded
     BOOL appliedMappings = (self.nestedAttributeSubstitutionKey != nil);
@@ -768,35 +1040,17 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
     id sourceObject = self.sourceObject;
 
-    for (RKAttributeMapping *attributeMapping in attributeMappings) {
+    for (RKPropertyMappingPlan *plan in attributePlans) {
         if ([self isCancelled]) return NO;
 
-        NSString *sourceKeyPath = attributeMapping.sourceKeyPath;
-        NSString *destinationKeyPath = attributeMapping.destinationKeyPath;
-        if ([sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] || [destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
+        NSString *sourceKeyPath = plan.sourceKeyPath;
+        if (plan.isNestingAttribute) {
             RKLogTrace(@"Skipping attribute mapping for special keyPath '%@'", sourceKeyPath);
             continue;
         }
 
-        id value = (sourceKeyPath == nil) ? [sourceObject valueForKey:@"self"] : [sourceObject valueForKeyPath:sourceKeyPath];
-        if ([self applyAttributeMapping:attributeMapping withValue:value]) {
-            appliedMappings = YES;
-        } else {
-            id delegate = self.delegate;
-            RKObjectMapping *objectMapping = self.objectMapping;
-
-            if ([delegate respondsToSelector:@selector(mappingOperation:didNotFindValueForKeyPath:mapping:)]) {
-                [delegate mappingOperation:self didNotFindValueForKeyPath:sourceKeyPath mapping:attributeMapping];
-            }
-            RKLogTrace(@"Did not find mappable attribute value keyPath '%@'", sourceKeyPath);
-
-            // Optionally set the default value for missing values
-            if (objectMapping.assignsDefaultValueForMissingAttributes) {
-                [self.destinationObject setValue:[objectMapping defaultValueForAttribute:destinationKeyPath]
-                                      forKeyPath:destinationKeyPath];
-                RKLogTrace(@"Setting nil for missing attribute value at keyPath '%@'", sourceKeyPath);
-            }
-        }
+        id value = (sourceKeyPath == nil) ? [sourceObject valueForKey:@"self"] : RKValueForSourceKeyPathOfPlan(sourceObject, plan);
+        if ([self mapAttributeMappingPlan:plan withSourceValue:value]) appliedMappings = YES;
 
         // Fail out if an error has occurred
         if (self.error) break;
@@ -805,6 +1059,48 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return appliedMappings;
 }
 
+// Applies an attribute mapping plan to a value read from the source object, assigning the default value if the value could not be mapped. Returns YES if the value was mapped
+- (BOOL)mapAttributeMappingPlan:(RKPropertyMappingPlan *)plan withSourceValue:(id)value
+{
+    if ([self applyAttributeMappingPlan:plan withValue:value]) return YES;
+
+    NSString *sourceKeyPath = plan.sourceKeyPath;
+    RKObjectMapping *objectMapping = self.objectMapping;
+    if (_callbacks & RKMappingOperationDelegateDidNotFindValue) {
+        [self.delegate mappingOperation:self didNotFindValueForKeyPath:sourceKeyPath mapping:(RKAttributeMapping *)plan.propertyMapping];
+    }
+    RKLogTrace(@"Did not find mappable attribute value keyPath '%@'", sourceKeyPath);
+
+    // Optionally set the default value for missing values
+    if (objectMapping.assignsDefaultValueForMissingAttributes) {
+        [plan setValue:[objectMapping defaultValueForAttribute:plan.destinationKeyPath] onObject:self.destinationObject];
+        RKLogTrace(@"Setting nil for missing attribute value at keyPath '%@'", sourceKeyPath);
+    }
+    return NO;
+}
+
+// Applies the single key attribute mappings with the generated mapping function of the plan. Returns NO if there is no function or it cannot be used by the receiver
+- (BOOL)applyGeneratedMappingFunctionWithAppliedMappings:(BOOL *)appliedMappings
+{
+    RKGeneratedMappingFunction generatedMappingFunction = self.plan.generatedMappingFunction;
+    if (! generatedMappingFunction) return NO;
+
+    // Generated functions do not report individual values, so they are bypassed whenever somebody is listening for them
+    if ((_callbacks & RKMappingOperationDelegateValueCallbacks) || self.profiler || self.nestedAttributeSubstitutionKey) return NO;
+
+    // Generated functions invoke the public accessors, which emit change notifications that primitive assignment avoids
+    if (self.setsPrimitiveValues) return NO;
+
+    // Generated functions do not report which values were changed
+    if (self.changeSet) return NO;
+
+    id representation = self.sourceObject;
+    if (object_getClass(representation) == [RKMappingSourceObject class]) representation = [(RKMappingSourceObject *)representation object];
+    if (! [representation isKindOfClass:[NSDictionary class]]) return NO;
+
+    return generatedMappingFunction(self, representation, self.destinationObject, appliedMappings);
+}
+
 - (BOOL)mapNestedObject:(id)anObject toObject:(id)anotherObject parent:(id)parentSourceObject withRelationshipMapping:(RKRelationshipMapping *)relationshipMapping metadataList:(NSArray *)metadataList
 {
     NSAssert(anObject, @"Cannot map nested object without a nested source object");
@@ -812,13 +1108,26 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     NSAssert(relationshipMapping, @"Cannot map a nested object relationship without a relationship mapping");
 
     RKLogTrace(@"Performing nested object mapping using mapping %@ for data: %@", relationshipMapping, anObject);
-    RKMappingOperation *subOperation = [[RKMappingOperation alloc] initWithSourceObject:anObject destinationObject:anotherObject mapping:relationshipMapping.mapping metadataList:metadataList];
+    RKMappingOperation *subOperation = self.reusableSubOperation;
+    if (subOperation) {
+        [subOperation prepareForReuseWithSourceObject:anObject destinationObject:anotherObject mapping:relationshipMapping.mapping metadataList:metadataList];
+    } else {
+        subOperation = [[RKMappingOperation alloc] initWithSourceObject:anObject destinationObject:anotherObject mapping:relationshipMapping.mapping metadataList:metadataList];
+        if (self.reusesSubOperations) self.reusableSubOperation = subOperation;
+    }
     subOperation.dataSource = self.dataSource;
     subOperation.delegate = self.delegate;
+    subOperation.callbacks = self.callbacks;
+    subOperation.callbacksResolved = YES;
     subOperation.parentSourceObject = parentSourceObject;
     subOperation.rootSourceObject = self.rootSourceObject;
     subOperation.newDestinationObject = YES;
+    subOperation.profiler = self.profiler;
+    subOperation.profilerParentStack = self.profilerStack;
+    subOperation.profilerKeyPath = relationshipMapping.sourceKeyPath;
+    subOperation.changeSet = self.changeSet;
     [subOperation start];
+    if (self.profiler) self.profiledChildDuration += subOperation.profiledDuration;
     
     if (subOperation.error) {
         RKLogWarning(@"WARNING: Failed mapping nested object: %@", [subOperation.error localizedDescription]);
@@ -838,7 +1147,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 {
     if (relationshipMapping.assignmentPolicy == RKReplaceAssignmentPolicy) {
         id dataSource = self.dataSource;
-        if ([dataSource respondsToSelector:@selector(mappingOperation:deleteExistingValueOfRelationshipWithMapping:error:)]) {
+        if (_callbacks & RKMappingOperationDataSourceDeleteExistingRelationshipValue) {
             NSError *error = nil;
             BOOL success = [dataSource mappingOperation:self deleteExistingValueOfRelationshipWithMapping:relationshipMapping error:&error];
             if (! success) {
@@ -854,16 +1163,11 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return YES;
 }
 
-- (BOOL)mapOneToOneRelationshipWithValue:(id)value mapping:(RKRelationshipMapping *)relationshipMapping
+- (BOOL)mapOneToOneRelationshipWithValue:(id)value plan:(RKPropertyMappingPlan *)plan
 {
-    static dispatch_once_t onceToken;
-    static NSDictionary *noIndexMetadata;
-    dispatch_once(&onceToken, ^{
-        noIndexMetadata = @{ @"mapping" : @{ @"collectionIndex" : [NSNull null] } };
-    });
-
     // One to one relationship
-    NSString *destinationKeyPath = relationshipMapping.destinationKeyPath;
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plan.propertyMapping;
+    NSString *destinationKeyPath = plan.destinationKeyPath;
     RKLogDebug(@"Mapping one to one relationship value at keyPath '%@' to '%@'", relationshipMapping.sourceKeyPath, destinationKeyPath);
     
     if (relationshipMapping.assignmentPolicy == RKUnionAssignmentPolicy) {
@@ -884,15 +1188,14 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         return NO;
     }
 
-    NSArray *subOperationMetadata = RKInsertInMetadataList(self.metadataList, noIndexMetadata, nil);
-    [self mapNestedObject:value toObject:destinationObject parent:parentSourceObject withRelationshipMapping:relationshipMapping metadataList:subOperationMetadata];
+    [self mapNestedObject:value toObject:destinationObject parent:parentSourceObject withRelationshipMapping:relationshipMapping metadataList:[self metadataListForUnindexedSubOperations]];
 
     // If the relationship has changed, set it
     if ([self shouldSetValue:&destinationObject forKeyPath:destinationKeyPath usingMapping:relationshipMapping]) {
         RKLogTrace(@"Mapped relationship object from keyPath '%@' to '%@'. Value: %@", relationshipMapping.sourceKeyPath, destinationKeyPath, destinationObject);
-        [self.destinationObject setValue:destinationObject forKeyPath:destinationKeyPath];
+        [plan setValue:destinationObject onObject:self.destinationObject];
     } else {
-        if ([self.delegate respondsToSelector:@selector(mappingOperation:didNotSetUnchangedValue:forKeyPath:usingMapping:)]) {
+        if (_callbacks & RKMappingOperationDelegateDidNotSetUnchangedValue) {
             [self.delegate mappingOperation:self didNotSetUnchangedValue:destinationObject forKeyPath:destinationKeyPath usingMapping:relationshipMapping];
         }
     }
@@ -922,9 +1225,10 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return YES;
 }
 
-- (BOOL)mapOneToManyRelationshipWithValue:(id)value mapping:(RKRelationshipMapping *)relationshipMapping
+- (BOOL)mapOneToManyRelationshipWithValue:(id)value plan:(RKPropertyMappingPlan *)plan
 {
-    NSString *destinationKeyPath = relationshipMapping.destinationKeyPath;
+    RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plan.propertyMapping;
+    NSString *destinationKeyPath = plan.destinationKeyPath;
     
     // One to many relationship
     RKLogDebug(@"Mapping one to many relationship value at keyPath '%@' to '%@'", relationshipMapping.sourceKeyPath, destinationKeyPath);
@@ -954,10 +1258,12 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
     RKMapping *relationshipDestinationMapping = relationshipMapping.mapping;
     id parentSourceObject = [self parentObjectForRelationshipMapping:relationshipMapping];
-    RKMappingIndexMetadata *indexMetadata = [RKMappingIndexMetadata new];
-    NSArray *subOperationMetadata = RKInsertInMetadataList(self.metadataList, indexMetadata, nil);
+    NSArray *subOperationMetadata = [self metadataListForIndexedSubOperations];
+    RKMappingIndexMetadata *indexMetadata = self.indexMetadata;
+    NSArray *destinationObjects = [value isKindOfClass:[NSArray class]] ? [self destinationObjectsForMappingRepresentations:value parentRepresentation:parentSourceObject withMapping:relationshipDestinationMapping inRelationship:relationshipMapping] : nil;
     [value enumerateObjectsUsingBlock:^(id nestedObject, NSUInteger collectionIndex, BOOL *stop) {
-        id mappableObject = [self destinationObjectForMappingRepresentation:nestedObject parentRepresentation:parentSourceObject withMapping:relationshipDestinationMapping inRelationship:relationshipMapping];
+        id mappableObject = destinationObjects ? destinationObjects[collectionIndex] : [self destinationObjectForMappingRepresentation:nestedObject parentRepresentation:parentSourceObject withMapping:relationshipDestinationMapping inRelationship:relationshipMapping];
+        if (mappableObject == [NSNull null]) mappableObject = nil;
         if (mappableObject) {
             indexMetadata.collectionIndex = collectionIndex;
             if ([self mapNestedObject:nestedObject toObject:mappableObject parent:parentSourceObject withRelationshipMapping:relationshipMapping metadataList:subOperationMetadata]) {
@@ -970,16 +1276,16 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
     id valueForRelationship = nil;
     NSError *error = nil;
-    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPropertyMapping:relationshipMapping error:&error]) return NO;
+    if (! [self transformValue:relationshipCollection toValue:&valueForRelationship withPropertyMappingPlan:plan error:&error]) return NO;
 
     // If the relationship has changed, set it
     if ([self shouldSetValue:&valueForRelationship forKeyPath:destinationKeyPath usingMapping:relationshipMapping]) {
         if (! [self mapCoreDataToManyRelationshipValue:valueForRelationship withMapping:relationshipMapping]) {
             RKLogTrace(@"Mapped relationship object from keyPath '%@' to '%@'. Value: %@", relationshipMapping.sourceKeyPath, destinationKeyPath, valueForRelationship);
-            [self.destinationObject setValue:valueForRelationship forKeyPath:destinationKeyPath];
+            [plan setValue:valueForRelationship onObject:self.destinationObject];
         }
     } else {
-        if ([self.delegate respondsToSelector:@selector(mappingOperation:didNotSetUnchangedValue:forKeyPath:usingMapping:)]) {
+        if (_callbacks & RKMappingOperationDelegateDidNotSetUnchangedValue) {
             [self.delegate mappingOperation:self didNotSetUnchangedValue:valueForRelationship forKeyPath:destinationKeyPath usingMapping:relationshipMapping];
         }
 
@@ -998,15 +1304,16 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     id destinationObject = self.destinationObject;
     id delegate = self.delegate;
 
-    for (RKRelationshipMapping *relationshipMapping in [self relationshipMappings]) {
+    for (RKPropertyMappingPlan *plan in self.plan.relationshipPlans) {
         if ([self isCancelled]) return NO;
         
-        NSString *sourceKeyPath = relationshipMapping.sourceKeyPath;
-        NSString *destinationKeyPath = relationshipMapping.destinationKeyPath;
+        RKRelationshipMapping *relationshipMapping = (RKRelationshipMapping *)plan.propertyMapping;
+        NSString *sourceKeyPath = plan.sourceKeyPath;
+        NSString *destinationKeyPath = plan.destinationKeyPath;
         id value = nil;
 
         if (sourceKeyPath) {
-            value = [sourceObject valueForKeyPath:sourceKeyPath];
+            value = RKValueForSourceKeyPathOfPlan(sourceObject, plan);
         } else {
             // The nil source keyPath indicates that we want to map directly from the parent representation
             value = sourceObject;
@@ -1040,7 +1347,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
         // nil out the property if necessary
         if (value == nil) {
-            Class relationshipClass = [parentObjectMapping classForKeyPath:destinationKeyPath];
+            Class relationshipClass = plan.destinationClass;
             BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
             RKAssignmentPolicy assignmentPolicy = relationshipMapping.assignmentPolicy;
             if (assignmentPolicy == RKUnionAssignmentPolicy && mappingToCollection) {
@@ -1058,7 +1365,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
             if ([self shouldSetValue:&value forKeyPath:destinationKeyPath usingMapping:relationshipMapping]) {
                 RKLogTrace(@"Setting nil for relationship value at keyPath '%@'", sourceKeyPath);
-                [destinationObject setValue:value forKeyPath:destinationKeyPath];
+                [plan setValue:value onObject:destinationObject];
             }
 
             continue;
@@ -1081,7 +1388,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         }
 
         // Handle case where incoming content is a single object, but we want a collection
-        Class relationshipClass = [parentObjectMapping classForKeyPath:destinationKeyPath];
+        Class relationshipClass = plan.destinationClass;
         BOOL mappingToCollection = RKClassIsCollection(relationshipClass);
         BOOL objectIsCollection = RKObjectIsCollection(value);
         if (mappingToCollection && !objectIsCollection) {
@@ -1100,17 +1407,21 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
             }
         }
 
+        RKMappingProfiler *profiler = self.profiler;
+        NSTimeInterval startTime = profiler ? RKMappingProfilerCurrentTime() : 0;
         BOOL setValueForRelationship;
         if (objectIsCollection) {
-            setValueForRelationship = [self mapOneToManyRelationshipWithValue:value mapping:relationshipMapping];
+            setValueForRelationship = [self mapOneToManyRelationshipWithValue:value plan:plan];
         } else {
-            setValueForRelationship = [self mapOneToOneRelationshipWithValue:value mapping:relationshipMapping];
+            setValueForRelationship = [self mapOneToOneRelationshipWithValue:value plan:plan];
         }
+        // The time spent in nested objects is recorded in their own stacks
+        if (profiler) [profiler recordPropertyMapping:relationshipMapping stack:nil duration:RKMappingProfilerCurrentTime() - startTime];
 
         if (! setValueForRelationship) continue;
 
         // Notify the delegate
-        if ([delegate respondsToSelector:@selector(mappingOperation:didSetValue:forKeyPath:usingMapping:)]) {
+        if (_callbacks & RKMappingOperationDelegateDidSetValue) {
             id setValue = [destinationObject valueForKeyPath:destinationKeyPath];
             [delegate mappingOperation:self didSetValue:setValue forKeyPath:destinationKeyPath usingMapping:relationshipMapping];
         }
@@ -1122,10 +1433,38 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     return mappingsApplied > 0;
 }
 
+// Fingerprints the values read by the property mappings of the object mapping. Mappings involving the keys of the representation or the representation itself (a `nil` source key path) cover the entire representation.
+- (NSNumber *)representationFingerprint
+{
+    static id missingValue;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        missingValue = [NSObject new];
+    });
+
+    id sourceObject = self.sourceObject;
+    id representation = (object_getClass(sourceObject) == [RKMappingSourceObject class]) ? [(RKMappingSourceObject *)sourceObject object] : sourceObject;
+    RKObjectMappingPlan *executionPlan = self.objectMapping.executionPlan;
+    if (executionPlan.attributePlanFromKeyOfRepresentation || executionPlan.attributePlanToKeyOfRepresentation) {
+        return @(RKFingerprintForObject(representation));
+    }
+
+    // A missing value is distinguished from an explicit null, as only the latter is assigned to the destination object
+    NSMutableArray *values = [NSMutableArray array];
+    for (NSArray *plans in @[ executionPlan.keyAttributePlans, executionPlan.keyPathAttributePlans, executionPlan.relationshipPlans ]) {
+        for (RKPropertyMappingPlan *plan in plans) {
+            if (plan.sourceKeyPath == nil) return @(RKFingerprintForObject(representation));
+            [values addObject:RKValueForSourceKeyPathOfPlan(sourceObject, plan) ?: missingValue];
+        }
+    }
+    return @(RKFingerprintForObject(values));
+}
+
 - (void)applyNestedMappings
 {
-    RKObjectMapping *objectMapping = self.objectMapping;
-    RKAttributeMapping *attributeMapping = [objectMapping mappingForSourceKeyPath:RKObjectMappingNestingAttributeKeyName];
+    RKObjectMappingPlan *executionPlan = self.objectMapping.executionPlan;
+    RKPropertyMappingPlan *attributePlan = executionPlan.attributePlanFromKeyOfRepresentation;
+    RKPropertyMapping *attributeMapping = attributePlan.propertyMapping;
     if (attributeMapping) {
         RKLogDebug(@"Found nested mapping definition to attribute '%@'", attributeMapping.destinationKeyPath);
         id attributeValue = [[self.sourceObject allKeys] lastObject];
@@ -1133,14 +1472,14 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
             RKLogDebug(@"Found nesting value of '%@' for attribute '%@'", attributeValue, attributeMapping.destinationKeyPath);
             self.nestedAttributeSubstitutionKey = attributeMapping.destinationKeyPath;
             self.nestedAttributeSubstitutionValue = attributeValue;
-            [self applyAttributeMapping:attributeMapping withValue:attributeValue];
+            [self applyAttributeMappingPlan:attributePlan withValue:attributeValue];
         } else {
             RKLogWarning(@"Unable to find nesting value for attribute '%@'", attributeMapping.destinationKeyPath);
         }
     }
     
     // Serialization
-    attributeMapping = [objectMapping mappingForDestinationKeyPath:RKObjectMappingNestingAttributeKeyName];
+    attributeMapping = executionPlan.attributePlanToKeyOfRepresentation.propertyMapping;
     if (attributeMapping) {
         RKLogDebug(@"Found nested mapping definition to attribute '%@'", attributeMapping.destinationKeyPath);
         id attributeValue = [self.sourceObject valueForKeyPath:attributeMapping.sourceKeyPath];
@@ -1162,16 +1501,47 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 
 - (void)start
 {
+    RKMappingProfiler *profiler = self.profiler;
+    if (! profiler) {
+        [self main];
+        return;
+    }
+
+    self.profilerStack = nil;
+    self.profiledChildDuration = 0;
+    NSTimeInterval startTime = RKMappingProfilerCurrentTime();
     [self main];
+    self.profiledDuration = RKMappingProfilerCurrentTime() - startTime;
+    if (self.profilerStack) {
+        [profiler recordMappingWithObjectMapping:self.objectMapping stack:self.profilerStack duration:self.profiledDuration selfDuration:self.profiledDuration - self.profiledChildDuration];
+    }
 }
 
 - (void)main
 {
     if ([self isCancelled]) return;
 
+    // Sub-operations inherit the callbacks resolved by their parent operation
+    if (! self.callbacksResolved) {
+        self.callbacks = RKMappingOperationCallbacksForDelegateAndDataSource(self.delegate, self.dataSource);
+        self.callbacksResolved = YES;
+    }
+    RKMappingOperationCallbacks callbacks = self.callbacks;
+    self.reusesSubOperations = RKMappingOperationCanReuseSubOperations(self.delegate, self.dataSource);
+    if (! self.reusesSubOperations) self.reusableSubOperation = nil;
+
     // Handle metadata
     id parentSourceObject = self.parentSourceObject;
-    id sourceObject = [[RKMappingSourceObject alloc] initWithObject:self.sourceObject parentObject:parentSourceObject rootObject:self.rootSourceObject metadata:self.metadataList];
+    RKMappingSourceObject *sourceObject = self.reusableSourceObject;
+    if (sourceObject) {
+        sourceObject.object = self.sourceObject;
+        sourceObject.parentObject = parentSourceObject;
+        sourceObject.rootObject = self.rootSourceObject;
+        sourceObject.metadataList = self.metadataList;
+        self.reusableSourceObject = nil;
+    } else {
+        sourceObject = [[RKMappingSourceObject alloc] initWithObject:self.sourceObject parentObject:parentSourceObject rootObject:self.rootSourceObject metadata:self.metadataList];
+    }
     self.sourceObject = sourceObject;
 
     RKLogDebug(@"Starting mapping operation...");
@@ -1193,11 +1563,26 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         self.newDestinationObject = YES;
     }
     
-    self.collectsMappingInfo = (![dataSource respondsToSelector:@selector(mappingOperationShouldCollectMappingInfo:)] ||
+    self.collectsMappingInfo = (!(callbacks & RKMappingOperationDataSourceShouldCollectMappingInfo) ||
                                 [dataSource mappingOperationShouldCollectMappingInfo:self]);
 
-    self.shouldSetUnchangedValues = ([self.dataSource respondsToSelector:@selector(mappingOperationShouldSetUnchangedValues:)] &&
-                                     [self.dataSource mappingOperationShouldSetUnchangedValues:self]);
+    self.shouldSetUnchangedValues = ((callbacks & RKMappingOperationDataSourceShouldSetUnchangedValues) &&
+                                     [dataSource mappingOperationShouldSetUnchangedValues:self]);
+
+    // Objects that nobody observes yet, such as freshly inserted managed objects, are assigned their attributes without change notifications
+    self.setsPrimitiveValues = ((callbacks & RKMappingOperationDataSourceShouldSetPrimitiveValues) &&
+                                [dataSource mappingOperationShouldSetPrimitiveValues:self] &&
+                                [self.destinationObject observationInfo] == NULL);
+
+    // The change set reports whether the data source created the destination object and which key paths were assigned
+    BOOL insertedDestinationObject = NO;
+    if (self.changeSet) {
+        self.changedKeyPaths = [NSMutableSet set];
+        insertedDestinationObject = (self.isNewDestinationObject &&
+                                     (!(callbacks & RKMappingOperationDataSourceDidInsertDestinationObject) || [dataSource mappingOperationDidInsertDestinationObject:self]));
+    } else {
+        self.changedKeyPaths = nil;
+    }
     
     // Determine the concrete mapping if we were initialized with a dynamic mapping
     if ([mapping isKindOfClass:[RKDynamicMapping class]]) {
@@ -1209,7 +1594,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         }
         RKLogDebug(@"RKObjectMappingOperation was initialized with a dynamic mapping. Determined concrete mapping = %@", objectMapping);
 
-        if ([delegate respondsToSelector:@selector(mappingOperation:didSelectObjectMapping:forDynamicMapping:)]) {
+        if (callbacks & RKMappingOperationDelegateDidSelectObjectMapping) {
             [delegate mappingOperation:self didSelectObjectMapping:objectMapping forDynamicMapping:(RKDynamicMapping *)mapping];
         }
         if (self.collectsMappingInfo) {
@@ -1221,15 +1606,20 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
             self.mappingInfo = [[RKMappingInfo alloc] initWithObjectMapping:objectMapping dynamicMapping:nil];
         }
     }
-    
-    BOOL canSkipAttributes = [dataSource respondsToSelector:@selector(mappingOperationShouldSkipAttributeMapping:)] && [dataSource mappingOperationShouldSkipAttributeMapping:self];
-    BOOL canSkipRelationships = [dataSource respondsToSelector:@selector(mappingOperationShouldSkipRelationshipMapping:)] && [dataSource mappingOperationShouldSkipRelationshipMapping:self];
-    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSkipRelationshipMapping:)]) {
-        canSkipRelationships = [dataSource mappingOperationShouldSkipRelationshipMapping:self];
+    if (self.profiler && objectMapping) {
+        self.profilerStack = [self.profiler stackByPushingFrameWithKeyPath:self.profilerKeyPath objectMapping:objectMapping ontoStack:self.profilerParentStack];
     }
-    if ([dataSource respondsToSelector:@selector(mappingOperationShouldSkipAttributeMapping:)]) {
-        canSkipAttributes = [dataSource mappingOperationShouldSkipAttributeMapping:self];
+    
+    // Skip the mapping entirely if the destination object was last mapped from identical content. Managed objects are never fingerprinted, as a stored fingerprint would survive refreshes, rollbacks and merges of the object
+    NSNumber *fingerprint = (objectMapping.fingerprintsRepresentations && ! RKIsManagedObject(self.destinationObject)) ? [self representationFingerprint] : nil;
+    if (fingerprint && [[RKRepresentationFingerprintsForObject(self.destinationObject, NO) objectForKey:objectMapping] isEqualToNumber:fingerprint]) {
+        RKLogDebug(@"Skipping mapping operation: the representation is unchanged since the destination object was last mapped with %@", objectMapping);
+        [self.changeSet recordMappingOfObject:self.destinationObject inserted:insertedDestinationObject changedKeyPaths:nil];
+        return;
     }
+
+    BOOL canSkipAttributes = (callbacks & RKMappingOperationDataSourceShouldSkipAttributeMapping) && [dataSource mappingOperationShouldSkipAttributeMapping:self];
+    BOOL canSkipRelationships = (callbacks & RKMappingOperationDataSourceShouldSkipRelationshipMapping) && [dataSource mappingOperationShouldSkipRelationshipMapping:self];
     if (!canSkipRelationships || !canSkipAttributes) {
         BOOL foundNoSimpleAttributes = NO;
         BOOL foundNoRelationships = NO;
@@ -1237,16 +1627,20 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         if (!canSkipAttributes) {
             [self applyNestedMappings];
             if ([self isCancelled]) return;
-            foundNoSimpleAttributes = ![self applyAttributeMappings:[self simpleAttributeMappings]];
+            BOOL appliedSimpleAttributes = NO;
+            if (! [self applyGeneratedMappingFunctionWithAppliedMappings:&appliedSimpleAttributes]) {
+                appliedSimpleAttributes = [self applyAttributeMappingPlans:self.plan.keyAttributePlans];
+            }
+            foundNoSimpleAttributes = ! appliedSimpleAttributes;
         }
         if (!canSkipRelationships) {
             if ([self isCancelled]) return;
-            foundNoRelationships = [[self relationshipMappings] count] ? ![self applyRelationshipMappings] : YES;
+            foundNoRelationships = [self.plan.relationshipPlans count] ? ![self applyRelationshipMappings] : YES;
         }
         if (!canSkipAttributes) {
             if ([self isCancelled]) return;
             // NOTE: We map key path attributes last to allow you to map across the object graphs for objects created/updated by the relationship mappings
-            foundNoKeyPathAttributes = ![self applyAttributeMappings:[self keyPathAttributeMappings]];
+            foundNoKeyPathAttributes = ![self applyAttributeMappingPlans:self.plan.keyPathAttributePlans];
         }
         if (foundNoSimpleAttributes && foundNoRelationships && foundNoKeyPathAttributes) {
             // We did not find anything to do
@@ -1257,7 +1651,7 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
     
         // We did some mapping work, if there's no error let's commit our changes to the data source
         if (self.error == nil) {
-            if ([dataSource respondsToSelector:@selector(commitChangesForMappingOperation:error:)]) {
+            if (callbacks & RKMappingOperationDataSourceCommitChanges) {
                 NSError *error = nil;
                 BOOL success = [dataSource commitChangesForMappingOperation:self error:&error];
                 if (! success) {
@@ -1267,8 +1661,17 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
         }
     }
 
+    if (fingerprint && ! self.error) {
+        [RKRepresentationFingerprintsForObject(self.destinationObject, YES) setObject:fingerprint forKey:objectMapping];
+    }
+
+    if (self.changeSet && ! self.error) {
+        [self.changeSet recordMappingOfObject:self.destinationObject inserted:insertedDestinationObject changedKeyPaths:self.changedKeyPaths];
+    }
+    self.changedKeyPaths = nil;
+
     if (self.error) {
-        if ([delegate respondsToSelector:@selector(mappingOperation:didFailWithError:)]) {
+        if (callbacks & RKMappingOperationDelegateDidFailWithError) {
             [delegate mappingOperation:self didFailWithError:self.error];
         }
 
@@ -1292,3 +1695,36 @@ static NSArray *RKInsertInMetadataList(NSArray *list, id metadata1, id metadata2
 }
 
 @end
+
+#pragma mark - Generated Mapping Support
+
+BOOL RKGeneratedMappingShouldSetUnchangedValues(RKMappingOperation *operation)
+{
+    return operation.shouldSetUnchangedValues;
+}
+
+BOOL RKGeneratedMappingValidateValue(RKMappingOperation *operation, id *value, NSString *key)
+{
+    return [operation validateValue:value atKeyPath:key];
+}
+
+void RKGeneratedMappingDidMapAttribute(RKMappingOperation *operation, NSUInteger index)
+{
+    if (operation.collectsMappingInfo) {
+        RKPropertyMappingPlan *plan = operation.plan.keyAttributePlans[index];
+        [operation.mappingInfo addPropertyMapping:plan.propertyMapping];
+    }
+}
+
+BOOL RKGeneratedMappingApplyAttribute(RKMappingOperation *operation, NSUInteger index)
+{
+    RKPropertyMappingPlan *plan = operation.plan.keyAttributePlans[index];
+    id sourceObject = operation.sourceObject;
+    id value = (plan.sourceKeyPath == nil) ? [sourceObject valueForKey:@"self"] : RKValueForSourceKeyPathOfPlan(sourceObject, plan);
+    return [operation mapAttributeMappingPlan:plan withSourceValue:value];
+}
+
+BOOL RKGeneratedMappingApplyAttributeValue(RKMappingOperation *operation, NSUInteger index, id value)
+{
+    return [operation mapAttributeMappingPlan:operation.plan.keyAttributePlans[index] withSourceValue:value];
+}
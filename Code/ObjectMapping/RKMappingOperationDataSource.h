@@ -63,6 +63,21 @@
  */
 - (id)mappingOperation:(RKMappingOperation *)mappingOperation targetObjectForMapping:(RKObjectMapping *)mapping inRelationship:(RKRelationshipMapping *)relationshipMapping;
 
+/**
+ Asks the data source for the target objects of the elements of a to-many relationship, given the representations of all the elements that are to be mapped with the same object mapping.
+
+ Data sources that retrieve target objects from a persistent store should implement this method to resolve the whole collection with a single query rather than one query per element. The mapping operation invokes this method before mapping any of the elements, so the data source is responsible for returning the same target object for elements that identify the same object. Elements for which `mappingOperation:targetObjectForMapping:inRelationship:` returns an object are not included in the representations.
+
+ If not implemented or it returns `nil`, then the `mappingOperation:targetObjectForRepresentation:withMapping:inRelationship:` method will be called for each element.
+
+ @param mappingOperation The mapping operation requesting the target objects.
+ @param representations An array of dictionary representations of the properties to be mapped onto the retrieved target objects.
+ @param mapping The object mapping to be used to perform a mapping from the representations to the target objects.
+ @param relationshipMapping The relationship mapping for which the target objects are being retrieved.
+ @return An array containing a key-value coding compliant target object for each representation in the same order, with `NSNull` in place of representations that should not be mapped, or `nil` to retrieve the target objects individually.
+ */
+- (NSArray *)mappingOperation:(RKMappingOperation *)mappingOperation targetObjectsForRepresentations:(NSArray *)representations withMapping:(RKObjectMapping *)mapping inRelationship:(RKRelationshipMapping *)relationshipMapping;
+
 
 /**
  Tells the data source to commit any changes to the underlying data store.
@@ -93,6 +108,28 @@
  */
 - (BOOL)mappingOperationShouldSetUnchangedValues:(RKMappingOperation *)mappingOperation;
 
+/**
+ Asks the data source if the mapping operation should assign the attributes of its destination object with `setPrimitiveValue:forKey:`, bypassing the public accessors and the key-value observing change notifications they emit. This is only appropriate for managed objects that the data source has just inserted, which nobody can be observing yet and whose values are persisted in full when the context is saved.
+
+ Primitive assignment is only used for attributes of the entity that the managed object class declares `@dynamic`, and never for destination objects that have registered observers. Validation and the delegate callbacks of the mapping operation are unaffected.
+
+ If this method is not implemented by the data source, then the mapping operation defaults to `NO`.
+
+ @param mappingOperation The mapping operation that is querying the data source.
+ @return `YES` if the mapping operation should assign attribute values with primitive accessors, else `NO`.
+ */
+- (BOOL)mappingOperationShouldSetPrimitiveValues:(RKMappingOperation *)mappingOperation;
+
+/**
+ Asks the data source if it created the destination object of the mapping operation, as opposed to retrieving an existing object. The answer determines if the object is reported as inserted in the change set of the mapping operation.
+
+ This method is only invoked for mapping operations that record a `changeSet` and whose `isNewDestinationObject` is `YES`. If it is not implemented by the data source, then the mapping operation considers all destination objects provided by the data source to be inserted.
+
+ @param mappingOperation The mapping operation that is querying the data source.
+ @return `YES` if the data source created the destination object of the mapping operation, else `NO`.
+ */
+- (BOOL)mappingOperationDidInsertDestinationObject:(RKMappingOperation *)mappingOperation;
+
 /**
  **Deprecated in v0.26.0**
  Asks the data source if it should skip mapping. This method can significantly improve performance if, for example, the data source has determined that the properties in the representation are not newer than the current target object's properties. See `modificationAttribute` in `RKEntityMapping` for an example of when skipping property mapping would be appropriate.
@@ -0,0 +1,123 @@
+//
+//  RKMappingProfiler.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import <RKValueTransformers/RKValueTransformers.h>
+
+@class RKObjectMapping, RKPropertyMapping;
+
+/**
+ Returns a monotonic timestamp in seconds, suitable for measuring the durations recorded by an `RKMappingProfiler`.
+ */
+NSTimeInterval RKMappingProfilerCurrentTime(void);
+
+/**
+ The `RKMappingProfiler` class accumulates the time spent mapping object representations, broken down by object mapping, property mapping and value transformer.
+
+ A profiler is enabled by assigning it to the `profiler` property of an `RKMapperOperation` or of an `RKMappingOperation`, which propagate it to the operations mapping nested objects. The profiler records:
+
+ 1. For each `RKObjectMapping`, the number of objects mapped, the total time spent mapping them (including their nested objects) and the time spent mapping them exclusive of the nested objects.
+ 1. For each `RKPropertyMapping`, the number of times it was applied, the time spent applying it and the number of value transformations it performed.
+ 1. For each value transformer, the number of transformations it performed and the time spent performing them.
+
+ The measurements are also recorded as stacks of nested mappings, which can be exported in the collapsed stack format consumed by flame graph tools. A profiler may be shared by operations executing concurrently. Profiling adds overhead to every mapped object and property, so it should only be enabled while investigating mapping performance.
+ */
+@interface RKMappingProfiler : NSObject
+
+///---------------------------------
+/// @name Accessing the Measurements
+///---------------------------------
+
+/**
+ Returns a JSON compatible dictionary of the measurements recorded by the receiver.
+
+ The dictionary contains arrays of measurements under the `objectMappings`, `propertyMappings` and `valueTransformers` keys, each sorted by descending duration. Durations are expressed in seconds.
+
+ @return A dictionary representation of the measurements.
+ */
+- (NSDictionary *)dictionaryRepresentation;
+
+/**
+ Returns the measurements recorded by the receiver serialized as JSON.
+
+ @param error A pointer to an error object that is set if the measurements could not be serialized.
+ @return The JSON serialization of `dictionaryRepresentation`, or `nil` if an error occurred.
+ */
+- (NSData *)JSONDataWithError:(NSError **)error;
+
+/**
+ Returns the time recorded for each stack of nested mappings in the collapsed stack format.
+
+ Each line consists of a stack of frames separated by semicolons, followed by a space and the number of microseconds spent in the innermost frame of the stack. The frames of mapped objects are named after the key path of the representation and the class of the object, i.e. `users:User;friends:User`. The frames of attributes are named after their source key path.
+
+ @return A string containing one line per recorded stack, sorted by stack.
+ */
+- (NSString *)collapsedStackRepresentation;
+
+/**
+ Discards all measurements recorded by the receiver.
+ */
+- (void)reset;
+
+///-------------------------------
+/// @name Recording Measurements
+///-------------------------------
+
+/**
+ Returns the stack of a mapped object, given the stack of its parent object.
+
+ @param keyPath The key path of the representation of the object, or `nil` for the root representation.
+ @param objectMapping The object mapping with which the object is mapped.
+ @param stack The stack of the parent object, or `nil` if the object is not nested.
+ @return The stack of the mapped object.
+ */
+- (NSString *)stackByPushingFrameWithKeyPath:(NSString *)keyPath objectMapping:(RKObjectMapping *)objectMapping ontoStack:(NSString *)stack;
+
+/**
+ Records the mapping of an object.
+
+ @param objectMapping The object mapping with which the object was mapped.
+ @param stack The stack of the mapped object, as returned by `stackByPushingFrameWithKeyPath:objectMapping:ontoStack:`.
+ @param duration The time spent mapping the object, including its nested objects.
+ @param selfDuration The time spent mapping the object, exclusive of its nested objects and its attributes.
+ */
+- (void)recordMappingWithObjectMapping:(RKObjectMapping *)objectMapping stack:(NSString *)stack duration:(NSTimeInterval)duration selfDuration:(NSTimeInterval)selfDuration;
+
+/**
+ Records the application of a property mapping.
+
+ @param propertyMapping The property mapping that was applied.
+ @param stack The stack of the object whose property was mapped, or `nil` if the time spent is recorded in the stacks of nested objects, as for relationship mappings.
+ @param duration The time spent applying the property mapping.
+ */
+- (void)recordPropertyMapping:(RKPropertyMapping *)propertyMapping stack:(NSString *)stack duration:(NSTimeInterval)duration;
+
+/**
+ Records the transformation of a value for a property mapping.
+
+ Transformations are attributed to the concrete transformer that performed them, such as the transformer of a compound value transformer that succeeded. Strings parsed natively into dates are attributed to the date formatter whose result was reproduced.
+
+ @param valueTransformer The value transformer that performed the transformation, or `nil` if the transformed value was retrieved from a cache, in which case the transformation is only counted for the property mapping.
+ @param propertyMapping The property mapping whose value was transformed.
+ @param duration The time spent transforming the value.
+ */
+- (void)recordTransformationWithValueTransformer:(id<RKValueTransforming>)valueTransformer propertyMapping:(RKPropertyMapping *)propertyMapping duration:(NSTimeInterval)duration;
+
+@end
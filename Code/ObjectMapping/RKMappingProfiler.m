@@ -0,0 +1,213 @@
+//
+//  RKMappingProfiler.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <mach/mach_time.h>
+#import "RKMappingProfiler.h"
+#import "RKObjectMapping.h"
+#import "RKRelationshipMapping.h"
+
+NSTimeInterval RKMappingProfilerCurrentTime(void)
+{
+    static mach_timebase_info_data_t timebaseInfo;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        mach_timebase_info(&timebaseInfo);
+    });
+    return (double)mach_absolute_time() * timebaseInfo.numer / timebaseInfo.denom / NSEC_PER_SEC;
+}
+
+// Frames are separated by semicolons and followed by a space in the collapsed stack format
+static NSString *RKMappingProfilerFrameNameFromString(NSString *string)
+{
+    if ([string rangeOfCharacterFromSet:[NSCharacterSet characterSetWithCharactersInString:@"; \n"]].location == NSNotFound) return string;
+    NSMutableString *frameName = [string mutableCopy];
+    for (NSString *separator in @[ @";", @" ", @"\n" ]) {
+        [frameName replaceOccurrencesOfString:separator withString:@"_" options:NSLiteralSearch range:NSMakeRange(0, [frameName length])];
+    }
+    return frameName;
+}
+
+static NSString *RKMappingProfilerObjectClassName(RKObjectMapping *objectMapping)
+{
+    return objectMapping.objectClass ? NSStringFromClass(objectMapping.objectClass) : @"(unknown)";
+}
+
+@interface RKMappingProfilerEntry : NSObject
+@property (nonatomic, assign) NSUInteger count;
+@property (nonatomic, assign) NSTimeInterval duration;
+@property (nonatomic, assign) NSTimeInterval selfDuration;
+@property (nonatomic, assign) NSUInteger transformationCount;
+@end
+
+@implementation RKMappingProfilerEntry
+@end
+
+@interface RKMappingProfiler ()
+@property (nonatomic, strong) NSMapTable *objectMappingEntries;
+@property (nonatomic, strong) NSMapTable *propertyMappingEntries;
+@property (nonatomic, strong) NSMapTable *valueTransformerEntries;
+@property (nonatomic, strong) NSMutableDictionary *stackDurations;
+@end
+
+@implementation RKMappingProfiler
+
+- (instancetype)init
+{
+    self = [super init];
+    if (self) {
+        [self reset];
+    }
+    return self;
+}
+
+- (void)reset
+{
+    @synchronized(self) {
+        // Mappings are keyed by identity, as distinct mappings of the same class are profiled separately
+        self.objectMappingEntries = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+        self.propertyMappingEntries = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+        self.valueTransformerEntries = [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsObjectPointerPersonality valueOptions:NSPointerFunctionsStrongMemory];
+        self.stackDurations = [NSMutableDictionary dictionary];
+    }
+}
+
+- (RKMappingProfilerEntry *)entryForKey:(id)key inMapTable:(NSMapTable *)mapTable
+{
+    RKMappingProfilerEntry *entry = [mapTable objectForKey:key];
+    if (! entry) {
+        entry = [RKMappingProfilerEntry new];
+        [mapTable setObject:entry forKey:key];
+    }
+    return entry;
+}
+
+- (void)addDuration:(NSTimeInterval)duration toStack:(NSString *)stack
+{
+    NSNumber *stackDuration = self.stackDurations[stack];
+    self.stackDurations[stack] = @([stackDuration doubleValue] + duration);
+}
+
+#pragma mark - Recording Measurements
+
+- (NSString *)stackByPushingFrameWithKeyPath:(NSString *)keyPath objectMapping:(RKObjectMapping *)objectMapping ontoStack:(NSString *)stack
+{
+    NSString *frame = [NSString stringWithFormat:@"%@:%@", keyPath ? RKMappingProfilerFrameNameFromString(keyPath) : @"(root)", RKMappingProfilerFrameNameFromString(RKMappingProfilerObjectClassName(objectMapping))];
+    return stack ? [NSString stringWithFormat:@"%@;%@", stack, frame] : frame;
+}
+
+- (void)recordMappingWithObjectMapping:(RKObjectMapping *)objectMapping stack:(NSString *)stack duration:(NSTimeInterval)duration selfDuration:(NSTimeInterval)selfDuration
+{
+    @synchronized(self) {
+        RKMappingProfilerEntry *entry = [self entryForKey:objectMapping inMapTable:self.objectMappingEntries];
+        entry.count++;
+        entry.duration += duration;
+        entry.selfDuration += selfDuration;
+        if (stack) [self addDuration:selfDuration toStack:stack];
+    }
+}
+
+- (void)recordPropertyMapping:(RKPropertyMapping *)propertyMapping stack:(NSString *)stack duration:(NSTimeInterval)duration
+{
+    NSString *attributeStack = stack ? [NSString stringWithFormat:@"%@;%@", stack, RKMappingProfilerFrameNameFromString(propertyMapping.sourceKeyPath ?: @"(self)")] : nil;
+    @synchronized(self) {
+        RKMappingProfilerEntry *entry = [self entryForKey:propertyMapping inMapTable:self.propertyMappingEntries];
+        entry.count++;
+        entry.duration += duration;
+        if (attributeStack) [self addDuration:duration toStack:attributeStack];
+    }
+}
+
+- (void)recordTransformationWithValueTransformer:(id<RKValueTransforming>)valueTransformer propertyMapping:(RKPropertyMapping *)propertyMapping duration:(NSTimeInterval)duration
+{
+    @synchronized(self) {
+        [self entryForKey:propertyMapping inMapTable:self.propertyMappingEntries].transformationCount++;
+        if (valueTransformer) {
+            RKMappingProfilerEntry *entry = [self entryForKey:valueTransformer inMapTable:self.valueTransformerEntries];
+            entry.count++;
+            entry.duration += duration;
+        }
+    }
+}
+
+#pragma mark - Accessing the Measurements
+
+- (NSDictionary *)dictionaryRepresentation
+{
+    NSSortDescriptor *durationSortDescriptor = [NSSortDescriptor sortDescriptorWithKey:@"duration" ascending:NO];
+    NSMutableArray *objectMappings = [NSMutableArray array];
+    NSMutableArray *propertyMappings = [NSMutableArray array];
+    NSMutableArray *valueTransformers = [NSMutableArray array];
+    @synchronized(self) {
+        for (RKObjectMapping *objectMapping in self.objectMappingEntries) {
+            RKMappingProfilerEntry *entry = [self.objectMappingEntries objectForKey:objectMapping];
+            [objectMappings addObject:@{ @"objectClass": RKMappingProfilerObjectClassName(objectMapping),
+                                         @"count": @(entry.count),
+                                         @"duration": @(entry.duration),
+                                         @"selfDuration": @(entry.selfDuration) }];
+        }
+        for (RKPropertyMapping *propertyMapping in self.propertyMappingEntries) {
+            RKMappingProfilerEntry *entry = [self.propertyMappingEntries objectForKey:propertyMapping];
+            [propertyMappings addObject:@{ @"objectClass": RKMappingProfilerObjectClassName(propertyMapping.objectMapping),
+                                           @"sourceKeyPath": propertyMapping.sourceKeyPath ?: [NSNull null],
+                                           @"destinationKeyPath": propertyMapping.destinationKeyPath ?: [NSNull null],
+                                           @"type": [propertyMapping isKindOfClass:[RKRelationshipMapping class]] ? @"relationship" : @"attribute",
+                                           @"count": @(entry.count),
+                                           @"duration": @(entry.duration),
+                                           @"transformationCount": @(entry.transformationCount) }];
+        }
+        for (id<RKValueTransforming> valueTransformer in self.valueTransformerEntries) {
+            RKMappingProfilerEntry *entry = [self.valueTransformerEntries objectForKey:valueTransformer];
+            [valueTransformers addObject:@{ @"name": NSStringFromClass([valueTransformer class]),
+                                            @"count": @(entry.count),
+                                            @"duration": @(entry.duration) }];
+        }
+    }
+
+    return @{ @"objectMappings": [objectMappings sortedArrayUsingDescriptors:@[ durationSortDescriptor ]],
+              @"propertyMappings": [propertyMappings sortedArrayUsingDescriptors:@[ durationSortDescriptor ]],
+              @"valueTransformers": [valueTransformers sortedArrayUsingDescriptors:@[ durationSortDescriptor ]] };
+}
+
+- (NSData *)JSONDataWithError:(NSError **)error
+{
+    return [NSJSONSerialization dataWithJSONObject:[self dictionaryRepresentation] options:NSJSONWritingPrettyPrinted error:error];
+}
+
+- (NSString *)collapsedStackRepresentation
+{
+    NSDictionary *stackDurations;
+    @synchronized(self) {
+        stackDurations = [self.stackDurations copy];
+    }
+
+    NSMutableString *collapsedStacks = [NSMutableString string];
+    for (NSString *stack in [[stackDurations allKeys] sortedArrayUsingSelector:@selector(compare:)]) {
+        long long microseconds = llround([stackDurations[stack] doubleValue] * USEC_PER_SEC);
+        [collapsedStacks appendFormat:@"%@ %lld\n", stack, MAX(microseconds, 0LL)];
+    }
+    return collapsedStacks;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@>", [self class], self, [self dictionaryRepresentation]];
+}
+
+@end
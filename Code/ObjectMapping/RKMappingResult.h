@@ -20,6 +20,8 @@
 
 #import <Foundation/Foundation.h>
 
+@class RKMappingChangeSet;
+
 /**
  The `RKMappingResult` class represents the aggregate object mapping results returned by an `RKMapperOperation` object. The mapping result provides a thin interface on top of an `NSDictionary` and provides convenient interfaces for accessing the mapping results in various representations.
  */
@@ -37,6 +39,15 @@
  */
 - (instancetype)initWithDictionary:(NSDictionary *)dictionary;
 
+/**
+ Initializes the receiver with a dictionary of mapped key paths and object values and the change set describing the effect of the mapping on the objects.
+
+ @param dictionary A dictionary wherein the keys represent mapped key paths and the values represent the objects mapped at those key paths. Cannot be nil.
+ @param changeSet The change set of the mapping, or `nil` if none was collected.
+ @return The receiver, initialized with the given dictionary and change set.
+ */
+- (instancetype)initWithDictionary:(NSDictionary *)dictionary changeSet:(RKMappingChangeSet *)changeSet;
+
 ///----------------------------------------
 /// @name Retrieving Result Representations
 ///----------------------------------------
@@ -88,4 +99,15 @@
  */
 @property (nonatomic, readonly) NSUInteger count;
 
+///----------------------------------------
+/// @name Accessing the Change Set
+///----------------------------------------
+
+/**
+ The objects inserted, updated and left unchanged by the mapping, or `nil` if the mapper operation that produced the receiver did not collect a change set.
+
+ @see `[RKMapperOperation collectsChangeSet]`
+ */
+@property (nonatomic, readonly, strong) RKMappingChangeSet *changeSet;
+
 @end
@@ -22,16 +22,23 @@
 
 @interface RKMappingResult ()
 @property (nonatomic, strong) NSDictionary *keyPathToMappedObjects;
+@property (nonatomic, readwrite, strong) RKMappingChangeSet *changeSet;
 @end
 
 @implementation RKMappingResult
 
 - (instancetype)initWithDictionary:(id)dictionary
+{
+    return [self initWithDictionary:dictionary changeSet:nil];
+}
+
+- (instancetype)initWithDictionary:(NSDictionary *)dictionary changeSet:(RKMappingChangeSet *)changeSet
 {
     NSParameterAssert(dictionary);
     self = [self init];
     if (self) {
         self.keyPathToMappedObjects = dictionary;
+        self.changeSet = changeSet;
     }
 
     return self;
@@ -0,0 +1,54 @@
+//
+//  RKMapping_Private.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKMapping.h"
+#import "RKObjectMapping.h"
+
+/**
+ Raises an `NSInternalInconsistencyException` if the receiver of the enclosing method has been frozen. Must be invoked from an Objective-C method of an object responding to `isFrozen`.
+ */
+#define RKRaiseIfFrozen() \
+    do { \
+        if ([self isFrozen]) [NSException raise:NSInternalInconsistencyException format:@"*** -[%@ %@]: attempt to mutate %@ after it was frozen.", NSStringFromClass([self class]), NSStringFromSelector(_cmd), self]; \
+    } while (0)
+
+@interface RKMapping (Private)
+
+/**
+ Invoked by `freeze` once the receiver has been marked as frozen. Subclasses override this method to compile their state and freeze the mappings reachable from them.
+ */
+- (void)freezeReachableMappings;
+
+@end
+
+
+@interface RKObjectMapping (Private)
+
+/**
+ Returns a Boolean value that indicates if values mapped to the given destination key may be assigned with `setPrimitiveValue:forKey:`, bypassing the accessors of the object class. Consulted when the execution plan of the receiver is compiled.
+
+ The default implementation returns `NO`. `RKEntityMapping` overrides it for the attributes of its entity whose accessors are generated by Core Data.
+
+ @param key A destination key of the receiver.
+ @return `YES` if the primitive value for the key may be set directly, else `NO`.
+ */
+- (BOOL)canSetPrimitiveValueForDestinationKey:(NSString *)key;
+
+@end
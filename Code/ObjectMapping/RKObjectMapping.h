@@ -23,7 +23,7 @@
 
 #import <RKValueTransformers/RKValueTransformers.h>
 
-@class RKPropertyMapping, RKAttributeMapping, RKRelationshipMapping;
+@class RKPropertyMapping, RKAttributeMapping, RKRelationshipMapping, RKObjectMappingPlan;
 @protocol RKValueTransforming;
 
 /**
@@ -315,11 +315,35 @@
  */
 @property (nonatomic, assign) BOOL performsKeyValueValidation;
 
+/**
+ When `YES`, mapping operations compute a fingerprint of the content of each representation mapped with the receiver and skip the mapping entirely if the destination object was last mapped with the receiver from a representation with the same fingerprint.
+
+ The fingerprint covers the values at the source key paths of all attribute and relationship mappings of the receiver, including nested representations and metadata key paths, and is stored alongside the destination object once it has been mapped successfully. Fingerprinting benefits the mapping of existing objects, such as objects retrieved by a data source that maintains an identity map or given as the `targetObject` of a mapper, when most representations are unchanged between loads. Newly created objects have no stored fingerprint and are always mapped.
+
+ Fingerprints are not supported for managed objects: setting this property to `YES` on an `RKEntityMapping` raises an `NSInvalidArgumentException`, and managed objects mapped with an object mapping that fingerprints representations are always mapped.
+
+ @warning The fingerprint describes the representation that was last mapped, not the current state of the destination object. Changes made to the destination object outside of object mapping are not overwritten while the representation remains unchanged.
+
+ **Default**: `NO`
+ */
+@property (nonatomic, assign) BOOL fingerprintsRepresentations;
+
 /**
  A value transformer with which to process input values being mapped with the receiver. Defaults to a copy of `[RKValueTransformer defaultTransformer]`.
  */
 @property (nonatomic, strong) id<RKValueTransforming> valueTransformer;
 
+/**
+ The maximum number of parsed dates to be cached by the receiver, keyed by the strings they were parsed from. A value of zero disables the cache.
+
+ Date strings are frequently repeated across the representations of a payload, such as the creation timestamps of a batch of records. When enabled, the cache is consulted before strings are transformed into `NSDate` values with the `valueTransformer` of the receiver, avoiding the cost of parsing each distinct string more than once. The cache is cleared whenever the `valueTransformer` or date formatters of the receiver are changed, including when value transformers are added to or removed from a compound `valueTransformer` directly.
+
+ Independently of the cache, ISO 8601 timestamps with an explicit time zone and ASP.NET style `/Date(1112715000000-0500)/` strings are parsed natively without consulting any formatter whenever the first transformer in the `valueTransformer` that handles strings to dates is an `RKISO8601DateFormatter` or an `RKDotNetDateFormatter`, respectively.
+
+ **Default**: `0`
+ */
+@property (nonatomic, assign) NSUInteger parsedDateCacheLimit;
+
 /**
  Returns the default value to be assigned to the specified attribute when it is missing from a mappable payload.
 
@@ -351,6 +375,28 @@
  */
 - (RKObjectMapping *)inverseMappingWithPropertyMappingsPassingTest:(BOOL (^)(RKPropertyMapping *propertyMapping))predicate;
 
+///----------------------------
+/// @name Compiling the Mapping
+///----------------------------
+
+/**
+ The compiled execution plan of the receiver.
+
+ The execution plan captures the facts about the receiver that `RKMappingOperation` would otherwise have to derive for every object it maps: the partitioning of the property mappings, the components of their key paths, the classes of the destination properties and the accessors used to assign them. The plan is compiled on first access and cached until a property mapping is added to or removed from the receiver.
+
+ @see `RKObjectMappingPlan`
+ */
+@property (nonatomic, readonly) RKObjectMappingPlan *executionPlan;
+
+/**
+ Compiles the execution plans of the receiver and of every object mapping reachable through its relationship mappings.
+
+ Plans are compiled lazily the first time a mapping is used, so invoking this method is never required. It is provided so that applications can pay the cost of compilation up front, such as during launch, rather than during the first mapping pass. Freezing a mapping compiles the plans of the mapping graph as well.
+
+ @see `freeze`
+ */
+- (void)compile;
+
 ///---------------------------------------------------
 /// @name Obtaining Information About the Target Class
 ///---------------------------------------------------
@@ -25,7 +25,11 @@
 #import "RKLog.h"
 #import "RKAttributeMapping.h"
 #import "RKRelationshipMapping.h"
+#import "RKDynamicMapping.h"
+#import "RKObjectMappingPlan.h"
+#import "RKMapping_Private.h"
 #import "RKValueTransformers.h"
+#import "RKCompoundValueTransformer+RKAdditions.h"
 #import "ISO8601DateFormatterValueTransformer.h"
 
 typedef NSString * (^RKSourceToDesinationKeyTransformationBlock)(RKObjectMapping *, NSString *);
@@ -115,6 +119,9 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
 
 @property (nonatomic, weak, readonly) NSArray *mappedKeyPaths;
 @property (nonatomic, copy) RKSourceToDesinationKeyTransformationBlock sourceToDestinationKeyTransformationBlock;
+@property (atomic, strong) RKObjectMappingPlan *compiledExecutionPlan;
+@property (atomic, strong) NSCache *parsedDateCache;
+@property (atomic, copy) NSArray *parsedDateCacheValueTransformers; // The contents of the compound value transformer that parsed the cached dates
 @end
 
 @implementation RKObjectMapping
@@ -187,7 +194,11 @@ static RKSourceToDesinationKeyTransformationBlock defaultSourceToDestinationKeyT
     self.assignsNilForMissingRelationships = mapping.assignsNilForMissingRelationships;
     self.forceCollectionMapping = mapping.forceCollectionMapping;
     self.performsKeyValueValidation = mapping.performsKeyValueValidation;
-    self.valueTransformer = mapping.valueTransformer;
+    self.fingerprintsRepresentations = mapping.fingerprintsRepresentations;
+    self.parsedDateCacheLimit = mapping.parsedDateCacheLimit;
+    // Copies of frozen mappings are mutable, and so is their compound value transformer
+    BOOL isFrozenCompoundValueTransformer = ([mapping.valueTransformer isKindOfClass:[RKCompoundValueTransformer class]] && [(RKCompoundValueTransformer *)mapping.valueTransformer isFrozen]);
+    self.valueTransformer = isFrozenCompoundValueTransformer ? [(RKCompoundValueTransformer *)mapping.valueTransformer copy] : mapping.valueTransformer;
     self.sourceToDestinationKeyTransformationBlock = mapping.sourceToDestinationKeyTransformationBlock;
 }
 
@@ -258,11 +269,13 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 
 - (void)addPropertyMapping:(RKPropertyMapping *)propertyMapping
 {
+    RKRaiseIfFrozen();
     NSAssert1([[self mappedKeyPaths] containsObject:propertyMapping.destinationKeyPath] == NO,
               @"Unable to add mapping for keyPath %@, one already exists...", propertyMapping.destinationKeyPath);
     NSAssert(self.propertyMappings, @"self.propertyMappings is nil");
     NSAssert(propertyMapping.objectMapping == nil, @"Cannot add a property mapping object that has already been added to another `RKObjectMapping` object. You probably want to obtain a copy of the mapping: `[propertyMapping copy]`");
     propertyMapping.objectMapping = self;
+    self.compiledExecutionPlan = nil;
     self.propertyMappings = [self.propertyMappings arrayByAddingObject:propertyMapping];
     [self.propertiesBySourceKeyPath setObject:propertyMapping forKey:propertyMapping.sourceKeyPath ?: [NSNull null]];
     if (propertyMapping.destinationKeyPath) (self.propertiesByDestinationKeyPath)[propertyMapping.destinationKeyPath] = propertyMapping;
@@ -365,8 +378,10 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 
 - (void)removePropertyMapping:(RKPropertyMapping *)attributeOrRelationshipMapping
 {
+    RKRaiseIfFrozen();
     if ([self.propertyMappings containsObject:attributeOrRelationshipMapping]) {
         attributeOrRelationshipMapping.objectMapping = nil;
+        self.compiledExecutionPlan = nil;
         self.propertyMappings = RKRemoveProperty(self.propertyMappings, attributeOrRelationshipMapping);
         self.relationshipMappings = RKRemoveProperty(self.relationshipMappings, attributeOrRelationshipMapping);
         self.attributeMappings = RKRemoveProperty(self.attributeMappings, attributeOrRelationshipMapping);
@@ -433,21 +448,86 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 - (Class)classForKeyPath:(NSString *)keyPath
 {
     if (keyPath == nil) return self.objectClass;
+    return [[RKPropertyInspector sharedInspector] classForPropertyAtKeyPath:keyPath ofClass:self.objectClass isPrimitive:nil];
+}
+
+- (BOOL)canSetPrimitiveValueForDestinationKey:(NSString *)key
+{
+    return NO;
+}
 
-    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
+#pragma mark - Compilation
 
-    if ([keyPath rangeOfString:@"." options:NSLiteralSearch].length == 0) {
-        return [inspector classForPropertyNamed:keyPath ofClass:self.objectClass isPrimitive:nil];
+- (RKObjectMappingPlan *)executionPlan
+{
+    RKObjectMappingPlan *executionPlan = self.compiledExecutionPlan;
+    if (! executionPlan) {
+        executionPlan = [[RKObjectMappingPlan alloc] initWithObjectMapping:self];
+        self.compiledExecutionPlan = executionPlan;
     }
+    return executionPlan;
+}
 
-    NSArray *components = [keyPath componentsSeparatedByString:@"."];
-    Class propertyClass = self.objectClass;
-    for (NSString *property in components) {
-        propertyClass = [inspector classForPropertyNamed:property ofClass:propertyClass isPrimitive:nil];
-        if (! propertyClass) break;
+- (void)compileWithVisitedMappings:(NSMutableSet *)visitedMappings
+{
+    // Use an NSValue to guard against cycles in the relationship graph without retaining the mappings
+    NSValue *visitedKey = [NSValue valueWithNonretainedObject:self];
+    if ([visitedMappings containsObject:visitedKey]) return;
+    [visitedMappings addObject:visitedKey];
+
+    [self executionPlan];
+    for (RKRelationshipMapping *relationshipMapping in self.relationshipMappings) {
+        RKMapping *mapping = relationshipMapping.mapping;
+        NSArray *objectMappings = [mapping isKindOfClass:[RKDynamicMapping class]] ? [(RKDynamicMapping *)mapping objectMappings] : (mapping ? @[ mapping ] : nil);
+        for (RKObjectMapping *objectMapping in objectMappings) {
+            if ([objectMapping isKindOfClass:[RKObjectMapping class]]) [objectMapping compileWithVisitedMappings:visitedMappings];
+        }
     }
+}
+
+- (void)compile
+{
+    [self compileWithVisitedMappings:[NSMutableSet set]];
+}
+
+#pragma mark - Freezing
+
+- (void)freezeReachableMappings
+{
+    // The compound value transformer may be shared with other mappings, so a frozen copy is substituted for it
+    if ([_valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) _valueTransformer = [(RKCompoundValueTransformer *)_valueTransformer frozenCopy];
+    [self executionPlan];
+    [self.propertyMappings makeObjectsPerformSelector:@selector(freeze)];
+}
+
+- (void)setAssignsDefaultValueForMissingAttributes:(BOOL)assignsDefaultValueForMissingAttributes
+{
+    RKRaiseIfFrozen();
+    _assignsDefaultValueForMissingAttributes = assignsDefaultValueForMissingAttributes;
+}
+
+- (void)setAssignsNilForMissingRelationships:(BOOL)assignsNilForMissingRelationships
+{
+    RKRaiseIfFrozen();
+    _assignsNilForMissingRelationships = assignsNilForMissingRelationships;
+}
+
+- (void)setPerformsKeyValueValidation:(BOOL)performsKeyValueValidation
+{
+    RKRaiseIfFrozen();
+    _performsKeyValueValidation = performsKeyValueValidation;
+}
 
-    return propertyClass;
+- (void)setFingerprintsRepresentations:(BOOL)fingerprintsRepresentations
+{
+    RKRaiseIfFrozen();
+    _fingerprintsRepresentations = fingerprintsRepresentations;
+}
+
+- (void)setSourceToDestinationKeyTransformationBlock:(RKSourceToDesinationKeyTransformationBlock)sourceToDestinationKeyTransformationBlock
+{
+    RKRaiseIfFrozen();
+    _sourceToDestinationKeyTransformationBlock = [sourceToDestinationKeyTransformationBlock copy];
 }
 
 - (BOOL)isEqualToMapping:(RKObjectMapping *)otherMapping
@@ -531,6 +611,43 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 
 #pragma mark - Date and Time
 
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    RKRaiseIfFrozen();
+    _valueTransformer = valueTransformer;
+    [self.parsedDateCache removeAllObjects];
+}
+
+- (void)setParsedDateCacheLimit:(NSUInteger)parsedDateCacheLimit
+{
+    RKRaiseIfFrozen();
+    _parsedDateCacheLimit = parsedDateCacheLimit;
+    NSCache *parsedDateCache = nil;
+    if (parsedDateCacheLimit > 0) {
+        parsedDateCache = [NSCache new];
+        parsedDateCache.countLimit = parsedDateCacheLimit;
+    }
+    self.parsedDateCache = parsedDateCache;
+    self.parsedDateCacheValueTransformers = nil;
+}
+
+- (NSCache *)parsedDateCacheForValueTransformer
+{
+    NSCache *parsedDateCache = self.parsedDateCache;
+    id<RKValueTransforming> valueTransformer = self.valueTransformer;
+    if (! parsedDateCache || ! [valueTransformer isKindOfClass:[RKCompoundValueTransformer class]] || [(RKCompoundValueTransformer *)valueTransformer isFrozen]) return parsedDateCache;
+
+    // The compound value transformer may have been mutated directly since the dates were parsed, in which case they are discarded
+    @synchronized(parsedDateCache) {
+        NSArray *valueTransformers = self.parsedDateCacheValueTransformers;
+        if (! valueTransformers || ! RKCompoundValueTransformerContainsValueTransformers((RKCompoundValueTransformer *)valueTransformer, valueTransformers)) {
+            [parsedDateCache removeAllObjects];
+            self.parsedDateCacheValueTransformers = RKValueTransformersOfCompoundValueTransformer((RKCompoundValueTransformer *)valueTransformer);
+        }
+    }
+    return parsedDateCache;
+}
+
 - (NSFormatter *)preferredDateFormatter
 {
     if ([self.valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) {
@@ -544,9 +661,11 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 
 - (void)setPreferredDateFormatter:(NSFormatter *)preferredDateFormatter
 {
+    RKRaiseIfFrozen();
     if ([self.valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) {
         [(RKCompoundValueTransformer *)self.valueTransformer insertValueTransformer:(NSFormatter<RKValueTransforming> *)preferredDateFormatter atIndex:0];
     }
+    [self.parsedDateCache removeAllObjects];
 }
 
 - (NSArray *)dateFormatters
@@ -558,6 +677,7 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
 
 - (void)setDateFormatters:(NSArray *)dateFormatters
 {
+    RKRaiseIfFrozen();
     if (! [self.valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) [NSException raise:NSInternalInconsistencyException format:@"Cannot set date formatters: the receiver's `valueTransformer` is not an instance of `RKCompoundValueTransformer`."];
     for (id<RKValueTransforming> dateFormatter in [self dateFormatters]) {
         [(RKCompoundValueTransformer *)self.valueTransformer removeValueTransformer:dateFormatter];
@@ -565,6 +685,7 @@ static NSArray *RKRemoveProperty(NSArray *array, RKPropertyMapping *mapping)
     for (id<RKValueTransforming> dateFormatter in dateFormatters) {
         [(RKCompoundValueTransformer *)self.valueTransformer addValueTransformer:dateFormatter];
     }
+    [self.parsedDateCache removeAllObjects];
 }
 
 @end
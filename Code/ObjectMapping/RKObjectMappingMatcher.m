@@ -106,6 +106,16 @@
     return NO;
 }
 
+- (NSString *)indexedKeyPath
+{
+    return nil;
+}
+
+- (NSDictionary *)objectMappingsByIndexedValue
+{
+    return nil;
+}
+
 @end
 
 @implementation RKKeyPathObjectMappingMatcher
@@ -140,6 +150,17 @@
     return RKObjectIsEqualToObject(value, self.expectedValue);
 }
 
+- (NSString *)indexedKeyPath
+{
+    // Values that cannot be used as dictionary keys must be matched by equality
+    return [self.expectedValue conformsToProtocol:@protocol(NSCopying)] ? self.keyPath : nil;
+}
+
+- (NSDictionary *)objectMappingsByIndexedValue
+{
+    return [self indexedKeyPath] ? @{ self.expectedValue: self.objectMapping } : nil;
+}
+
 - (NSString *)description
 {
     return [NSString stringWithFormat:@"<%@: %p when `%@` == '%@' objectMapping: %@>", NSStringFromClass([self class]), self, self.keyPath, self.expectedValue, self.objectMapping];
@@ -213,6 +234,16 @@
     return [self.valueMap allValues];
 }
 
+- (NSString *)indexedKeyPath
+{
+    return self.keyPath;
+}
+
+- (NSDictionary *)objectMappingsByIndexedValue
+{
+    return self.valueMap;
+}
+
 - (BOOL)matches:(id)object
 {
     id value = [object valueForKeyPath:self.keyPath];
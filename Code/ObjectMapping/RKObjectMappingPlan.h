@@ -0,0 +1,204 @@
+//
+//  RKObjectMappingPlan.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+#import "RKGeneratedMapping.h"
+
+@class RKObjectMapping, RKPropertyMapping;
+
+/**
+ An `RKPropertyMappingPlan` object captures everything about an `RKPropertyMapping` that can be determined without looking at a source representation: the components of its key paths, the class and primitive status of the destination property and, when safe to do so, the setter implementation used to assign the destination value.
+
+ Property mapping plans are immutable once created and are safe to share between threads.
+ */
+@interface RKPropertyMappingPlan : NSObject
+
+/**
+ The property mapping that the receiver was compiled from.
+ */
+@property (nonatomic, strong, readonly) RKPropertyMapping *propertyMapping;
+
+/**
+ The source key path of the property mapping.
+ */
+@property (nonatomic, copy, readonly) NSString *sourceKeyPath;
+
+/**
+ The destination key path of the property mapping.
+ */
+@property (nonatomic, copy, readonly) NSString *destinationKeyPath;
+
+/**
+ The components of the source key path, split at the '.' character. `nil` if the source key path is `nil`.
+ */
+@property (nonatomic, copy, readonly) NSArray *sourceKeyPathComponents;
+
+/**
+ The components of the destination key path, split at the '.' character. `nil` if the destination key path is `nil`.
+ */
+@property (nonatomic, copy, readonly) NSArray *destinationKeyPathComponents;
+
+/**
+ The key-value coding class of the destination property as determined by runtime introspection of the target class of the object mapping. `Nil` if the class could not be determined.
+ */
+@property (nonatomic, strong, readonly) Class destinationClass;
+
+/**
+ A Boolean value that indicates if the destination property is backed by a primitive (non-object) type.
+ */
+@property (nonatomic, assign, readonly, getter = isDestinationPrimitive) BOOL destinationPrimitive;
+
+/**
+ A Boolean value that indicates if either key path of the property mapping refers to the special nesting attribute key used to map the keys of a representation.
+ */
+@property (nonatomic, assign, readonly, getter = isNestingAttribute) BOOL nestingAttribute;
+
+/**
+ A Boolean value that indicates if the source key path must be evaluated with key-value coding, such as when it contains a collection operator, a metadata key (`@metadata`, `@parent` or `@root`) or begins with `self`.
+ */
+@property (nonatomic, assign, readonly) BOOL requiresKeyValueCodingForSource;
+
+/**
+ A Boolean value that indicates if the destination key path of the receiver is a single key whose value may be assigned with `setPrimitiveValue:forKey:`, as decided by the object mapping. Entity mappings allow it for the attributes of their entity that are declared as `@dynamic` properties, so that no custom setter is bypassed.
+ */
+@property (nonatomic, assign, readonly) BOOL canSetPrimitiveValue;
+
+/**
+ Returns the value at the source key path of the receiver from the given representation.
+
+ Unless the receiver `requiresKeyValueCodingForSource`, the pre-tokenized source key path is walked with `objectForKey:` for as long as the intermediate values are dictionaries. Upon reaching any other kind of object (i.e. an array or a model object) the remainder of the key path is evaluated with `valueForKeyPath:`. Exceptions raised by key-value coding are caught and `nil` is returned, matching the behavior of key path evaluation during a mapping operation.
+
+ @param representation The object representation to read the value from.
+ @return The value at the source key path of the receiver, or `nil` if none could be found.
+ */
+- (id)valueForSourceKeyPathOfRepresentation:(id)representation;
+
+/**
+ Assigns a value to the destination key path of the receiver on the given object.
+
+ When the destination key path is a single key backed by an object setter on the target class, the cached setter implementation is invoked directly. In all other cases (including objects whose class has been changed at runtime, such as by key-value observing) the value is assigned with `setValue:forKeyPath:`.
+
+ @param value The value to assign.
+ @param object The object to assign the value to.
+ */
+- (void)setValue:(id)value onObject:(id)object;
+
+/**
+ Assigns a value to the attribute named by the destination key path of the receiver on the given managed object with `setPrimitiveValue:forKey:`, without emitting key-value observing change notifications.
+
+ This may only be used for plans that `canSetPrimitiveValue`, and only for objects that cannot be observed, such as managed objects that were just inserted into a context.
+
+ @param value The value to assign.
+ @param object The managed object to assign the value to.
+ */
+- (void)setPrimitiveValue:(id)value onObject:(id)object;
+
+@end
+
+/**
+ An `RKObjectMappingPlan` object is the compiled form of an `RKObjectMapping`. It contains the property mappings of the object mapping pre-partitioned into the order in which `RKMappingOperation` applies them, each compiled into an `RKPropertyMappingPlan`.
+
+ Plans are obtained via `[RKObjectMapping compile]` and are cached by the object mapping until its property mappings are changed. Plans are immutable and are safe to share between threads.
+ */
+@interface RKObjectMappingPlan : NSObject
+
+/**
+ Initializes the receiver by compiling the property mappings of the given object mapping.
+
+ @param objectMapping The object mapping to compile.
+ @return The receiver, initialized with the compiled property mappings of the given object mapping.
+ */
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping;
+
+/**
+ Initializes the receiver by compiling the given property mappings against the target class of the given object mapping.
+
+ This is used to compile property mappings that have been derived from the property mappings of the object mapping, such as when applying a nesting attribute value.
+
+ @param objectMapping The object mapping that provides the target class.
+ @param propertyMappings The attribute and relationship mappings to compile.
+ @return The receiver, initialized with the given property mappings.
+ */
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings NS_DESIGNATED_INITIALIZER;
+
+/**
+ The target class of the object mapping the receiver was compiled from.
+ */
+@property (nonatomic, weak, readonly) Class objectClass;
+
+/**
+ Plans for all attribute mappings, in the order in which the attribute mappings were added to the object mapping.
+ */
+@property (nonatomic, copy, readonly) NSArray *attributePlans;
+
+/**
+ Plans for attribute mappings with a source key path containing a single key.
+ */
+@property (nonatomic, copy, readonly) NSArray *keyAttributePlans;
+
+/**
+ Plans for attribute mappings with a source key path containing multiple components.
+ */
+@property (nonatomic, copy, readonly) NSArray *keyPathAttributePlans;
+
+/**
+ Plans for the relationship mappings.
+ */
+@property (nonatomic, copy, readonly) NSArray *relationshipPlans;
+
+/**
+ The plan for the attribute mapping that maps the key of a nested representation to an attribute, if any.
+
+ @see `[RKObjectMapping addAttributeMappingFromKeyOfRepresentationToAttribute:]`
+ */
+@property (nonatomic, strong, readonly) RKPropertyMappingPlan *attributePlanFromKeyOfRepresentation;
+
+/**
+ The plan for the attribute mapping that maps an attribute to the key of a nested representation, if any.
+
+ @see `[RKObjectMapping addAttributeMappingToKeyOfRepresentationFromAttribute:]`
+ */
+@property (nonatomic, strong, readonly) RKPropertyMappingPlan *attributePlanToKeyOfRepresentation;
+
+/**
+ The generated mapping function registered for the signature of the receiver when it was compiled, if any.
+
+ @see `RKGeneratedMappingSignatureForPlan`
+ @see `RKMappingCodeGenerator`
+ */
+@property (nonatomic, assign, readonly) RKGeneratedMappingFunction generatedMappingFunction;
+
+///-------------------------------------
+/// @name Substituting Nesting Values
+///-------------------------------------
+
+/**
+ Returns a plan in which occurrences of the placeholder for the given nesting attribute (i.e. `{name}`) within the key paths of the receiver have been replaced with the given value.
+
+ When the receiver is compiled, the key paths referencing the nesting attribute of the object mapping are split into templates around the placeholder. Substitution joins the template segments with the value and shares all other compiled state with the receiver, including the property mappings, so no mapping objects are created for the common case of a templated source key path. Plans with a templated destination key path are compiled from a substituted property mapping, as the destination key path is read from the property mapping when assigning relationships. The receiver is returned if none of its key paths reference the attribute.
+
+ @param value The value of the nesting attribute. Values other than strings are substituted by their description.
+ @param attributeName The name of the nesting attribute.
+ @param objectMapping The object mapping the receiver was compiled from.
+ @return A plan for mapping a representation nested under the given value.
+ */
+- (RKObjectMappingPlan *)planBySubstitutingValue:(id)value forNestingAttribute:(NSString *)attributeName objectMapping:(RKObjectMapping *)objectMapping;
+
+@end
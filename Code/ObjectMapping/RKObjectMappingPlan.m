@@ -0,0 +1,375 @@
+//
+//  RKObjectMappingPlan.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <objc/runtime.h>
+#import "RKObjectMappingPlan.h"
+#import "RKObjectMapping.h"
+#import "RKAttributeMapping.h"
+#import "RKRelationshipMapping.h"
+#import "RKPropertyInspector.h"
+#import "RKMapping_Private.h"
+
+extern NSString * const RKObjectMappingNestingAttributeKeyName;
+
+NSArray *RKApplyNestingAttributeValueToMappings(NSString *attributeName, id value, NSArray *propertyMappings);
+
+typedef void (*RKObjectSetterIMP)(id, SEL, id);
+
+// Declares the primitive accessor of `NSManagedObject` without depending on Core Data
+@protocol RKPrimitiveValueSetting <NSObject>
+- (void)setPrimitiveValue:(id)value forKey:(NSString *)key;
+@end
+
+static BOOL RKClassIsManagedObjectClass(Class aClass)
+{
+    static Class managedObjectClass = Nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        managedObjectClass = NSClassFromString(@"NSManagedObject");
+    });
+    return managedObjectClass && [aClass isSubclassOfClass:managedObjectClass];
+}
+
+static NSArray *RKKeyPathComponents(NSString *keyPath)
+{
+    if (! keyPath) return nil;
+    if ([keyPath rangeOfString:@"." options:NSLiteralSearch].length == 0) return @[ keyPath ];
+    return [keyPath componentsSeparatedByString:@"."];
+}
+
+/**
+ Returns the selector for the `set<Key>:` accessor that key-value coding would invoke first for the given key.
+ */
+static SEL RKSetterSelectorForKey(NSString *key)
+{
+    if ([key length] == 0) return NULL;
+    NSString *setterName = [NSString stringWithFormat:@"set%@%@:", [[key substringToIndex:1] uppercaseString], [key substringFromIndex:1]];
+    return NSSelectorFromString(setterName);
+}
+
+/**
+ Returns a Boolean value that indicates if the class uses the stock `NSObject` key-value coding setter machinery, in which case invoking the `set<Key>:` accessor directly is equivalent to `setValue:forKey:`.
+ */
+static BOOL RKClassUsesDefaultKeyValueCodingSetters(Class aClass)
+{
+    Class rootClass = [NSObject class];
+    return (class_getMethodImplementation(aClass, @selector(setValue:forKey:)) == class_getMethodImplementation(rootClass, @selector(setValue:forKey:)) &&
+            class_getMethodImplementation(aClass, @selector(setValue:forKeyPath:)) == class_getMethodImplementation(rootClass, @selector(setValue:forKeyPath:)));
+}
+
+@interface RKPropertyMappingPlan ()
+@property (nonatomic, strong, readwrite) RKPropertyMapping *propertyMapping;
+@property (nonatomic, copy, readwrite) NSString *sourceKeyPath;
+@property (nonatomic, copy, readwrite) NSString *destinationKeyPath;
+@property (nonatomic, copy, readwrite) NSArray *sourceKeyPathComponents;
+@property (nonatomic, copy, readwrite) NSArray *destinationKeyPathComponents;
+@property (nonatomic, strong, readwrite) Class destinationClass;
+@property (nonatomic, assign, readwrite, getter = isDestinationPrimitive) BOOL destinationPrimitive;
+@property (nonatomic, assign, readwrite, getter = isNestingAttribute) BOOL nestingAttribute;
+@property (nonatomic, assign, readwrite) BOOL requiresKeyValueCodingForSource;
+@property (nonatomic, assign, readwrite) BOOL canSetPrimitiveValue;
+
+- (instancetype)initWithPropertyMapping:(RKPropertyMapping *)propertyMapping objectMapping:(RKObjectMapping *)objectMapping;
+- (BOOL)compileTemplatesForNestingAttributeNamed:(NSString *)attributeName;
+- (RKPropertyMappingPlan *)planBySubstitutingNestingAttributeValue:(NSString *)value forAttributeNamed:(NSString *)attributeName objectMapping:(RKObjectMapping *)objectMapping;
+@end
+
+@implementation RKPropertyMappingPlan {
+    NSArray *_sourceKeyPathSuffixes;
+    Class _setterClass;
+    SEL _setterSelector;
+    RKObjectSetterIMP _setterIMP;
+
+    // The segments of the key paths surrounding occurrences of the nesting attribute placeholder, or `nil` if the key path contains none
+    NSArray *_sourceKeyPathTemplate;
+    NSArray *_destinationKeyPathTemplate;
+}
+
+- (instancetype)initWithPropertyMapping:(RKPropertyMapping *)propertyMapping objectMapping:(RKObjectMapping *)objectMapping
+{
+    self = [super init];
+    if (self) {
+        self.propertyMapping = propertyMapping;
+        self.sourceKeyPath = propertyMapping.sourceKeyPath;
+        self.destinationKeyPath = propertyMapping.destinationKeyPath;
+        self.sourceKeyPathComponents = RKKeyPathComponents(self.sourceKeyPath);
+        self.destinationKeyPathComponents = RKKeyPathComponents(self.destinationKeyPath);
+        self.nestingAttribute = ([self.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName] ||
+                                 [self.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]);
+        [self compileSourceAccess];
+
+        Class objectClass = objectMapping.objectClass;
+        if (objectClass && self.destinationKeyPath && ![self.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) {
+            self.destinationClass = [objectMapping classForKeyPath:self.destinationKeyPath];
+            [self compileDestinationAccessForClass:objectClass];
+            [self compilePrimitiveAccessForObjectMapping:objectMapping];
+        }
+    }
+    return self;
+}
+
+- (void)compileSourceAccess
+{
+    NSArray *components = self.sourceKeyPathComponents;
+    BOOL requiresKeyValueCoding = ([components count] == 0 || [components[0] isEqualToString:@"self"]);
+    for (NSString *key in components) {
+        if ([key length] == 0 || [key hasPrefix:@"@"]) requiresKeyValueCoding = YES;
+    }
+    self.requiresKeyValueCodingForSource = requiresKeyValueCoding;
+    if (requiresKeyValueCoding) return;
+
+    // The remainder of the key path at each component, used to hand off to key-value coding part way through the walk
+    NSMutableArray *suffixes = [NSMutableArray arrayWithCapacity:[components count]];
+    for (NSUInteger index = 0; index < [components count]; index++) {
+        [suffixes addObject:(index == 0) ? self.sourceKeyPath : [[components subarrayWithRange:NSMakeRange(index, [components count] - index)] componentsJoinedByString:@"."]];
+    }
+    _sourceKeyPathSuffixes = suffixes;
+}
+
+- (id)valueForSourceKeyPathOfRepresentation:(id)representation
+{
+    if (self.requiresKeyValueCodingForSource) {
+        @try {
+            return [representation valueForKeyPath:self.sourceKeyPath];
+        }
+        @catch (NSException *exception) {
+            return nil;
+        }
+    }
+
+    id value = representation;
+    NSUInteger index = 0;
+    for (NSString *key in self.sourceKeyPathComponents) {
+        if (! value) return nil;
+        if (! [value isKindOfClass:[NSDictionary class]]) {
+            @try {
+                return [value valueForKeyPath:_sourceKeyPathSuffixes[index]];
+            }
+            @catch (NSException *exception) {
+                return nil;
+            }
+        }
+        value = [(NSDictionary *)value objectForKey:key];
+        index++;
+    }
+    return value;
+}
+
+- (void)compileDestinationAccessForClass:(Class)objectClass
+{
+    BOOL isPrimitive = NO;
+    [[RKPropertyInspector sharedInspector] classForPropertyAtKeyPath:self.destinationKeyPath ofClass:objectClass isPrimitive:&isPrimitive];
+    self.destinationPrimitive = isPrimitive;
+
+    // Direct setter dispatch is restricted to single key, object typed properties of plain `NSObject` classes. Core Data and dictionary targets rely on their own key-value coding implementations.
+    if ([self.destinationKeyPathComponents count] != 1) return;
+    if (RKClassIsManagedObjectClass(objectClass) || [objectClass isSubclassOfClass:[NSDictionary class]]) return;
+    if (! RKClassUsesDefaultKeyValueCodingSetters(objectClass)) return;
+
+    objc_property_t property = class_getProperty(objectClass, [self.destinationKeyPath UTF8String]);
+    if (! property) return;
+    const char *attributes = property_getAttributes(property);
+    if (! attributes || attributes[0] != 'T' || attributes[1] != '@') return;
+
+    SEL setterSelector = RKSetterSelectorForKey(self.destinationKeyPath);
+    Method setterMethod = setterSelector ? class_getInstanceMethod(objectClass, setterSelector) : NULL;
+    if (! setterMethod) return;
+
+    _setterClass = objectClass;
+    _setterSelector = setterSelector;
+    _setterIMP = (RKObjectSetterIMP)method_getImplementation(setterMethod);
+}
+
+- (void)compilePrimitiveAccessForObjectMapping:(RKObjectMapping *)objectMapping
+{
+    self.canSetPrimitiveValue = ([self.destinationKeyPathComponents count] == 1 && [objectMapping canSetPrimitiveValueForDestinationKey:self.destinationKeyPath]);
+}
+
+- (BOOL)compileTemplatesForNestingAttributeNamed:(NSString *)attributeName
+{
+    NSString *placeholder = [NSString stringWithFormat:@"{%@}", attributeName];
+    if ([self.sourceKeyPath rangeOfString:placeholder options:NSLiteralSearch].length > 0) {
+        _sourceKeyPathTemplate = [self.sourceKeyPath componentsSeparatedByString:placeholder];
+    }
+    if ([self.destinationKeyPath rangeOfString:placeholder options:NSLiteralSearch].length > 0) {
+        _destinationKeyPathTemplate = [self.destinationKeyPath componentsSeparatedByString:placeholder];
+    }
+    return (_sourceKeyPathTemplate || _destinationKeyPathTemplate);
+}
+
+- (RKPropertyMappingPlan *)planBySubstitutingNestingAttributeValue:(NSString *)value forAttributeNamed:(NSString *)attributeName objectMapping:(RKObjectMapping *)objectMapping
+{
+    if (! _sourceKeyPathTemplate && ! _destinationKeyPathTemplate) return self;
+
+    // The relationship machinery and data sources read the destination key path from the property mapping itself, so a templated destination requires a substituted mapping
+    if (_destinationKeyPathTemplate) {
+        RKPropertyMapping *propertyMapping = [RKApplyNestingAttributeValueToMappings(attributeName, value, @[ self.propertyMapping ]) firstObject];
+        return [[RKPropertyMappingPlan alloc] initWithPropertyMapping:propertyMapping objectMapping:objectMapping];
+    }
+
+    // Only the source key path differs, so the compiled destination access is shared with the receiver
+    RKPropertyMappingPlan *plan = [RKPropertyMappingPlan new];
+    plan.propertyMapping = self.propertyMapping;
+    plan.sourceKeyPath = [_sourceKeyPathTemplate componentsJoinedByString:value];
+    plan.sourceKeyPathComponents = RKKeyPathComponents(plan.sourceKeyPath);
+    plan.destinationKeyPath = self.destinationKeyPath;
+    plan.destinationKeyPathComponents = self.destinationKeyPathComponents;
+    plan.destinationClass = self.destinationClass;
+    plan.destinationPrimitive = self.isDestinationPrimitive;
+    plan.nestingAttribute = self.isNestingAttribute;
+    plan.canSetPrimitiveValue = self.canSetPrimitiveValue;
+    [plan compileSourceAccess];
+    plan->_setterClass = _setterClass;
+    plan->_setterSelector = _setterSelector;
+    plan->_setterIMP = _setterIMP;
+    return plan;
+}
+
+- (void)setValue:(id)value onObject:(id)object
+{
+    // Objects whose class has been swapped at runtime (i.e. by key-value observing) must go through KVC to trigger change notifications
+    if (_setterIMP && object_getClass(object) == _setterClass) {
+        _setterIMP(object, _setterSelector, value);
+    } else {
+        [object setValue:value forKeyPath:self.destinationKeyPath];
+    }
+}
+
+- (void)setPrimitiveValue:(id)value onObject:(id)object
+{
+    NSAssert(self.canSetPrimitiveValue, @"Cannot set the primitive value of the destination key path '%@'", self.destinationKeyPath);
+    [(id<RKPrimitiveValueSetting>)object setPrimitiveValue:value forKey:self.destinationKeyPath];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p %@ => %@ (%@)>", self.class, self, self.sourceKeyPath, self.destinationKeyPath, NSStringFromClass(self.destinationClass)];
+}
+
+@end
+
+@interface RKObjectMappingPlan ()
+@property (nonatomic, weak, readwrite) Class objectClass;
+@property (nonatomic, copy, readwrite) NSArray *attributePlans;
+@property (nonatomic, copy, readwrite) NSArray *keyAttributePlans;
+@property (nonatomic, copy, readwrite) NSArray *keyPathAttributePlans;
+@property (nonatomic, copy, readwrite) NSArray *relationshipPlans;
+@property (nonatomic, strong, readwrite) RKPropertyMappingPlan *attributePlanFromKeyOfRepresentation;
+@property (nonatomic, strong, readwrite) RKPropertyMappingPlan *attributePlanToKeyOfRepresentation;
+@property (nonatomic, assign, readwrite) RKGeneratedMappingFunction generatedMappingFunction;
+@property (nonatomic, copy) NSString *nestingAttributeName;
+@property (nonatomic, assign) BOOL hasNestingTemplates;
+@end
+
+@implementation RKObjectMappingPlan
+
+- (instancetype)init
+{
+    return [self initWithObjectMapping:nil propertyMappings:nil];
+}
+
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping
+{
+    return [self initWithObjectMapping:objectMapping propertyMappings:objectMapping.propertyMappings];
+}
+
+- (instancetype)initWithObjectMapping:(RKObjectMapping *)objectMapping propertyMappings:(NSArray *)propertyMappings
+{
+    self = [super init];
+    if (self) {
+        self.objectClass = objectMapping.objectClass;
+
+        NSMutableArray *attributePlans = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *keyAttributePlans = [NSMutableArray arrayWithCapacity:[propertyMappings count]];
+        NSMutableArray *keyPathAttributePlans = [NSMutableArray array];
+        NSMutableArray *relationshipPlans = [NSMutableArray array];
+        for (RKPropertyMapping *propertyMapping in propertyMappings) {
+            RKPropertyMappingPlan *plan = [[RKPropertyMappingPlan alloc] initWithPropertyMapping:propertyMapping objectMapping:objectMapping];
+            if ([propertyMapping isMemberOfClass:[RKRelationshipMapping class]]) {
+                [relationshipPlans addObject:plan];
+            } else if ([propertyMapping isMemberOfClass:[RKAttributeMapping class]]) {
+                // Mirror the partitioning performed by `RKObjectMapping`: single keys are mapped before relationships, key paths after
+                NSMutableArray *plans = ([plan.sourceKeyPathComponents count] > 1) ? keyPathAttributePlans : keyAttributePlans;
+                [plans addObject:plan];
+                [attributePlans addObject:plan];
+                if ([plan.sourceKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) self.attributePlanFromKeyOfRepresentation = plan;
+                if ([plan.destinationKeyPath isEqualToString:RKObjectMappingNestingAttributeKeyName]) self.attributePlanToKeyOfRepresentation = plan;
+            }
+        }
+        self.attributePlans = attributePlans;
+        self.keyAttributePlans = keyAttributePlans;
+        self.keyPathAttributePlans = keyPathAttributePlans;
+        self.relationshipPlans = relationshipPlans;
+
+        // Mirror `RKMappingOperation`, which substitutes the serialization attribute when both nesting attributes are mapped
+        self.nestingAttributeName = self.attributePlanToKeyOfRepresentation.sourceKeyPath ?: self.attributePlanFromKeyOfRepresentation.destinationKeyPath;
+        if (self.nestingAttributeName) {
+            for (RKPropertyMappingPlan *plan in [attributePlans arrayByAddingObjectsFromArray:relationshipPlans]) {
+                if ([plan compileTemplatesForNestingAttributeNamed:self.nestingAttributeName]) self.hasNestingTemplates = YES;
+            }
+        }
+
+        if (objectMapping) self.generatedMappingFunction = RKGeneratedMappingFunctionForSignature(RKGeneratedMappingSignatureForPlan(self));
+    }
+    return self;
+}
+
+- (RKObjectMappingPlan *)planBySubstitutingValue:(id)value forNestingAttribute:(NSString *)attributeName objectMapping:(RKObjectMapping *)objectMapping
+{
+    if (! attributeName) return self;
+    if (! [attributeName isEqualToString:self.nestingAttributeName]) {
+        // The templates were compiled for a different attribute, so substitute into the property mappings and compile the result
+        return [[RKObjectMappingPlan alloc] initWithObjectMapping:objectMapping propertyMappings:RKApplyNestingAttributeValueToMappings(attributeName, value, objectMapping.propertyMappings)];
+    }
+    if (! self.hasNestingTemplates) return self;
+
+    NSString *replacement = [value isKindOfClass:[NSString class]] ? value : [NSString stringWithFormat:@"%@", value];
+    NSMutableArray *attributePlans = [NSMutableArray arrayWithCapacity:[self.attributePlans count]];
+    NSMutableArray *keyAttributePlans = [NSMutableArray arrayWithCapacity:[self.attributePlans count]];
+    NSMutableArray *keyPathAttributePlans = [NSMutableArray array];
+    for (RKPropertyMappingPlan *plan in self.attributePlans) {
+        RKPropertyMappingPlan *substitutedPlan = [plan planBySubstitutingNestingAttributeValue:replacement forAttributeNamed:attributeName objectMapping:objectMapping];
+        NSMutableArray *plans = ([substitutedPlan.sourceKeyPathComponents count] > 1) ? keyPathAttributePlans : keyAttributePlans;
+        [plans addObject:substitutedPlan];
+        [attributePlans addObject:substitutedPlan];
+    }
+    NSMutableArray *relationshipPlans = [NSMutableArray arrayWithCapacity:[self.relationshipPlans count]];
+    for (RKPropertyMappingPlan *plan in self.relationshipPlans) {
+        [relationshipPlans addObject:[plan planBySubstitutingNestingAttributeValue:replacement forAttributeNamed:attributeName objectMapping:objectMapping]];
+    }
+
+    RKObjectMappingPlan *substitutedPlan = [[RKObjectMappingPlan alloc] initWithObjectMapping:nil propertyMappings:nil];
+    substitutedPlan.objectClass = self.objectClass;
+    substitutedPlan.attributePlans = attributePlans;
+    substitutedPlan.keyAttributePlans = keyAttributePlans;
+    substitutedPlan.keyPathAttributePlans = keyPathAttributePlans;
+    substitutedPlan.relationshipPlans = relationshipPlans;
+    substitutedPlan.attributePlanFromKeyOfRepresentation = self.attributePlanFromKeyOfRepresentation;
+    substitutedPlan.attributePlanToKeyOfRepresentation = self.attributePlanToKeyOfRepresentation;
+    return substitutedPlan;
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p objectClass=%@ keyAttributePlans=%@ keyPathAttributePlans=%@ relationshipPlans=%@>",
+            self.class, self, NSStringFromClass(self.objectClass), self.keyAttributePlans, self.keyPathAttributePlans, self.relationshipPlans];
+}
+
+@end
@@ -81,6 +81,16 @@ BOOL RKObjectIsCollectionContainingOnlyManagedObjects(id object);
  */
 BOOL RKObjectIsCollectionOfCollections(id object);
 
+/**
+ Returns a 64-bit fingerprint of the content of the given object.
+
+ Unlike `hash`, the fingerprint accounts for the full content of strings, data and nested arrays, sets and dictionaries, making it suitable for detecting changes between deserialized object representations. Dictionaries and sets are fingerprinted independently of their enumeration order. Objects of other classes contribute their `hash`.
+
+ @param object The object to fingerprint. May be `nil`.
+ @return A fingerprint of the content of the object.
+ */
+uint64_t RKFingerprintForObject(id object);
+
 /**
  Returns an appropriate class to use for KVC access based on the Objective C runtime type encoding.
  
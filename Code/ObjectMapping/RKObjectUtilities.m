@@ -62,6 +62,94 @@ BOOL RKObjectIsCollectionOfCollections(id object)
     return RKObjectIsCollection(collectionSanityCheckObject);
 }
 
+static inline uint64_t RKFingerprintCombine(uint64_t fingerprint, uint64_t value)
+{
+    // The splitmix64 finalizer, applied to the accumulated fingerprint and the incoming value
+    uint64_t z = fingerprint ^ (value + 0x9E3779B97F4A7C15ULL + (fingerprint << 6) + (fingerprint >> 2));
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+    return z ^ (z >> 31);
+}
+
+static uint64_t RKFingerprintCombineBytes(uint64_t fingerprint, const void *bytes, NSUInteger length)
+{
+    // FNV-1a
+    const uint8_t *byte = bytes;
+    uint64_t hash = 0xCBF29CE484222325ULL;
+    for (NSUInteger index = 0; index < length; index++) {
+        hash ^= byte[index];
+        hash *= 0x100000001B3ULL;
+    }
+    return RKFingerprintCombine(fingerprint, hash);
+}
+
+uint64_t RKFingerprintForObject(id object)
+{
+    if (object == nil) return RKFingerprintCombine(0, 'n');
+    if (object == [NSNull null]) return RKFingerprintCombine(0, 'N');
+
+    if ([object isKindOfClass:[NSString class]]) {
+        NSString *string = object;
+        NSUInteger length = [string length];
+        uint64_t fingerprint = RKFingerprintCombine('s', length);
+        unichar buffer[128];
+        for (NSUInteger location = 0; location < length; location += 128) {
+            NSRange range = NSMakeRange(location, MIN((NSUInteger)128, length - location));
+            [string getCharacters:buffer range:range];
+            fingerprint = RKFingerprintCombineBytes(fingerprint, buffer, range.length * sizeof(unichar));
+        }
+        return fingerprint;
+    }
+
+    if ([object isKindOfClass:[NSNumber class]]) {
+        // The type encoding distinguishes Booleans and floating point values from integers of the same magnitude
+        double doubleValue = [object doubleValue];
+        uint64_t doubleBits;
+        memcpy(&doubleBits, &doubleValue, sizeof(doubleBits));
+        uint64_t fingerprint = RKFingerprintCombine('#', (uint64_t)*[object objCType]);
+        fingerprint = RKFingerprintCombine(fingerprint, doubleBits);
+        return RKFingerprintCombine(fingerprint, (uint64_t)[object longLongValue]);
+    }
+
+    if ([object isKindOfClass:[NSDictionary class]]) {
+        // Sum the fingerprints of the entries so that enumeration order does not matter
+        __block uint64_t entries = 0;
+        [object enumerateKeysAndObjectsUsingBlock:^(id key, id value, BOOL *stop) {
+            entries += RKFingerprintCombine(RKFingerprintForObject(key), RKFingerprintForObject(value));
+        }];
+        return RKFingerprintCombine(RKFingerprintCombine('d', [object count]), entries);
+    }
+
+    if ([object isKindOfClass:[NSArray class]] || [object isKindOfClass:[NSOrderedSet class]]) {
+        uint64_t fingerprint = RKFingerprintCombine('a', [object count]);
+        for (id element in object) {
+            fingerprint = RKFingerprintCombine(fingerprint, RKFingerprintForObject(element));
+        }
+        return fingerprint;
+    }
+
+    if ([object isKindOfClass:[NSSet class]]) {
+        uint64_t elements = 0;
+        for (id element in object) {
+            elements += RKFingerprintForObject(element);
+        }
+        return RKFingerprintCombine(RKFingerprintCombine('t', [object count]), elements);
+    }
+
+    if ([object isKindOfClass:[NSData class]]) {
+        return RKFingerprintCombineBytes(RKFingerprintCombine('b', [object length]), [object bytes], [object length]);
+    }
+
+    if ([object isKindOfClass:[NSDate class]]) {
+        NSTimeInterval timeInterval = [object timeIntervalSinceReferenceDate];
+        uint64_t timeIntervalBits;
+        memcpy(&timeIntervalBits, &timeInterval, sizeof(timeIntervalBits));
+        return RKFingerprintCombine('D', timeIntervalBits);
+    }
+
+    return RKFingerprintCombine(RKFingerprintCombine('o', (uint64_t)[object hash]), (uint64_t)(uintptr_t)[object class]);
+}
+
 Class RKKeyValueCodingClassForObjCType(const char *type)
 {
     if (type) {
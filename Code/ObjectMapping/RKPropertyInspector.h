@@ -54,6 +54,8 @@
 
 /**
  The `RKPropertyInspector` class provides an interface for introspecting the properties and attributes of classes using the reflection capabilities of the Objective-C runtime. Once inspected, the properties inspection details are cached.
+
+ Cached inspections are published as immutable snapshots, so lookups of previously inspected classes do not synchronize with other threads.
  */
 @interface RKPropertyInspector : NSObject
 
@@ -90,6 +92,18 @@
  */
 - (Class)classForPropertyNamed:(NSString *)propertyName ofClass:(Class)objectClass isPrimitive:(BOOL *)isPrimitive;
 
+/**
+ Returns the `Class` object specifying the type of the property at the given key path of a class.
+
+ Each component of the key path is resolved against the class of the property named by the previous component. The result of resolving a key path against a class, including a failure to resolve it, is memoized so that subsequent lookups perform a single dictionary access.
+
+ @param keyPath The key path to the property to retrieve the type of.
+ @param objectClass The class to evaluate the key path against.
+ @param isPrimitive A pointer to a Boolean value to set indicating if the property at the key path is of a primitive (non-object) type.
+ @return A `Class` object specifying the type of the property at the key path, or `Nil` if the key path could not be resolved.
+ */
+- (Class)classForPropertyAtKeyPath:(NSString *)keyPath ofClass:(Class)objectClass isPrimitive:(BOOL *)isPrimitive;
+
 @end
 
 ///----------------------------
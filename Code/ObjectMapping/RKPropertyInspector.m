@@ -58,7 +58,9 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
 #else
 @property (nonatomic, assign) dispatch_queue_t queue;
 #endif
-@property (nonatomic, strong) NSMutableDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *inspectionCache;
+@property (atomic, copy) NSDictionary *keyPathInspectionCache;
+- (void)cacheInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key;
 @end
 
 @implementation RKPropertyInspector
@@ -78,9 +80,10 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
 {
     self = [super init];
     if (self) {
-        // NOTE: We use an `NSMutableDictionary` because it is *much* faster than `NSCache` on lookup
-        self.inspectionCache = [NSMutableDictionary dictionary];
-        self.queue = dispatch_queue_create("org.restkit.core-data.property-inspection-queue", DISPATCH_QUEUE_CONCURRENT);
+        // NOTE: The caches are immutable snapshots that are read without synchronization and replaced wholesale on the serial queue when a new entry is added
+        self.inspectionCache = @{};
+        self.keyPathInspectionCache = @{};
+        self.queue = dispatch_queue_create("org.restkit.core-data.property-inspection-queue", DISPATCH_QUEUE_SERIAL);
     }
 
     return self;
@@ -94,12 +97,20 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
     _queue = NULL;
 }
 
-- (NSDictionary *)propertyInspectionForClass:(Class)objectClass
+- (void)cacheInspection:(NSDictionary *)inspection forKey:(id<NSCopying>)key
 {
-    __block NSMutableDictionary *inspection;
+    /* dispatch_barrier_async is dangerous if we are called from +initialize */
     dispatch_sync(self.queue, ^{
-        inspection = (self.inspectionCache)[objectClass];
+        NSMutableDictionary *inspectionCache = [self.inspectionCache mutableCopy];
+        inspectionCache[key] = inspection;
+        self.inspectionCache = inspectionCache;
+        RKLogDebug(@"Cached property inspection for '%@': %@", key, inspection);
     });
+}
+
+- (NSDictionary *)propertyInspectionForClass:(Class)objectClass
+{
+    NSMutableDictionary *inspection = (self.inspectionCache)[objectClass];
     if (inspection) return inspection;
     
     inspection = [NSMutableDictionary dictionary];
@@ -148,11 +159,7 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
         currentClass = (superclass == [NSObject class] || (nsManagedObject && superclass == nsManagedObject)) ? nil : superclass;
     }
 
-    /* dispatch_barrier_async is dangerous if we are called from +initialize */
-    dispatch_barrier_sync(self.queue, ^{
-        (self.inspectionCache)[(id<NSCopying>)objectClass] = inspection;
-        RKLogDebug(@"Cached property inspection for Class '%@': %@", NSStringFromClass(objectClass), inspection);
-    });
+    [self cacheInspection:inspection forKey:(id<NSCopying>)objectClass];
     return inspection;
 }
 
@@ -164,6 +171,36 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
     return propertyInspection.keyValueCodingClass;
 }
 
+- (Class)classForPropertyAtKeyPath:(NSString *)keyPath ofClass:(Class)objectClass isPrimitive:(BOOL *)isPrimitive
+{
+    if (! keyPath || ! objectClass) return nil;
+    RKPropertyInspectorPropertyInfo *resolution = (self.keyPathInspectionCache)[objectClass][keyPath];
+    if (! resolution) {
+        BOOL isPrimitiveProperty = NO;
+        Class propertyClass = objectClass;
+        if ([keyPath rangeOfString:@"." options:NSLiteralSearch].length == 0) {
+            propertyClass = [self classForPropertyNamed:keyPath ofClass:propertyClass isPrimitive:&isPrimitiveProperty];
+        } else {
+            for (NSString *property in [keyPath componentsSeparatedByString:@"."]) {
+                propertyClass = [self classForPropertyNamed:property ofClass:propertyClass isPrimitive:&isPrimitiveProperty];
+                if (! propertyClass) break;
+            }
+        }
+
+        // Unresolvable key paths are memoized as well, with a `Nil` class
+        resolution = [RKPropertyInspectorPropertyInfo propertyInfoWithName:keyPath keyValueClass:propertyClass isPrimitive:isPrimitiveProperty];
+        dispatch_sync(self.queue, ^{
+            NSMutableDictionary *keyPathInspectionCache = [self.keyPathInspectionCache mutableCopy];
+            NSMutableDictionary *resolutionsByKeyPath = [keyPathInspectionCache[objectClass] mutableCopy] ?: [NSMutableDictionary dictionary];
+            resolutionsByKeyPath[keyPath] = resolution;
+            keyPathInspectionCache[(id<NSCopying>)objectClass] = resolutionsByKeyPath;
+            self.keyPathInspectionCache = keyPathInspectionCache;
+        });
+    }
+    if (isPrimitive) *isPrimitive = resolution.isPrimitive;
+    return resolution.keyValueCodingClass;
+}
+
 @end
 
 
@@ -175,21 +212,7 @@ NSString * const RKPropertyInspectionIsPrimitiveKey = @"isPrimitive";
 
 - (Class)rk_classForPropertyAtKeyPath:(NSString *)keyPath isPrimitive:(BOOL *)isPrimitive
 {
-    NSRange dotRange = [keyPath rangeOfString:@"." options:NSLiteralSearch];
-    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
-    Class propertyClass = [self class];
-    
-    if (dotRange.length == 0) {
-        return [inspector classForPropertyNamed:keyPath ofClass:propertyClass isPrimitive:isPrimitive];
-    }
-
-    NSArray *components = [keyPath componentsSeparatedByString:@"."];
-    for (NSString *property in components) {
-        propertyClass = [inspector classForPropertyNamed:property ofClass:propertyClass isPrimitive:isPrimitive];
-        if (! propertyClass) break;
-    }
-    
-    return propertyClass;
+    return [[RKPropertyInspector sharedInspector] classForPropertyAtKeyPath:keyPath ofClass:[self class] isPrimitive:isPrimitive];
 }
 
 @end
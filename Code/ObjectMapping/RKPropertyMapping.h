@@ -67,6 +67,65 @@
  */
 @property (nonatomic, strong) id<RKValueTransforming> valueTransformer;
 
+///-------------------------------------
+/// @name Transforming Values
+///-------------------------------------
+
+/**
+ Transforms a value into an instance of the given class with the `valueTransformer` of the receiver.
+
+ When the value transformer is an `RKCompoundValueTransformer`, the receiver resolves the transformers able to transform the class of the input value into the output class once per pair of classes and memoizes them. Each value is then handed to the memoized transformers in the order of the compound value transformer, and the first that succeeds produces the result, exactly as if the value had been transformed by the compound value transformer itself. If no transformer succeeds, the value is transformed by the compound value transformer so that the error returned is identical.
+
+ The memoized transformers are discarded when the value transformer of the receiver is replaced or its contents are changed with `addValueTransformer:`, `insertValueTransformer:atIndex:` or `removeValueTransformer:`.
+
+ @param inputValue The value to be transformed.
+ @param outputValue A pointer to an object that is set to the transformed value upon success.
+ @param outputValueClass The class of the desired output value.
+ @param error A pointer to an error object that is set if the transformation failed.
+ @return `YES` if the value was transformed successfully.
+ */
+- (BOOL)transformValue:(id)inputValue toValue:(id *)outputValue ofClass:(Class)outputValueClass error:(NSError **)error;
+
+/**
+ Transforms a value into an instance of the given class with the `valueTransformer` of the receiver, and reports the value transformer that performed the transformation.
+
+ @param inputValue The value to be transformed.
+ @param outputValue A pointer to an object that is set to the transformed value upon success.
+ @param outputValueClass The class of the desired output value.
+ @param appliedValueTransformer A pointer to an object that is set to the value transformer that transformed the value: the transformer of a compound value transformer that succeeded or, if the value transformer of the receiver is not compound or none of its transformers succeeded, the value transformer of the receiver. May be `NULL`.
+ @param error A pointer to an error object that is set if the transformation failed.
+ @return `YES` if the value was transformed successfully.
+ @see `transformValue:toValue:ofClass:error:`
+ */
+- (BOOL)transformValue:(id)inputValue toValue:(id *)outputValue ofClass:(Class)outputValueClass appliedValueTransformer:(id<RKValueTransforming> *)appliedValueTransformer error:(NSError **)error;
+
+/**
+ Returns the transformers that the receiver consults, in order, when transforming values of the given class into instances of the destination class.
+
+ If the value transformer of the receiver is not an `RKCompoundValueTransformer`, an array containing only the value transformer is returned.
+
+ @param sourceClass The class of the values to be transformed.
+ @param destinationClass The class of the transformed values.
+ @return An array of the value transformers able to perform the transformation, in the order in which they are consulted.
+ */
+- (NSArray *)valueTransformersForTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass;
+
+///-------------------------------------
+/// @name Freezing the Property Mapping
+///-------------------------------------
+
+/**
+ Makes the receiver immutable. Once frozen, setting the `propertyValueClass` or `valueTransformer` of the receiver raises an `NSInternalInconsistencyException`. Relationship mappings also freeze the mapping they target.
+
+ Property mappings are frozen by the `freeze` method of the object mapping they were added to.
+ */
+- (void)freeze;
+
+/**
+ Returns a Boolean value that indicates if the receiver has been frozen.
+ */
+@property (nonatomic, readonly, getter=isFrozen) BOOL frozen;
+
 ///----------------------------------
 /// @name Comparing Property Mappings
 ///----------------------------------
@@ -20,6 +20,9 @@
 
 #import "RKPropertyMapping.h"
 #import "RKObjectMapping.h"
+#import "RKMapping_Private.h"
+#import "RKValueTransformers.h"
+#import "RKCompoundValueTransformer+RKAdditions.h"
 
 /**
  For consistency with URI Templates (and most web templating languages in general) we are transitioning
@@ -30,15 +33,76 @@ static NSString *RKStringByReplacingUnderscoresWithBraces(NSString *string)
     return [[string stringByReplacingOccurrencesOfString:@"(" withString:@"{"] stringByReplacingOccurrencesOfString:@")" withString:@"}"];
 }
 
+/**
+ An immutable table of the transformers of a compound value transformer able to transform one class into another, in the order in which the compound value transformer consults them. Tables are replaced rather than mutated, so that they can be read without locking.
+ */
+@interface RKValueTransformerResolutionTable : NSObject
+@property (nonatomic, strong, readonly) RKCompoundValueTransformer *valueTransformer;
+@property (nonatomic, copy, readonly) NSArray *contents; // The value transformers of the compound value transformer when the table was created
+- (instancetype)initWithValueTransformer:(RKCompoundValueTransformer *)valueTransformer contents:(NSArray *)contents valueTransformersBySourceClass:(NSMapTable *)valueTransformersBySourceClass;
+- (BOOL)isValidForValueTransformer:(RKCompoundValueTransformer *)valueTransformer;
+- (NSArray *)valueTransformersForTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass;
+- (instancetype)tableByAddingValueTransformers:(NSArray *)valueTransformers forTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass;
+@end
+
+@implementation RKValueTransformerResolutionTable {
+    // Arrays of value transformers keyed by source class, then destination class
+    NSMapTable *_valueTransformersBySourceClass;
+}
+
+static NSMapTable *RKClassKeyedMapTable(void)
+{
+    return [NSMapTable mapTableWithKeyOptions:NSPointerFunctionsOpaqueMemory | NSPointerFunctionsOpaquePersonality valueOptions:NSPointerFunctionsStrongMemory];
+}
+
+- (instancetype)initWithValueTransformer:(RKCompoundValueTransformer *)valueTransformer contents:(NSArray *)contents valueTransformersBySourceClass:(NSMapTable *)valueTransformersBySourceClass
+{
+    self = [super init];
+    if (self) {
+        _valueTransformer = valueTransformer;
+        _contents = [contents copy];
+        _valueTransformersBySourceClass = valueTransformersBySourceClass ?: RKClassKeyedMapTable();
+    }
+    return self;
+}
+
+// Frozen compound value transformers cannot change, so their contents need not be compared
+- (BOOL)isValidForValueTransformer:(RKCompoundValueTransformer *)valueTransformer
+{
+    if (self.valueTransformer != valueTransformer) return NO;
+    return [valueTransformer isFrozen] || RKCompoundValueTransformerContainsValueTransformers(valueTransformer, self.contents);
+}
+
+- (NSArray *)valueTransformersForTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass
+{
+    return [[_valueTransformersBySourceClass objectForKey:sourceClass] objectForKey:destinationClass];
+}
+
+- (instancetype)tableByAddingValueTransformers:(NSArray *)valueTransformers forTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass
+{
+    NSMapTable *valueTransformersBySourceClass = [_valueTransformersBySourceClass copy];
+    NSMapTable *valueTransformersByDestinationClass = [[_valueTransformersBySourceClass objectForKey:sourceClass] copy] ?: RKClassKeyedMapTable();
+    [valueTransformersByDestinationClass setObject:valueTransformers forKey:destinationClass];
+    [valueTransformersBySourceClass setObject:valueTransformersByDestinationClass forKey:sourceClass];
+    return [[[self class] alloc] initWithValueTransformer:self.valueTransformer contents:self.contents valueTransformersBySourceClass:valueTransformersBySourceClass];
+}
+
+@end
+
 @interface RKPropertyMapping ()
 // Synthesize as read/write to allow assignment in `RKObjectMapping`
 @property (nonatomic, weak, readwrite) RKObjectMapping *objectMapping;
 @property (nonatomic, copy, readwrite) NSString *sourceKeyPath;
 @property (nonatomic, copy, readwrite) NSString *destinationKeyPath;
+@property (nonatomic, assign, readwrite, getter=isFrozen) BOOL frozen;
+// The transformers resolved from the compound value transformer of the receiver, published atomically
+@property (atomic, strong) RKValueTransformerResolutionTable *valueTransformerResolutionTable;
 @end
 
 @implementation RKPropertyMapping
 
+@synthesize valueTransformer = _valueTransformer;
+
 - (id)copyWithZone:(NSZone *)zone
 {
     RKPropertyMapping *copy = [[[self class] allocWithZone:zone] init];
@@ -71,9 +135,77 @@ static NSString *RKStringByReplacingUnderscoresWithBraces(NSString *string)
     return [NSString stringWithFormat:@"<%@: %p %@ => %@>", self.class, self, self.sourceKeyPath, self.destinationKeyPath];
 }
 
+- (void)setPropertyValueClass:(Class)propertyValueClass
+{
+    RKRaiseIfFrozen();
+    _propertyValueClass = propertyValueClass;
+}
+
+- (void)setValueTransformer:(id<RKValueTransforming>)valueTransformer
+{
+    RKRaiseIfFrozen();
+    _valueTransformer = valueTransformer;
+}
+
+- (void)freeze
+{
+    if ([_valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) _valueTransformer = [(RKCompoundValueTransformer *)_valueTransformer frozenCopy];
+    self.frozen = YES;
+}
+
 - (id<RKValueTransforming>)valueTransformer
 {
     return _valueTransformer ?: [self.objectMapping valueTransformer];
 }
 
+#pragma mark - Transforming Values
+
+- (NSArray *)valueTransformersOfCompoundValueTransformer:(RKCompoundValueTransformer *)valueTransformer forTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass
+{
+    RKValueTransformerResolutionTable *table = self.valueTransformerResolutionTable;
+    if (! [table isValidForValueTransformer:valueTransformer]) {
+        table = [[RKValueTransformerResolutionTable alloc] initWithValueTransformer:valueTransformer contents:RKValueTransformersOfCompoundValueTransformer(valueTransformer) valueTransformersBySourceClass:nil];
+    }
+
+    NSArray *valueTransformers = [table valueTransformersForTransformingFromClass:sourceClass toClass:destinationClass];
+    if (! valueTransformers) {
+        // Concurrent resolutions may each publish a table lacking the other's entry, which is merely resolved again
+        valueTransformers = [valueTransformer valueTransformersForTransformingFromClass:sourceClass toClass:destinationClass] ?: @[];
+        self.valueTransformerResolutionTable = [table tableByAddingValueTransformers:valueTransformers forTransformingFromClass:sourceClass toClass:destinationClass];
+    }
+    return valueTransformers;
+}
+
+- (NSArray *)valueTransformersForTransformingFromClass:(Class)sourceClass toClass:(Class)destinationClass
+{
+    id<RKValueTransforming> valueTransformer = self.valueTransformer;
+    if (! [valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) return valueTransformer ? @[ valueTransformer ] : @[];
+    return [self valueTransformersOfCompoundValueTransformer:(RKCompoundValueTransformer *)valueTransformer forTransformingFromClass:sourceClass toClass:destinationClass];
+}
+
+- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue ofClass:(Class)outputValueClass error:(NSError *__autoreleasing *)error
+{
+    return [self transformValue:inputValue toValue:outputValue ofClass:outputValueClass appliedValueTransformer:NULL error:error];
+}
+
+- (BOOL)transformValue:(id)inputValue toValue:(__autoreleasing id *)outputValue ofClass:(Class)outputValueClass appliedValueTransformer:(__autoreleasing id<RKValueTransforming> *)appliedValueTransformer error:(NSError *__autoreleasing *)error
+{
+    id<RKValueTransforming> valueTransformer = self.valueTransformer;
+    if (appliedValueTransformer) *appliedValueTransformer = valueTransformer;
+    if (! [valueTransformer isKindOfClass:[RKCompoundValueTransformer class]]) {
+        return [valueTransformer transformValue:inputValue toValue:outputValue ofClass:outputValueClass error:error];
+    }
+
+    NSArray *valueTransformers = [self valueTransformersOfCompoundValueTransformer:(RKCompoundValueTransformer *)valueTransformer forTransformingFromClass:[inputValue class] toClass:outputValueClass];
+    for (id<RKValueTransforming> candidateValueTransformer in valueTransformers) {
+        if ([candidateValueTransformer transformValue:inputValue toValue:outputValue ofClass:outputValueClass error:nil]) {
+            if (appliedValueTransformer) *appliedValueTransformer = candidateValueTransformer;
+            return YES;
+        }
+    }
+
+    // None of the transformers succeeded, so let the compound transformer report the failure
+    return [valueTransformer transformValue:inputValue toValue:outputValue ofClass:outputValueClass error:error];
+}
+
 @end
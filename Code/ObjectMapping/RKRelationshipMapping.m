@@ -19,7 +19,7 @@
 //
 
 #import "RKRelationshipMapping.h"
-#import "RKMapping.h"
+#import "RKMapping_Private.h"
 
 @interface RKPropertyMapping ()
 @property (nonatomic, copy, readwrite) NSString *sourceKeyPath;
@@ -58,6 +58,18 @@
     return copy;
 }
 
+- (void)setAssignmentPolicy:(RKAssignmentPolicy)assignmentPolicy
+{
+    RKRaiseIfFrozen();
+    _assignmentPolicy = assignmentPolicy;
+}
+
+- (void)freeze
+{
+    [super freeze];
+    [self.mapping freeze];
+}
+
 - (BOOL)isEqualToMapping:(RKRelationshipMapping *)otherMapping
 {
     if (! [otherMapping isMemberOfClass:[RKRelationshipMapping class]]) return NO;
@@ -29,3 +29,5 @@
 #import "RKNSJSONSerialization.h"
 #import "RKMIMETypeSerialization.h"
 #import "RKStringTokenizer.h"
+#import "RKJSONStreamReader.h"
+#import "RKDateParsing.h"
@@ -0,0 +1,51 @@
+//
+//  RKDateParsing.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ Parses an ISO 8601 timestamp in the extended calendar date format with an explicit time zone designator, such as `2011-10-05T14:48:00.125Z` or `2011-10-05T14:48:00-0500`.
+
+ The characters of the string are read directly from its internal UTF-8 or UTF-16 buffer (or from a stack copy when neither is available) and no objects are created. Seconds, fractional seconds and the minutes of the time zone offset are optional. Timestamps without a time zone designator, in other ISO 8601 formats (i.e. week or ordinal dates) or with years before 1583 are not parsed, as their interpretation depends on the default time zone or calendar of the formatter in use; callers are expected to fall back to a date formatter for these strings.
+
+ @param string The string to parse.
+ @param timeInterval On output, the number of seconds since January 1, 1970 00:00 UTC represented by the string.
+ @return `YES` if the string was parsed, else `NO`.
+ */
+BOOL RKGetTimeIntervalFromISO8601String(NSString *string, NSTimeInterval *timeInterval);
+
+/**
+ Parses an ASP.NET style date string of the form `/Date(1112715000000-0500)/`.
+
+ The string is parsed without creating any objects, as for `RKGetTimeIntervalFromISO8601String`. Matching the behavior of `RKDotNetDateFormatter`, the time zone offset is optional and is ignored when present.
+
+ @param string The string to parse.
+ @param timeInterval On output, the number of seconds since January 1, 1970 00:00 UTC represented by the string.
+ @return `YES` if the string was parsed, else `NO`.
+ */
+BOOL RKGetTimeIntervalFromDotNetDateString(NSString *string, NSTimeInterval *timeInterval);
+
+#ifdef __cplusplus
+}
+#endif
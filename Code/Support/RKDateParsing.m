@@ -0,0 +1,192 @@
+//
+//  RKDateParsing.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKDateParsing.h"
+
+// Longer strings are not dates in any of the supported formats
+#define RKDateParsingMaximumLength 64
+
+// The first year of the Gregorian calendar as implemented by `NSCalendar`, which uses the Julian calendar for earlier dates
+static const NSInteger RKDateParsingMinimumYear = 1583;
+
+/**
+ Returns the ASCII characters of the given string, read from the internal buffer of the string when it is available or copied into the given stack buffer otherwise. Returns `NULL` if the string is empty, too long or contains non-ASCII characters.
+ */
+static const char *RKDateParsingGetCharacters(NSString *string, char *buffer, CFIndex *length)
+{
+    if (! string) return NULL;
+    CFStringRef stringRef = (__bridge CFStringRef)string;
+    CFIndex count = CFStringGetLength(stringRef);
+    if (count == 0 || count > RKDateParsingMaximumLength) return NULL;
+    *length = count;
+
+    // Any non-ASCII character in a UTF-8 buffer begins within the first `count` bytes and is rejected by the parsers
+    const char *bytes = CFStringGetCStringPtr(stringRef, kCFStringEncodingUTF8);
+    if (bytes) return bytes;
+
+    UniChar characterBuffer[RKDateParsingMaximumLength];
+    const UniChar *characters = CFStringGetCharactersPtr(stringRef);
+    if (! characters) {
+        CFStringGetCharacters(stringRef, CFRangeMake(0, count), characterBuffer);
+        characters = characterBuffer;
+    }
+    for (CFIndex index = 0; index < count; index++) {
+        if (characters[index] > 0x7F) return NULL;
+        buffer[index] = (char)characters[index];
+    }
+    return buffer;
+}
+
+static BOOL RKDateParsingScanDigits(const char *characters, CFIndex length, CFIndex *index, CFIndex count, NSInteger *value)
+{
+    if (*index + count > length) return NO;
+    NSInteger result = 0;
+    for (CFIndex offset = 0; offset < count; offset++) {
+        char character = characters[*index + offset];
+        if (character < '0' || character > '9') return NO;
+        result = result * 10 + (character - '0');
+    }
+    *index += count;
+    *value = result;
+    return YES;
+}
+
+static BOOL RKDateParsingScanCharacter(const char *characters, CFIndex length, CFIndex *index, char character)
+{
+    if (*index >= length || characters[*index] != character) return NO;
+    (*index)++;
+    return YES;
+}
+
+static NSInteger RKDateParsingDaysInMonth(NSInteger year, NSInteger month)
+{
+    static const NSInteger daysInMonth[] = { 31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31 };
+    BOOL isLeapYear = ((year % 4 == 0 && year % 100 != 0) || year % 400 == 0);
+    return (month == 2 && isLeapYear) ? 29 : daysInMonth[month - 1];
+}
+
+// Returns the number of days between the given proleptic Gregorian date and January 1, 1970
+static int64_t RKDateParsingDaysSince1970(NSInteger year, NSInteger month, NSInteger day)
+{
+    int64_t adjustedYear = year - (month <= 2 ? 1 : 0);
+    int64_t era = adjustedYear / 400;
+    int64_t yearOfEra = adjustedYear - era * 400;
+    int64_t dayOfYear = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+    int64_t dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+    return era * 146097 + dayOfEra - 719468;
+}
+
+BOOL RKGetTimeIntervalFromISO8601String(NSString *string, NSTimeInterval *timeInterval)
+{
+    char buffer[RKDateParsingMaximumLength];
+    CFIndex length = 0;
+    const char *characters = RKDateParsingGetCharacters(string, buffer, &length);
+    if (! characters) return NO;
+
+    CFIndex index = 0;
+    NSInteger year, month, day, hour, minute, second = 0;
+    if (! (RKDateParsingScanDigits(characters, length, &index, 4, &year) && RKDateParsingScanCharacter(characters, length, &index, '-') &&
+           RKDateParsingScanDigits(characters, length, &index, 2, &month) && RKDateParsingScanCharacter(characters, length, &index, '-') &&
+           RKDateParsingScanDigits(characters, length, &index, 2, &day) && RKDateParsingScanCharacter(characters, length, &index, 'T') &&
+           RKDateParsingScanDigits(characters, length, &index, 2, &hour) && RKDateParsingScanCharacter(characters, length, &index, ':') &&
+           RKDateParsingScanDigits(characters, length, &index, 2, &minute))) return NO;
+    if (RKDateParsingScanCharacter(characters, length, &index, ':') && ! RKDateParsingScanDigits(characters, length, &index, 2, &second)) return NO;
+
+    // Fractional seconds beyond nanosecond precision are consumed but ignored
+    double fraction = 0;
+    if (RKDateParsingScanCharacter(characters, length, &index, '.') || RKDateParsingScanCharacter(characters, length, &index, ',')) {
+        NSInteger fractionDigits = 0;
+        int64_t fractionValue = 0;
+        int64_t fractionScale = 1;
+        while (index < length && characters[index] >= '0' && characters[index] <= '9') {
+            if (fractionDigits < 9) {
+                fractionValue = fractionValue * 10 + (characters[index] - '0');
+                fractionScale *= 10;
+            }
+            fractionDigits++;
+            index++;
+        }
+        if (fractionDigits == 0) return NO;
+        fraction = (double)fractionValue / (double)fractionScale;
+    }
+
+    NSInteger offset = 0;
+    if (! RKDateParsingScanCharacter(characters, length, &index, 'Z')) {
+        if (index >= length || (characters[index] != '+' && characters[index] != '-')) return NO;
+        NSInteger sign = (characters[index] == '-') ? -1 : 1;
+        index++;
+        NSInteger offsetHours, offsetMinutes = 0;
+        if (! RKDateParsingScanDigits(characters, length, &index, 2, &offsetHours)) return NO;
+        if (index < length) {
+            RKDateParsingScanCharacter(characters, length, &index, ':');
+            if (! RKDateParsingScanDigits(characters, length, &index, 2, &offsetMinutes)) return NO;
+        }
+        if (offsetHours > 23 || offsetMinutes > 59) return NO;
+        offset = sign * (offsetHours * 3600 + offsetMinutes * 60);
+    }
+    if (index != length) return NO;
+
+    if (year < RKDateParsingMinimumYear || month < 1 || month > 12 || day < 1 || day > RKDateParsingDaysInMonth(year, month)) return NO;
+    if (hour > 23 || minute > 59 || second > 59) return NO;
+
+    int64_t seconds = RKDateParsingDaysSince1970(year, month, day) * 86400 + hour * 3600 + minute * 60 + second - offset;
+    *timeInterval = (NSTimeInterval)seconds + fraction;
+    return YES;
+}
+
+BOOL RKGetTimeIntervalFromDotNetDateString(NSString *string, NSTimeInterval *timeInterval)
+{
+    char buffer[RKDateParsingMaximumLength];
+    CFIndex length = 0;
+    const char *characters = RKDateParsingGetCharacters(string, buffer, &length);
+    if (! characters) return NO;
+
+    // The prefix is matched case insensitively, as by the regular expression of `RKDotNetDateFormatter`
+    static const char prefix[] = "/date(";
+    CFIndex index = 0;
+    for (; prefix[index] != '\0'; index++) {
+        if (index >= length) return NO;
+        char character = characters[index];
+        if (character >= 'A' && character <= 'Z') character += 'a' - 'A';
+        if (character != prefix[index]) return NO;
+    }
+
+    BOOL isNegative = RKDateParsingScanCharacter(characters, length, &index, '-');
+    CFIndex digitsStart = index;
+    int64_t milliseconds = 0;
+    while (index < length && characters[index] >= '0' && characters[index] <= '9') {
+        // Eighteen digits always fit in a signed 64-bit integer
+        if (index - digitsStart == 18) return NO;
+        milliseconds = milliseconds * 10 + (characters[index] - '0');
+        index++;
+    }
+    if (index == digitsStart) return NO;
+
+    // The time zone offset carries no information about the instant and is ignored
+    if (index < length && (characters[index] == '+' || characters[index] == '-')) {
+        CFIndex offsetStart = ++index;
+        while (index < length && characters[index] >= '0' && characters[index] <= '9') index++;
+        if (index == offsetStart) return NO;
+    }
+    if (! (RKDateParsingScanCharacter(characters, length, &index, ')') && RKDateParsingScanCharacter(characters, length, &index, '/')) || index != length) return NO;
+
+    *timeInterval = (isNegative ? -(double)milliseconds : (double)milliseconds) / 1000.0;
+    return YES;
+}
@@ -19,6 +19,7 @@
 //
 
 #import "RKDotNetDateFormatter.h"
+#import "RKDateParsing.h"
 #import "RKLog.h"
 
 static BOOL RKDotNetDateFormatterIsValidRange(NSRange rangeOfMatch)
@@ -53,6 +54,10 @@ static NSTimeInterval RKDotNetDateFormatterMillisecondsFromSeconds(NSTimeInterva
 
 - (NSDate *)dateFromString:(NSString *)string
 {
+    NSTimeInterval timeInterval;
+    if (RKGetTimeIntervalFromDotNetDateString(string, &timeInterval)) return [NSDate dateWithTimeIntervalSince1970:timeInterval];
+
+    // Fall back to the regular expression for strings that embed the date within other content
     NSString *milliseconds = [self millisecondsFromString:string];
     if (!milliseconds) {
         RKLogError(@"Attempted to interpret an invalid .NET date string: %@", string);
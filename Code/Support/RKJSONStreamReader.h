@@ -0,0 +1,82 @@
+//
+//  RKJSONStreamReader.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+/**
+ The `RKJSONStreamReader` class provides incremental access to the values within a JSON document without deserializing the document as a whole.
+
+ The reader tokenizes the raw bytes of the document to locate the value at a given key path. The keys of each object traversed by a key path are indexed the first time the object is scanned, so reading several key paths from the same object does not rescan it. Like `NSJSONSerialization`, a key occurring more than once within an object resolves to its last value. Arrays are returned as `NSEnumerator` objects that deserialize a single element at a time as they are enumerated, so that only the element currently being consumed is held in memory as Foundation objects. All other values are deserialized with `NSJSONSerialization` when located.
+
+ The reader is key-value coding compliant for the key paths of the document: `valueForKey:` and `valueForKeyPath:` return the same objects as `valueAtKeyPath:`. This allows a reader to be used directly as the representation of an `RKMapperOperation`, which maps the elements produced by an enumerator as they are read.
+
+ Readers are immutable and may be queried from multiple threads. Each enumerator returned by the reader maintains its own position within the document.
+ */
+@interface RKJSONStreamReader : NSObject
+
+///-----------------------------
+/// @name Initializing a Reader
+///-----------------------------
+
+/**
+ Initializes the receiver with the given JSON data.
+
+ @param data The UTF-8 encoded JSON data to be read.
+ @return The receiver, initialized with the given data.
+ */
+- (instancetype)initWithData:(NSData *)data NS_DESIGNATED_INITIALIZER;
+
+/**
+ The JSON data the receiver was initialized with.
+ */
+@property (nonatomic, strong, readonly) NSData *data;
+
+///-----------------------
+/// @name Reading Values
+///-----------------------
+
+/**
+ Validates the structure of the document.
+
+ The document is scanned to ensure that all strings are terminated, all objects and arrays are balanced and that no content follows the top level value. Scalar values are not validated until the values containing them are read. Validating the structure up front allows truncated documents to be rejected before any elements are consumed.
+
+ @param error A pointer to an error object that is set if the document is found to be malformed.
+ @return `YES` if the structure of the document is valid, else `NO`.
+ */
+- (BOOL)validateStructure:(NSError **)error;
+
+/**
+ Returns the value at the given key path within the document.
+
+ Arrays are returned as an `NSEnumerator` producing the deserialized elements of the array. If a value traversed along the key path is not an object, it is deserialized and the remainder of the key path is evaluated against it with key-value coding.
+
+ @param keyPath The key path of the value to return. A `nil` or empty key path returns the top level value of the document.
+ @return The value at the key path, or `nil` if no value exists at the key path or the document is malformed.
+ */
+- (id)valueAtKeyPath:(NSString *)keyPath;
+
+/**
+ The first error encountered while reading a value from the document, if any.
+
+ Because `NSEnumerator` provides no means of reporting failures, an enumerator that encounters a malformed element stops producing elements and records the error here.
+ */
+@property (nonatomic, strong, readonly) NSError *error;
+
+@end
@@ -0,0 +1,347 @@
+//
+//  RKJSONStreamReader.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import "RKJSONStreamReader.h"
+#import "RKLog.h"
+
+// Set Logging Component
+#undef RKLogComponent
+#define RKLogComponent RKlcl_cRestKitSupport
+
+static NSError *RKJSONStreamMalformedDataError(NSUInteger offset)
+{
+    NSString *description = [NSString stringWithFormat:@"The JSON data is malformed near byte offset %lu.", (unsigned long) offset];
+    return [NSError errorWithDomain:NSCocoaErrorDomain code:NSPropertyListReadCorruptError userInfo:@{ NSLocalizedDescriptionKey: description }];
+}
+
+static inline BOOL RKJSONIsWhitespace(uint8_t byte)
+{
+    return (byte == ' ' || byte == '\t' || byte == '\n' || byte == '\r');
+}
+
+static inline BOOL RKJSONIsDelimiter(uint8_t byte)
+{
+    return (byte == ',' || byte == ':' || byte == ']' || byte == '}' || RKJSONIsWhitespace(byte));
+}
+
+static NSUInteger RKJSONSkipWhitespace(const uint8_t *bytes, NSUInteger length, NSUInteger index)
+{
+    while (index < length && RKJSONIsWhitespace(bytes[index])) index++;
+    return index;
+}
+
+// Returns the index following the closing quote of the string beginning at `index`, or `NSNotFound` if the string is unterminated
+static NSUInteger RKJSONSkipString(const uint8_t *bytes, NSUInteger length, NSUInteger index)
+{
+    for (index++; index < length; index++) {
+        if (bytes[index] == '\\') index++;
+        else if (bytes[index] == '"') return index + 1;
+    }
+    return NSNotFound;
+}
+
+// Returns the index following the value beginning at `index`, or `NSNotFound` if the value is malformed. Only the structure of objects, arrays and strings is validated.
+static NSUInteger RKJSONSkipValue(const uint8_t *bytes, NSUInteger length, NSUInteger index)
+{
+    if (index >= length) return NSNotFound;
+    if (bytes[index] == '"') return RKJSONSkipString(bytes, length, index);
+    if (bytes[index] != '{' && bytes[index] != '[') {
+        NSUInteger start = index;
+        while (index < length && !RKJSONIsDelimiter(bytes[index])) index++;
+        return (index > start) ? index : NSNotFound;
+    }
+
+    // Track the expected closing brackets so that mismatched nesting is detected
+    uint8_t inlineStack[64];
+    uint8_t *stack = inlineStack;
+    NSUInteger capacity = sizeof(inlineStack);
+    NSUInteger depth = 0;
+    NSUInteger end = NSNotFound;
+    while (index < length) {
+        uint8_t byte = bytes[index];
+        if (byte == '"') {
+            index = RKJSONSkipString(bytes, length, index);
+            if (index == NSNotFound) break;
+            continue;
+        }
+        if (byte == '{' || byte == '[') {
+            if (depth == capacity) {
+                uint8_t *grownStack = malloc(capacity * 2);
+                memcpy(grownStack, stack, capacity);
+                if (stack != inlineStack) free(stack);
+                stack = grownStack;
+                capacity *= 2;
+            }
+            stack[depth++] = (byte == '{') ? '}' : ']';
+        } else if (byte == '}' || byte == ']') {
+            if (stack[--depth] != byte) break;
+            if (depth == 0) {
+                end = index + 1;
+                break;
+            }
+        }
+        index++;
+    }
+    if (stack != inlineStack) free(stack);
+    return end;
+}
+
+// Returns the string between the quotes of the string token in the given range
+static NSString *RKJSONStringFromBytesInRange(const uint8_t *bytes, NSRange range)
+{
+    if (! memchr(bytes + range.location + 1, '\\', range.length - 2)) {
+        return [[NSString alloc] initWithBytes:bytes + range.location + 1 length:range.length - 2 encoding:NSUTF8StringEncoding];
+    }
+
+    // Let `NSJSONSerialization` take care of unescaping
+    NSData *stringData = [NSData dataWithBytesNoCopy:(void *)(bytes + range.location) length:range.length freeWhenDone:NO];
+    return [NSJSONSerialization JSONObjectWithData:stringData options:NSJSONReadingAllowFragments error:nil];
+}
+
+// Returns the indexes of the values of the object beginning at `index` keyed by their keys, or `nil` if the object is malformed, in which case `malformedOffset` is set. A key occurring more than once maps to its last value, as it does when the object is deserialized by `NSJSONSerialization`.
+static NSDictionary *RKJSONIndexesOfValuesOfObject(const uint8_t *bytes, NSUInteger length, NSUInteger index, NSUInteger *malformedOffset)
+{
+    NSMutableDictionary *indexesByKey = [NSMutableDictionary dictionary];
+    index = RKJSONSkipWhitespace(bytes, length, index + 1);
+    if (index < length && bytes[index] == '}') return indexesByKey;
+
+    while (index < length && bytes[index] == '"') {
+        NSUInteger keyEnd = RKJSONSkipString(bytes, length, index);
+        if (keyEnd == NSNotFound) break;
+        NSString *key = RKJSONStringFromBytesInRange(bytes, NSMakeRange(index, keyEnd - index));
+        if (! key) break;
+
+        index = RKJSONSkipWhitespace(bytes, length, keyEnd);
+        if (index >= length || bytes[index] != ':') break;
+        index = RKJSONSkipWhitespace(bytes, length, index + 1);
+        indexesByKey[key] = @(index);
+
+        index = RKJSONSkipValue(bytes, length, index);
+        if (index == NSNotFound) break;
+        index = RKJSONSkipWhitespace(bytes, length, index);
+        if (index < length && bytes[index] == '}') return indexesByKey;
+        if (index >= length || bytes[index] != ',') break;
+        index = RKJSONSkipWhitespace(bytes, length, index + 1);
+    }
+
+    *malformedOffset = (index == NSNotFound) ? length : MIN(index, length);
+    return nil;
+}
+
+@interface RKJSONStreamReader ()
+@property (nonatomic, strong, readwrite) NSData *data;
+- (id)objectWithBytesInRange:(NSRange)range;
+- (void)recordError:(NSError *)error;
+@end
+
+/**
+ Enumerates the elements of a JSON array, deserializing each element as it is requested.
+ */
+@interface RKJSONStreamArrayEnumerator : NSEnumerator
+- (instancetype)initWithReader:(RKJSONStreamReader *)reader index:(NSUInteger)index;
+@end
+
+@implementation RKJSONStreamArrayEnumerator {
+    RKJSONStreamReader *_reader;
+    NSUInteger _index; // The index of the next element, or `NSNotFound` once exhausted
+}
+
+- (instancetype)initWithReader:(RKJSONStreamReader *)reader index:(NSUInteger)index
+{
+    self = [super init];
+    if (self) {
+        _reader = reader;
+        const uint8_t *bytes = [reader.data bytes];
+        NSUInteger length = [reader.data length];
+        _index = RKJSONSkipWhitespace(bytes, length, index + 1);
+        if (_index < length && bytes[_index] == ']') _index = NSNotFound;
+    }
+    return self;
+}
+
+- (id)failWithMalformedDataAtOffset:(NSUInteger)offset
+{
+    [_reader recordError:RKJSONStreamMalformedDataError(offset)];
+    _index = NSNotFound;
+    return nil;
+}
+
+- (id)nextObject
+{
+    if (_index == NSNotFound) return nil;
+
+    const uint8_t *bytes = [_reader.data bytes];
+    NSUInteger length = [_reader.data length];
+    NSUInteger end = RKJSONSkipValue(bytes, length, _index);
+    if (end == NSNotFound) return [self failWithMalformedDataAtOffset:_index];
+
+    id object = [_reader objectWithBytesInRange:NSMakeRange(_index, end - _index)];
+    if (! object) {
+        _index = NSNotFound;
+        return nil;
+    }
+
+    NSUInteger next = RKJSONSkipWhitespace(bytes, length, end);
+    if (next < length && bytes[next] == ',') {
+        _index = RKJSONSkipWhitespace(bytes, length, next + 1);
+    } else if (next < length && bytes[next] == ']') {
+        _index = NSNotFound;
+    } else {
+        return [self failWithMalformedDataAtOffset:next];
+    }
+
+    return object;
+}
+
+@end
+
+@implementation RKJSONStreamReader {
+    NSError *_error;
+    // The indexes of the values of each object traversed by a key path, keyed by the index of the object, so that each object is scanned once however many key paths are read from it
+    NSMutableDictionary *_valueIndexesByObjectIndex;
+}
+
+- (instancetype)init
+{
+    return [self initWithData:nil];
+}
+
+- (instancetype)initWithData:(NSData *)data
+{
+    self = [super init];
+    if (self) {
+        // Elements are deserialized from the bytes of the data in place, so it must not be mutated while the receiver is in use
+        self.data = [data copy] ?: [NSData data];
+        _valueIndexesByObjectIndex = [NSMutableDictionary dictionary];
+    }
+    return self;
+}
+
+- (NSError *)error
+{
+    @synchronized(self) {
+        return _error;
+    }
+}
+
+- (void)recordError:(NSError *)error
+{
+    RKLogError(@"Failed to read JSON stream: %@", error);
+    @synchronized(self) {
+        if (! _error) _error = error;
+    }
+}
+
+- (id)objectWithBytesInRange:(NSRange)range
+{
+    NSData *data = [NSData dataWithBytesNoCopy:(void *)((const uint8_t *)[self.data bytes] + range.location) length:range.length freeWhenDone:NO];
+    NSError *error = nil;
+    id object = [NSJSONSerialization JSONObjectWithData:data options:NSJSONReadingAllowFragments error:&error];
+    if (! object) [self recordError:error];
+    return object;
+}
+
+- (NSDictionary *)indexesOfValuesOfObjectAtIndex:(NSUInteger)index malformedOffset:(NSUInteger *)malformedOffset
+{
+    @synchronized(_valueIndexesByObjectIndex) {
+        NSDictionary *indexesByKey = _valueIndexesByObjectIndex[@(index)];
+        if (! indexesByKey) {
+            indexesByKey = RKJSONIndexesOfValuesOfObject([self.data bytes], [self.data length], index, malformedOffset);
+            if (indexesByKey) _valueIndexesByObjectIndex[@(index)] = indexesByKey;
+        }
+        return indexesByKey;
+    }
+}
+
+- (BOOL)validateStructure:(NSError **)error
+{
+    const uint8_t *bytes = [self.data bytes];
+    NSUInteger length = [self.data length];
+    NSUInteger index = RKJSONSkipWhitespace(bytes, length, 0);
+    NSUInteger end = RKJSONSkipValue(bytes, length, index);
+    if (end != NSNotFound) {
+        end = RKJSONSkipWhitespace(bytes, length, end);
+        if (end == length) return YES;
+    }
+
+    if (error) *error = RKJSONStreamMalformedDataError(end == NSNotFound ? index : end);
+    return NO;
+}
+
+- (id)valueAtKeyPath:(NSString *)keyPath
+{
+    const uint8_t *bytes = [self.data bytes];
+    NSUInteger length = [self.data length];
+    NSUInteger index = RKJSONSkipWhitespace(bytes, length, 0);
+    NSArray *keys = ([keyPath length] > 0) ? [keyPath componentsSeparatedByString:@"."] : @[];
+
+    // Descend through nested objects without deserializing them
+    NSUInteger keyIndex = 0;
+    for (; keyIndex < [keys count]; keyIndex++) {
+        if (index >= length) break;
+        if (bytes[index] != '{') break;
+        NSUInteger malformedOffset = NSNotFound;
+        NSDictionary *indexesByKey = [self indexesOfValuesOfObjectAtIndex:index malformedOffset:&malformedOffset];
+        if (! indexesByKey) {
+            [self recordError:RKJSONStreamMalformedDataError(malformedOffset)];
+            return nil;
+        }
+        NSNumber *valueIndex = indexesByKey[keys[keyIndex]];
+        if (! valueIndex) return nil;
+        index = [valueIndex unsignedIntegerValue];
+    }
+
+    if (index >= length) {
+        [self recordError:RKJSONStreamMalformedDataError(length)];
+        return nil;
+    }
+    if (keyIndex == [keys count] && bytes[index] == '[') {
+        return [[RKJSONStreamArrayEnumerator alloc] initWithReader:self index:index];
+    }
+
+    NSUInteger end = RKJSONSkipValue(bytes, length, index);
+    if (end == NSNotFound) {
+        [self recordError:RKJSONStreamMalformedDataError(index)];
+        return nil;
+    }
+    id value = [self objectWithBytesInRange:NSMakeRange(index, end - index)];
+    if (keyIndex == [keys count]) return value;
+
+    // A value along the key path was not an object, so evaluate the remainder of the key path against it
+    NSString *remainingKeyPath = [[keys subarrayWithRange:NSMakeRange(keyIndex, [keys count] - keyIndex)] componentsJoinedByString:@"."];
+    return [value valueForKeyPath:remainingKeyPath];
+}
+
+- (id)valueForKey:(NSString *)key
+{
+    return [self valueAtKeyPath:key];
+}
+
+- (id)valueForKeyPath:(NSString *)keyPath
+{
+    return [self valueAtKeyPath:keyPath];
+}
+
+- (NSString *)description
+{
+    return [NSString stringWithFormat:@"<%@: %p length=%lu>", self.class, self, (unsigned long) [self.data length]];
+}
+
+@end
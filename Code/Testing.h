@@ -24,6 +24,7 @@
 #import "RKTestFactory.h"
 #import "RKTestHelpers.h"
 #import "RKMappingTest.h"
+#import "RKMappingCodeGenerator.h"
 
 #if __has_include("CoreData.h")
 #import "RKConnectionTestExpectation.h"
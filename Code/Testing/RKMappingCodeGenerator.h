@@ -0,0 +1,93 @@
+//
+//  RKMappingCodeGenerator.h
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <Foundation/Foundation.h>
+
+@class RKMapping, RKObjectMapping;
+
+/**
+ The `RKMappingCodeGenerator` class generates Objective-C source code containing specialized mapping functions for a set of object mappings.
+
+ For each object mapping, the generator emits an `RKGeneratedMappingFunction` that maps the single key attributes of a dictionary representation by reading the values with their hard-coded source keys and assigning them with the accessors of the target class, without key-value coding. An attribute is assigned directly when its destination is a single, writable property declared by the target class and values of the property class are mapped without transformation (see `RKPropertyMappingPlanUsesIdentityTransformation`). Object properties are assigned values of the property class and scalar numeric properties are assigned the value of `NSNumber` objects. Attributes requiring a custom value transformer, a key-value coding source key path or a transformation of the value, as well as missing and null values, are handed back to `RKMappingOperation`. Relationships, key path attributes and dynamic mappings are always mapped by `RKMappingOperation`.
+
+ The generated source registers its functions from a constructor function when the binary containing it is loaded. Each function is registered under the signature of the mapping it was generated from, so an application only needs to compile the generated file with its target: mapping operations use the generated functions transparently for mappings whose signature is unchanged, and fall back to their generic implementation as soon as a mapping is modified. The generated file imports the header of each target class by the name of the class (i.e. `#import "Article.h"`) and requires the mapped properties to be declared in it.
+
+ Code generation is typically performed from a unit test or a command line tool that configures the mappings of the application, for example:
+
+    RKMappingCodeGenerator *generator = [[RKMappingCodeGenerator alloc] initWithName:@"ArticleMappings"];
+    [generator addMapping:[Article responseMapping]];
+    [generator writeSourceCodeToFile:@"Generated/ArticleMappings.m" error:&error];
+ */
+@interface RKMappingCodeGenerator : NSObject
+
+///-----------------------------------
+/// @name Creating a Generator
+///-----------------------------------
+
+/**
+ Initializes the receiver with the given name, which is used to derive the names of the generated functions.
+
+ @param name The name of the generated source file, without an extension. Characters that are not valid in a C identifier are replaced with underscores.
+ @return The receiver, initialized with the given name.
+ */
+- (instancetype)initWithName:(NSString *)name NS_DESIGNATED_INITIALIZER;
+
+/**
+ The name of the receiver.
+ */
+@property (nonatomic, copy, readonly) NSString *name;
+
+///-----------------------------------
+/// @name Adding Mappings
+///-----------------------------------
+
+/**
+ Adds the given mapping and all of the object mappings reachable through its relationships to the receiver.
+
+ Dynamic mappings contribute the object mappings they were configured with. Mappings that do not contain any attribute that can be assigned directly (such as mappings targeting `NSMutableDictionary` or `NSManagedObject` itself) and mappings sharing the signature of a mapping that was already added are skipped.
+
+ @param mapping An object, entity or dynamic mapping.
+ */
+- (void)addMapping:(RKMapping *)mapping;
+
+/**
+ The object mappings that code will be generated for, in the order in which they were added.
+ */
+@property (nonatomic, copy, readonly) NSArray *objectMappings;
+
+///-----------------------------------
+/// @name Generating Source Code
+///-----------------------------------
+
+/**
+ Returns the source code of an Objective-C implementation file defining and registering a mapping function for each object mapping of the receiver.
+ */
+- (NSString *)sourceCode;
+
+/**
+ Writes the source code of the receiver to the given path, using UTF-8 encoding.
+
+ @param path The path of the file to write.
+ @param error A pointer to an error object that is set if the file could not be written.
+ @return `YES` if the file was written successfully.
+ */
+- (BOOL)writeSourceCodeToFile:(NSString *)path error:(NSError **)error;
+
+@end
@@ -0,0 +1,332 @@
+//
+//  RKMappingCodeGenerator.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+//  Licensed under the Apache License, Version 2.0 (the "License");
+//  you may not use this file except in compliance with the License.
+//  You may obtain a copy of the License at
+//
+//  http://www.apache.org/licenses/LICENSE-2.0
+//
+//  Unless required by applicable law or agreed to in writing, software
+//  distributed under the License is distributed on an "AS IS" BASIS,
+//  WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//  See the License for the specific language governing permissions and
+//  limitations under the License.
+//
+
+#import <objc/runtime.h>
+#import "RKMappingCodeGenerator.h"
+#import "RKObjectMapping.h"
+#import "RKDynamicMapping.h"
+#import "RKRelationshipMapping.h"
+#import "RKObjectMappingPlan.h"
+#import "RKGeneratedMapping.h"
+
+static BOOL RKClassIsManagedObjectClass(Class aClass)
+{
+    Class managedObjectClass = NSClassFromString(@"NSManagedObject");
+    return managedObjectClass && [aClass isSubclassOfClass:managedObjectClass];
+}
+
+static BOOL RKClassUsesDefaultKeyValueCodingSetters(Class aClass)
+{
+    Class rootClass = [NSObject class];
+    return (class_getMethodImplementation(aClass, @selector(setValue:forKey:)) == class_getMethodImplementation(rootClass, @selector(setValue:forKey:)) &&
+            class_getMethodImplementation(aClass, @selector(setValue:forKeyPath:)) == class_getMethodImplementation(rootClass, @selector(setValue:forKeyPath:)));
+}
+
+// Returns YES if validating a value for the key of instances of the class may do anything but return YES
+static BOOL RKClassValidatesValuesForKey(Class aClass, NSString *key)
+{
+    if (RKClassIsManagedObjectClass(aClass)) return YES;
+    Class rootClass = [NSObject class];
+    if (class_getMethodImplementation(aClass, @selector(validateValue:forKey:error:)) != class_getMethodImplementation(rootClass, @selector(validateValue:forKey:error:)) ||
+        class_getMethodImplementation(aClass, @selector(validateValue:forKeyPath:error:)) != class_getMethodImplementation(rootClass, @selector(validateValue:forKeyPath:error:))) {
+        return YES;
+    }
+    NSString *validatorName = [NSString stringWithFormat:@"validate%@%@:error:", [[key substringToIndex:1] uppercaseString], [key substringFromIndex:1]];
+    return [aClass instancesRespondToSelector:NSSelectorFromString(validatorName)];
+}
+
+static NSString *RKStringLiteral(NSString *string)
+{
+    NSMutableString *literal = [NSMutableString stringWithString:@"@\""];
+    for (NSUInteger index = 0; index < [string length]; index++) {
+        unichar character = [string characterAtIndex:index];
+        switch (character) {
+            case '\\': [literal appendString:@"\\\\"]; break;
+            case '"': [literal appendString:@"\\\""]; break;
+            case '\n': [literal appendString:@"\\n"]; break;
+            case '\r': [literal appendString:@"\\r"]; break;
+            case '\t': [literal appendString:@"\\t"]; break;
+            default: [literal appendFormat:@"%C", character]; break;
+        }
+    }
+    [literal appendString:@"\""];
+    return literal;
+}
+
+static NSString *RKIdentifierFromString(NSString *string)
+{
+    NSMutableString *identifier = [NSMutableString stringWithCapacity:[string length]];
+    NSCharacterSet *identifierCharacters = [NSCharacterSet characterSetWithCharactersInString:@"abcdefghijklmnopqrstuvwxyzABCDEFGHIJKLMNOPQRSTUVWXYZ0123456789_"];
+    for (NSUInteger index = 0; index < [string length]; index++) {
+        unichar character = [string characterAtIndex:index];
+        [identifier appendFormat:@"%C", [identifierCharacters characterIsMember:character] ? character : (unichar)'_'];
+    }
+    return identifier;
+}
+
+// Returns the C type and the `NSNumber` accessor that key-value coding uses for a scalar type encoding, or nil if the encoding is not a numeric scalar
+static NSString *RKScalarTypeForTypeEncoding(NSString *typeEncoding, NSString **accessorName)
+{
+    static NSDictionary *scalarTypes = nil;
+    static dispatch_once_t onceToken;
+    dispatch_once(&onceToken, ^{
+        scalarTypes = @{ @"c": @[ @"char", @"charValue" ], @"C": @[ @"unsigned char", @"unsignedCharValue" ],
+                         @"s": @[ @"short", @"shortValue" ], @"S": @[ @"unsigned short", @"unsignedShortValue" ],
+                         @"i": @[ @"int", @"intValue" ], @"I": @[ @"unsigned int", @"unsignedIntValue" ],
+                         @"l": @[ @"long", @"longValue" ], @"L": @[ @"unsigned long", @"unsignedLongValue" ],
+                         @"q": @[ @"long long", @"longLongValue" ], @"Q": @[ @"unsigned long long", @"unsignedLongLongValue" ],
+                         @"f": @[ @"float", @"floatValue" ], @"d": @[ @"double", @"doubleValue" ], @"B": @[ @"bool", @"boolValue" ] };
+    });
+    NSArray *scalarType = scalarTypes[typeEncoding];
+    if (accessorName) *accessorName = scalarType[1];
+    return scalarType[0];
+}
+
+// The classes of Foundation values that may be found in a parsed representation and assigned to object properties as is
+static NSSet *RKDirectlyAssignableClassNames(void)
+{
+    return [NSSet setWithObjects:@"NSString", @"NSNumber", @"NSArray", @"NSDictionary", nil];
+}
+
+/**
+ Describes how the value of a single key attribute mapping is assigned by generated code.
+ */
+@interface RKGeneratedAttributeAccess : NSObject
+@property (nonatomic, copy) NSString *getterName;
+@property (nonatomic, copy) NSString *setterName;
+@property (nonatomic, copy) NSString *valueClassName;
+@property (nonatomic, copy) NSString *scalarType;
+@property (nonatomic, copy) NSString *scalarAccessorName;
+@property (nonatomic, assign) BOOL validatesValues;
+@end
+
+@implementation RKGeneratedAttributeAccess
+
+// Returns the access for the attribute mapping plan when its value can be assigned directly by generated code, or nil if it must be handed back to the mapping operation
++ (instancetype)accessForAttributePlan:(RKPropertyMappingPlan *)plan ofClass:(Class)objectClass
+{
+    if (plan.isNestingAttribute || plan.requiresKeyValueCodingForSource || [plan.sourceKeyPathComponents count] != 1) return nil;
+    if ([plan.destinationKeyPathComponents count] != 1 || ! RKPropertyMappingPlanUsesIdentityTransformation(plan)) return nil;
+    if (! RKClassIsManagedObjectClass(objectClass) && ! RKClassUsesDefaultKeyValueCodingSetters(objectClass)) return nil;
+
+    NSString *key = plan.destinationKeyPath;
+    objc_property_t property = class_getProperty(objectClass, [key UTF8String]);
+    if (! property) return nil;
+    char *readonly = property_copyAttributeValue(property, "R");
+    char *type = property_copyAttributeValue(property, "T");
+    char *getter = property_copyAttributeValue(property, "G");
+    char *setter = property_copyAttributeValue(property, "S");
+    NSString *typeEncoding = type ? @(type) : nil;
+    NSString *getterName = getter ? @(getter) : key;
+    NSString *defaultSetterName = [NSString stringWithFormat:@"set%@%@:", [[key substringToIndex:1] uppercaseString], [key substringFromIndex:1]];
+    NSString *setterName = setter ? @(setter) : defaultSetterName;
+    BOOL isReadonly = (readonly != NULL);
+    free(readonly);
+    free(type);
+    free(getter);
+    free(setter);
+
+    // Key-value coding invokes `set<Key>:`, so properties with a custom setter name are assigned by the mapping operation
+    if (isReadonly || ! typeEncoding || ! [setterName isEqualToString:defaultSetterName]) return nil;
+    if (! [objectClass instancesRespondToSelector:NSSelectorFromString(setterName)] || ! [objectClass instancesRespondToSelector:NSSelectorFromString(getterName)]) return nil;
+
+    RKGeneratedAttributeAccess *access = [self new];
+    access.getterName = getterName;
+    access.setterName = setterName;
+    access.validatesValues = RKClassValidatesValuesForKey(objectClass, key);
+    if ([typeEncoding hasPrefix:@"@"]) {
+        NSString *className = NSStringFromClass(plan.destinationClass);
+        if (! [RKDirectlyAssignableClassNames() containsObject:className]) return nil;
+        access.valueClassName = className;
+    } else {
+        NSString *accessorName = nil;
+        NSString *scalarType = RKScalarTypeForTypeEncoding(typeEncoding, &accessorName);
+        // Validation is performed on boxed values, so validated scalars are assigned by the mapping operation
+        if (! scalarType || plan.destinationClass != [NSNumber class] || access.validatesValues) return nil;
+        access.valueClassName = @"NSNumber";
+        access.scalarType = scalarType;
+        access.scalarAccessorName = accessorName;
+    }
+    return access;
+}
+
+@end
+
+@interface RKMappingCodeGenerator ()
+@property (nonatomic, copy, readwrite) NSString *name;
+@property (nonatomic, strong) NSMutableArray *mutableObjectMappings;
+@property (nonatomic, strong) NSMutableSet *signatures;
+@end
+
+@implementation RKMappingCodeGenerator
+
+- (instancetype)init
+{
+    return [self initWithName:@"RKGeneratedMappings"];
+}
+
+- (instancetype)initWithName:(NSString *)name
+{
+    NSParameterAssert(name);
+    self = [super init];
+    if (self) {
+        self.name = RKIdentifierFromString(name);
+        self.mutableObjectMappings = [NSMutableArray array];
+        self.signatures = [NSMutableSet set];
+    }
+    return self;
+}
+
+- (NSArray *)objectMappings
+{
+    return [self.mutableObjectMappings copy];
+}
+
+- (void)addMapping:(RKMapping *)mapping
+{
+    [self addMapping:mapping visitedMappings:[NSMutableSet set]];
+}
+
+- (void)addMapping:(RKMapping *)mapping visitedMappings:(NSMutableSet *)visitedMappings
+{
+    NSValue *visitedKey = [NSValue valueWithNonretainedObject:mapping];
+    if (! mapping || [visitedMappings containsObject:visitedKey]) return;
+    [visitedMappings addObject:visitedKey];
+
+    if ([mapping isKindOfClass:[RKDynamicMapping class]]) {
+        for (RKObjectMapping *objectMapping in [(RKDynamicMapping *)mapping objectMappings]) {
+            [self addMapping:objectMapping visitedMappings:visitedMappings];
+        }
+        return;
+    }
+    if (! [mapping isKindOfClass:[RKObjectMapping class]]) return;
+
+    RKObjectMapping *objectMapping = (RKObjectMapping *)mapping;
+    RKObjectMappingPlan *plan = objectMapping.executionPlan;
+    NSString *signature = RKGeneratedMappingSignatureForPlan(plan);
+    if (signature && ! [self.signatures containsObject:signature] && [self hasDirectlyAssignedAttributesInPlan:plan]) {
+        [self.signatures addObject:signature];
+        [self.mutableObjectMappings addObject:objectMapping];
+    }
+
+    for (RKRelationshipMapping *relationshipMapping in objectMapping.relationshipMappings) {
+        [self addMapping:relationshipMapping.mapping visitedMappings:visitedMappings];
+    }
+}
+
+- (BOOL)hasDirectlyAssignedAttributesInPlan:(RKObjectMappingPlan *)plan
+{
+    for (RKPropertyMappingPlan *attributePlan in plan.keyAttributePlans) {
+        if ([RKGeneratedAttributeAccess accessForAttributePlan:attributePlan ofClass:plan.objectClass]) return YES;
+    }
+    return NO;
+}
+
+#pragma mark - Generating Source Code
+
+- (NSString *)functionNameForMappingAtIndex:(NSUInteger)index
+{
+    return [NSString stringWithFormat:@"RKGeneratedMapping_%@_%lu", self.name, (unsigned long)index];
+}
+
+- (NSString *)sourceCode
+{
+    NSMutableString *source = [NSMutableString string];
+    [source appendFormat:@"//\n//  %@.m\n//\n//  Generated by RKMappingCodeGenerator. Do not edit this file: regenerate it whenever the mappings change.\n//\n\n", self.name];
+    [source appendString:@"#import <objc/runtime.h>\n#import \"RKGeneratedMapping.h\"\n#import \"RKMappingOperation.h\"\n#import \"RKObjectUtilities.h\"\n"];
+    NSMutableOrderedSet *classNames = [NSMutableOrderedSet orderedSet];
+    for (RKObjectMapping *objectMapping in self.mutableObjectMappings) {
+        [classNames addObject:NSStringFromClass(objectMapping.objectClass)];
+    }
+    for (NSString *className in classNames) {
+        [source appendFormat:@"#import \"%@.h\"\n", className];
+    }
+
+    NSMutableString *registrations = [NSMutableString string];
+    [self.mutableObjectMappings enumerateObjectsUsingBlock:^(RKObjectMapping *objectMapping, NSUInteger index, BOOL *stop) {
+        RKObjectMappingPlan *plan = objectMapping.executionPlan;
+        NSString *functionName = [self functionNameForMappingAtIndex:index];
+        [source appendFormat:@"\n%@", [self sourceCodeForFunctionNamed:functionName plan:plan]];
+        [registrations appendFormat:@"        RKRegisterGeneratedMappingFunction(%@, %@);\n", RKStringLiteral(RKGeneratedMappingSignatureForPlan(plan)), functionName];
+    }];
+
+    [source appendFormat:@"\n__attribute__((constructor)) static void RKRegisterGeneratedMappings_%@(void)\n{\n    @autoreleasepool {\n%@    }\n}\n", self.name, registrations];
+    return source;
+}
+
+- (NSString *)sourceCodeForFunctionNamed:(NSString *)functionName plan:(RKObjectMappingPlan *)plan
+{
+    Class objectClass = plan.objectClass;
+    NSString *className = NSStringFromClass(objectClass);
+    NSMutableString *body = [NSMutableString string];
+    BOOL usesUnchangedValues = NO;
+    BOOL usesValues = NO;
+
+    NSArray *attributePlans = plan.keyAttributePlans;
+    for (NSUInteger index = 0; index < [attributePlans count]; index++) {
+        RKPropertyMappingPlan *attributePlan = attributePlans[index];
+        if (attributePlan.isNestingAttribute) continue;
+
+        [body appendFormat:@"\n    // %@ => %@\n", attributePlan.sourceKeyPath ?: @"(self)", attributePlan.destinationKeyPath ?: @"(self)"];
+        RKGeneratedAttributeAccess *access = [RKGeneratedAttributeAccess accessForAttributePlan:attributePlan ofClass:objectClass];
+        if (! access) {
+            [body appendFormat:@"    if (RKGeneratedMappingApplyAttribute(operation, %lu)) applied = YES;\n", (unsigned long)index];
+        } else {
+            usesValues = usesUnchangedValues = YES;
+            NSString *key = attributePlan.destinationKeyPath;
+            NSString *setter = [access.setterName substringToIndex:[access.setterName length] - 1];
+            [body appendFormat:@"    value = [representation objectForKey:%@];\n", RKStringLiteral(attributePlan.sourceKeyPath)];
+            [body appendFormat:@"    if ([value isKindOfClass:[%@ class]]) {\n", access.valueClassName];
+            if (access.scalarType) {
+                [body appendFormat:@"        %@ scalarValue = [(NSNumber *)value %@];\n", access.scalarType, access.scalarAccessorName];
+                [body appendFormat:@"        if (setsUnchangedValues || [object %@] != scalarValue) [object %@:scalarValue];\n", access.getterName, setter];
+            } else if (access.validatesValues) {
+                [body appendFormat:@"        if ((setsUnchangedValues || ! RKObjectIsEqualToObject(value, [object %@])) && RKGeneratedMappingValidateValue(operation, &value, %@)) [object %@:value];\n", access.getterName, RKStringLiteral(key), setter];
+            } else {
+                [body appendFormat:@"        if (setsUnchangedValues || ! RKObjectIsEqualToObject(value, [object %@])) [object %@:value];\n", access.getterName, setter];
+            }
+            [body appendFormat:@"        RKGeneratedMappingDidMapAttribute(operation, %lu);\n", (unsigned long)index];
+            [body appendString:@"        applied = YES;\n"];
+            [body appendFormat:@"    } else if (RKGeneratedMappingApplyAttributeValue(operation, %lu, value)) {\n        applied = YES;\n    }\n", (unsigned long)index];
+        }
+        [body appendString:@"    if (operation.error) {\n        *appliedMappings = applied;\n        return YES;\n    }\n"];
+    }
+
+    NSMutableString *function = [NSMutableString string];
+    [function appendFormat:@"static BOOL %@(RKMappingOperation *operation, NSDictionary *representation, id destinationObject, BOOL *appliedMappings)\n{\n", functionName];
+    [function appendString:@"    // Objects of subclasses or whose class was changed at runtime (i.e. by key-value observing) are mapped by the operation\n"];
+    [function appendFormat:@"    if (object_getClass(destinationObject) != [%@ class]) return NO;\n", className];
+    if (usesValues) {
+        [function appendFormat:@"    %@ *object = destinationObject;\n", className];
+        [function appendString:@"    id value = nil;\n"];
+    }
+    if (usesUnchangedValues) [function appendString:@"    BOOL setsUnchangedValues = RKGeneratedMappingShouldSetUnchangedValues(operation);\n"];
+    [function appendString:@"    BOOL applied = NO;\n"];
+    [function appendString:body];
+    [function appendString:@"\n    *appliedMappings = applied;\n    return YES;\n}\n"];
+    return function;
+}
+
+- (BOOL)writeSourceCodeToFile:(NSString *)path error:(NSError **)error
+{
+    return [[self sourceCode] writeToFile:path atomically:YES encoding:NSUTF8StringEncoding error:error];
+}
+
+@end
@@ -8,6 +8,7 @@
 
 #import "RKTestEnvironment.h"
 #import "RKEntityByAttributeCache.h"
+#import "RKEntityCacheKey.h"
 #import "RKHuman.h"
 #import "RKChild.h"
 
@@ -17,6 +18,29 @@
 @property (nonatomic, strong) RKEntityByAttributeCache *cache;
 @end
 
+/**
+ Records the fetch requests it executes, and fails those selected by its block.
+ */
+@interface RKFetchRecordingManagedObjectContext : NSManagedObjectContext
+@property (nonatomic, strong, readonly) NSMutableArray *fetchRequests;
+@property (nonatomic, copy) BOOL (^shouldFailFetchRequestBlock)(NSFetchRequest *fetchRequest);
+@end
+
+@implementation RKFetchRecordingManagedObjectContext
+
+- (NSArray *)executeFetchRequest:(NSFetchRequest *)request error:(NSError **)error
+{
+    if (! _fetchRequests) _fetchRequests = [NSMutableArray array];
+    [_fetchRequests addObject:request];
+    if (self.shouldFailFetchRequestBlock && self.shouldFailFetchRequestBlock(request)) {
+        if (error) *error = [NSError errorWithDomain:NSCocoaErrorDomain code:NSPersistentStoreOperationError userInfo:nil];
+        return nil;
+    }
+    return [super executeFetchRequest:request error:error];
+}
+
+@end
+
 @implementation RKEntityByAttributeCacheTest
 
 @synthesize managedObjectStore = _managedObjectStore;
@@ -83,6 +107,152 @@
     expect([self.cache count]).will.equal(1);
 }
 
+- (void)testLoadingInBatchesReportsProgress
+{
+    for (NSInteger index = 0; index < 5; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(index);
+    }
+    [self.managedObjectContext save:nil];
+
+    NSMutableArray *loadedCounts = [NSMutableArray array];
+    self.cache.loadBatchSize = 2;
+    self.cache.loadProgressBlock = ^(NSUInteger loadedCount, NSUInteger totalCount) {
+        expect(totalCount).to.equal(5);
+        [loadedCounts addObject:@(loadedCount)];
+    };
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    expect([self.cache isLoaded]).to.equal(YES);
+    expect(done).will.equal(YES);
+    expect(loadedCounts).will.equal(@[ @2, @4, @5 ]);
+    expect([self.cache isLoading]).to.equal(NO);
+    expect([self.cache count]).to.equal(5);
+}
+
+- (NSManagedObjectContext *)newFetchRecordingMainQueueContext
+{
+    RKFetchRecordingManagedObjectContext *context = [[RKFetchRecordingManagedObjectContext alloc] initWithConcurrencyType:NSMainQueueConcurrencyType];
+    context.persistentStoreCoordinator = self.managedObjectStore.persistentStoreCoordinator;
+    return context;
+}
+
+- (void)testRetrievalWhileLoadingInBatchesFetchesKeysNotLoadedYet
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @12345;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @12345;
+    [self.managedObjectContext save:nil];
+
+    // Batches are loaded on the main queue, so none is loaded before the run loop is spun
+    RKFetchRecordingManagedObjectContext *context = (RKFetchRecordingManagedObjectContext *)[self newFetchRecordingMainQueueContext];
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:context];
+    RKEntityByAttributeCache *cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:@[ @"railsID" ] managedObjectContext:context];
+    cache.loadBatchSize = 1;
+    __block BOOL done = NO;
+    [cache load:^{
+        done = YES;
+    }];
+    expect([cache isLoading]).to.equal(YES);
+
+    // Load one of the objects sharing the key, as if its batch had been loaded
+    [cache addObjects:[NSSet setWithObject:[context existingObjectWithID:human1.objectID error:nil]] completion:nil];
+    expect([cache count]).to.equal(1);
+
+    NSSet *objects = [cache objectsWithAttributeValues:@{ @"railsID": @12345 } inContext:context];
+    expect([objects valueForKey:@"objectID"]).to.equal([NSSet setWithObjects:human1.objectID, human2.objectID, nil]);
+    // The key was found in the cache, yet the objects sharing it were fetched as the cache is loading
+    expect([context.fetchRequests valueForKeyPath:@"predicate.predicateFormat"]).to.contain(@"railsID == 12345");
+
+    expect(done).will.equal(YES);
+    expect([cache isLoading]).to.equal(NO);
+    expect([cache count]).to.equal(2);
+}
+
+- (void)testFailingToFetchABatchLeavesTheCacheIncomplete
+{
+    for (NSInteger index = 0; index < 3; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(index);
+    }
+    [self.managedObjectContext save:nil];
+
+    RKFetchRecordingManagedObjectContext *context = (RKFetchRecordingManagedObjectContext *)[self newFetchRecordingMainQueueContext];
+    __block NSUInteger batchCount = 0;
+    context.shouldFailFetchRequestBlock = ^BOOL(NSFetchRequest *fetchRequest) {
+        if (fetchRequest.resultType != NSDictionaryResultType) return NO;
+        return (++batchCount == 2);
+    };
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:context];
+    RKEntityByAttributeCache *cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity attributes:@[ @"railsID" ] managedObjectContext:context];
+    cache.loadBatchSize = 1;
+    __block BOOL done = NO;
+    [cache load:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([cache isLoading]).to.equal(NO);
+    expect([cache count]).to.equal(2);
+    expect([cache snapshot]).to.beNil();
+}
+
+- (void)testFlushWhileLoadingDropsTheLoadedObjects
+{
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human.railsID = @12345;
+    [self.managedObjectContext save:nil];
+
+    // Hold the queue of the context so that the load fetches after the flush
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.managedObjectContext performBlock:^{
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+    }];
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    [self.cache flush:nil];
+    dispatch_semaphore_signal(semaphore);
+
+    expect(done).will.equal(YES);
+    expect([self.cache isLoaded]).to.equal(NO);
+    expect([self.cache count]).to.equal(0);
+}
+
+- (void)testObjectsAddedAndRemovedWhileLoadingAreMergedWithTheLoadedObjects
+{
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human1.railsID = @1;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human2.railsID = @2;
+    [self.managedObjectContext save:nil];
+
+    dispatch_semaphore_t semaphore = dispatch_semaphore_create(0);
+    [self.managedObjectContext performBlock:^{
+        dispatch_semaphore_wait(semaphore, DISPATCH_TIME_FOREVER);
+    }];
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    [self.cache removeObjectID:human2.objectID forAttributeValues:@{ @"railsID": @2 }];
+    NSManagedObjectContext *mainQueueContext = self.managedObjectStore.mainQueueManagedObjectContext;
+    RKHuman *human3 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:mainQueueContext];
+    human3.railsID = @3;
+    [self.cache addObjects:[NSSet setWithObject:human3] completion:nil];
+    dispatch_semaphore_signal(semaphore);
+
+    expect(done).will.equal(YES);
+    expect([self.cache isLoaded]).to.equal(YES);
+    expect([self.cache containsObject:human1]).to.equal(YES);
+    expect([self.cache containsObject:human2]).to.equal(NO);
+    expect([self.cache containsObject:human3]).to.equal(YES);
+    expect([self.cache count]).to.equal(2);
+}
+
 - (void)testFlushCacheRemovesObjects
 {
     RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
@@ -422,4 +592,237 @@
     [self.cache objectsWithAttributeValues:attributeValues inContext:self.managedObjectContext];
 }
 
+#pragma mark - Eviction
+
+- (NSArray *)insertAndLoadHumansWithCount:(NSInteger)count
+{
+    NSMutableArray *humans = [NSMutableArray arrayWithCapacity:count];
+    for (NSInteger index = 0; index < count; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(index);
+        [humans addObject:human];
+    }
+    [self.managedObjectContext save:nil];
+    __block BOOL done = NO;
+    [self.cache load:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    return humans;
+}
+
+- (void)testEvictionRetainsRecentlyUsedKeys
+{
+    NSArray *humans = [self insertAndLoadHumansWithCount:320];
+    NSArray *recentlyUsedHumans = [humans subarrayWithRange:NSMakeRange(0, 16)];
+    for (RKHuman *human in recentlyUsedHumans) {
+        expect([self.cache objectWithAttributeValues:@{ @"railsID": human.railsID } inContext:self.managedObjectContext]).to.equal(human);
+    }
+    expect(self.cache.hitCount).to.equal(16);
+
+    [self.cache evictObjectsToCount:160];
+    expect([self.cache count]).to.beLessThanOrEqualTo(160);
+    expect(self.cache.evictionCount).to.equal(320 - [self.cache count]);
+    for (RKHuman *human in recentlyUsedHumans) {
+        expect([self.cache containsObject:human]).to.equal(YES);
+    }
+}
+
+- (void)testEvictionRetainsRecentlyUsedKeysAfterKeysAreRemovedAndAddedBack
+{
+    NSArray *humans = [self insertAndLoadHumansWithCount:320];
+    NSArray *readdedHumans = [humans subarrayWithRange:NSMakeRange(16, 16)];
+    for (NSInteger round = 0; round < 8; round++) {
+        for (RKHuman *human in readdedHumans) {
+            [self.cache removeObjectID:human.objectID forAttributeValues:@{ @"railsID": human.railsID }];
+            [self.cache addObjects:[NSSet setWithObject:human] completion:nil];
+        }
+    }
+    expect([self.cache count]).to.equal(320);
+
+    NSArray *recentlyUsedHumans = [humans subarrayWithRange:NSMakeRange(0, 16)];
+    for (RKHuman *human in recentlyUsedHumans) {
+        expect([self.cache objectWithAttributeValues:@{ @"railsID": human.railsID } inContext:self.managedObjectContext]).to.equal(human);
+    }
+
+    [self.cache evictObjectsToCount:160];
+    expect([self.cache count]).to.beLessThanOrEqualTo(160);
+    expect(self.cache.evictionCount).to.equal(320 - [self.cache count]);
+    for (RKHuman *human in recentlyUsedHumans) {
+        expect([self.cache containsObject:human]).to.equal(YES);
+    }
+
+    // Every key holds a single slot of the ring, so a second pass evicts each remaining key at most once
+    [self.cache evictObjectsToCount:0];
+    expect([self.cache count]).to.equal(0);
+    expect(self.cache.evictionCount).to.equal(320);
+}
+
+- (void)testLookupOfEvictedKeyFetchesObjectFromStore
+{
+    NSArray *humans = [self insertAndLoadHumansWithCount:10];
+    [self.cache evictObjectsToCount:0];
+    expect([self.cache count]).to.equal(0);
+
+    RKHuman *human = humans[3];
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @3 } inContext:self.managedObjectContext]).to.equal(human);
+    expect(self.cache.missCount).to.equal(1);
+    expect([self.cache containsObject:human]).to.equal(YES);
+    expect([self.cache objectWithAttributeValues:@{ @"railsID": @12345 } inContext:self.managedObjectContext]).to.beNil();
+    expect(self.cache.missCount).to.equal(2);
+}
+
+- (void)testLookupOfKeyAddedBackAfterEvictionFetchesTheEvictedObjects
+{
+    NSArray *humans = [self insertAndLoadHumansWithCount:4];
+    [self.cache evictObjectsToCount:0];
+    expect([self.cache count]).to.equal(0);
+    expect([self.cache snapshot]).to.beNil();
+
+    // The key is added back with a new object, while the object evicted with it is still in the store
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human.railsID = @1;
+    [self.managedObjectContext save:nil];
+    __block BOOL done = NO;
+    [self.cache addObjects:[NSSet setWithObject:human] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([self.cache count]).to.equal(1);
+
+    NSSet *objects = [self.cache objectsWithAttributeValues:@{ @"railsID": @1 } inContext:self.managedObjectContext];
+    expect(objects).to.equal([NSSet setWithObjects:humans[1], human, nil]);
+    expect([self.cache count]).to.equal(2);
+}
+
+- (void)testAddingObjectsBeyondCountLimitEvicts
+{
+    [self insertAndLoadHumansWithCount:20];
+    self.cache.countLimit = 10;
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human.railsID = @12345;
+    [self.cache addObjects:[NSSet setWithObject:human] completion:nil];
+    expect([self.cache count]).to.beLessThanOrEqualTo(10);
+    expect([self.cache containsObject:human]).to.equal(YES);
+}
+
+#pragma mark - Concurrency
+
+- (void)testConcurrentAdditionsAndLookupsAreConsistent
+{
+    NSMutableArray *humans = [NSMutableArray array];
+    for (NSInteger index = 0; index < 64; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+        human.railsID = @(index);
+        [humans addObject:human];
+    }
+    [self.managedObjectContext save:nil];
+
+    __block NSUInteger misses = 0;
+    dispatch_apply([humans count], dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        RKHuman *human = humans[index];
+        [self.cache addObjects:[NSSet setWithObject:human] completion:nil];
+        NSManagedObject *object = [self.cache objectWithAttributeValues:@{ @"railsID": @(index) } inContext:self.managedObjectContext];
+        if (! [object.objectID isEqual:human.objectID]) {
+            @synchronized(humans) {
+                misses++;
+            }
+        }
+    });
+    expect(misses).to.equal(0);
+    expect([self.cache count]).to.equal([humans count]);
+    expect([self.cache countOfAttributeValues]).to.equal([humans count]);
+    expect([self.cache containsObject:[humans lastObject]]).to.equal(YES);
+}
+
+#pragma mark - Cache Keys
+
+- (void)testCompositeCacheKeysCompareTheirValues
+{
+    id values[] = { @12345, @"Blake" };
+    RKEntityCacheKey *key = [[RKEntityCacheKey alloc] initWithValues:values count:2];
+    id equalValues[] = { @12345, [@"Bla" stringByAppendingString:@"ke"] };
+    RKEntityCacheKey *equalKey = [[RKEntityCacheKey alloc] initWithValues:equalValues count:2];
+    id reversedValues[] = { @"Blake", @12345 };
+    RKEntityCacheKey *reversedKey = [[RKEntityCacheKey alloc] initWithValues:reversedValues count:2];
+
+    expect(key).to.equal(equalKey);
+    expect([key hash]).to.equal([equalKey hash]);
+    expect(key).notTo.equal(reversedKey);
+    expect([key valueAtIndex:1]).to.equal(@"Blake");
+    expect([key description]).to.equal(@"12345:Blake");
+}
+
+- (void)testCompositeCacheKeysSurviveArchiving
+{
+    id values[] = { @12345, [NSNull null] };
+    RKEntityCacheKey *key = [[RKEntityCacheKey alloc] initWithValues:values count:2];
+    NSKeyedUnarchiver *unarchiver = [[NSKeyedUnarchiver alloc] initForReadingWithData:[NSKeyedArchiver archivedDataWithRootObject:key]];
+    unarchiver.requiresSecureCoding = YES;
+    RKEntityCacheKey *unarchivedKey = [unarchiver decodeObjectOfClass:[RKEntityCacheKey class] forKey:NSKeyedArchiveRootObjectKey];
+    expect(unarchivedKey).to.equal(key);
+    expect([unarchivedKey hash]).to.equal([key hash]);
+}
+
+- (void)testCacheKeyComponentsAreCoercedToTheAttributeType
+{
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"12345", NSInteger32AttributeType)).to.equal(@12345);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"12345abc", NSInteger32AttributeType)).to.equal(@"12345abc");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1.5", NSDoubleAttributeType)).to.equal(@1.5);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@12345, NSStringAttributeType)).to.equal(@"12345");
+    expect(RKEntityCacheKeyComponentForAttributeValue(nil, NSStringAttributeType)).to.equal([NSNull null]);
+}
+
+- (void)testOutOfRangeNumericStringsAreNotCoercedToNumbers
+{
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"99999999999999999999", NSInteger64AttributeType)).to.equal(@"99999999999999999999");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"99999999999999999998", NSInteger64AttributeType)).to.equal(@"99999999999999999998");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"-99999999999999999999", NSInteger64AttributeType)).to.equal(@"-99999999999999999999");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"9223372036854775807", NSInteger64AttributeType)).to.equal(@9223372036854775807LL);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1e400", NSDoubleAttributeType)).to.equal(@"1e400");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1e300", NSFloatAttributeType)).to.equal(@"1e300");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"inf", NSDoubleAttributeType)).to.equal(@"inf");
+}
+
+- (void)testNumericStringsWithLeadingWhitespaceAreNotCoercedToNumbers
+{
+    expect(RKEntityCacheKeyComponentForAttributeValue(@" 12345", NSInteger32AttributeType)).to.equal(@" 12345");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"\t12345", NSInteger32AttributeType)).to.equal(@"\t12345");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@" 1.5", NSDoubleAttributeType)).to.equal(@" 1.5");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"", NSInteger32AttributeType)).to.equal(@"");
+}
+
+- (void)testStringAndNumberCoercionsOfCacheKeyComponents
+{
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"-42", NSInteger16AttributeType)).to.equal(@-42);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1", NSBooleanAttributeType)).to.equal(@1);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1.5", NSFloatAttributeType)).to.equal(@1.5f);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"1.5", NSDecimalAttributeType)).to.equal([NSDecimalNumber decimalNumberWithString:@"1.5"]);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@1.5, NSDecimalAttributeType)).to.equal([NSDecimalNumber decimalNumberWithString:@"1.5"]);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@1.5, NSStringAttributeType)).to.equal(@"1.5");
+    expect(RKEntityCacheKeyComponentForAttributeValue(@12345, NSInteger32AttributeType)).to.equal(@12345);
+    expect(RKEntityCacheKeyComponentForAttributeValue(@"Blake", NSStringAttributeType)).to.equal(@"Blake");
+}
+
+- (void)testRetrievalOfCompositeKeyByStringValueOfNumericAttribute
+{
+    NSEntityDescription *entity = [NSEntityDescription entityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    self.cache = [[RKEntityByAttributeCache alloc] initWithEntity:entity
+                                                       attributes:@[ @"railsID", @"name" ]
+                                             managedObjectContext:self.managedObjectContext];
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectContext];
+    human.railsID = @12345;
+    human.name = @"Blake";
+    [self.managedObjectContext save:nil];
+    [self.cache load:nil];
+    expect([self.cache isLoaded]).will.equal(YES);
+
+    NSManagedObjectContext *childContext = [[NSManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    childContext.parentContext = self.managedObjectContext;
+    NSManagedObject *object = [self.cache objectWithAttributeValues:@{ @"name": @"Blake", @"railsID": @"12345" } inContext:childContext];
+    expect(object.objectID).to.equal(human.objectID);
+    expect([self.cache objectWithAttributeValues:@{ @"name": @"Jeff", @"railsID": @12345 } inContext:childContext]).to.beNil();
+    expect([self.cache countOfAttributeValues]).to.equal(1);
+}
+
 @end
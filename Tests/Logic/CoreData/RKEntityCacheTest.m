@@ -9,6 +9,7 @@
 #import "RKTestEnvironment.h"
 #import "RKEntityCache.h"
 #import "RKEntityByAttributeCache.h"
+#import "RKEntityCacheSnapshot.h"
 #import "RKHuman.h"
 
 @interface RKEntityCacheTest : RKTestCase
@@ -17,6 +18,21 @@
 @property (nonatomic, strong) NSEntityDescription *entity;
 @end
 
+// Records the fetch requests executed by the context, in order to verify that caches are loaded from snapshots without fetching
+@interface RKFetchCountingManagedObjectContext : NSManagedObjectContext
+@property (atomic, assign) NSUInteger fetchCount;
+@end
+
+@implementation RKFetchCountingManagedObjectContext
+
+- (NSArray *)executeFetchRequest:(NSFetchRequest *)request error:(NSError **)error
+{
+    self.fetchCount += 1;
+    return [super executeFetchRequest:request error:error];
+}
+
+@end
+
 @implementation RKEntityCacheTest
 
 @synthesize managedObjectStore = _managedObjectStore;
@@ -79,6 +95,21 @@
     assertThatInteger([caches count], is(equalToInteger(1)));
 }
 
+- (void)testRetrievalOfUnderlyingEntityAttributeCacheIgnoresAttributeOrder
+{
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID", @"name" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    RKEntityByAttributeCache *attributeCache = [_cache attributeCacheForEntity:self.entity attributes:@[ @"name", @"railsID" ]];
+    expect(attributeCache).notTo.beNil();
+    expect([_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID", @"name" ]]).to.beIdenticalTo(attributeCache);
+    expect([_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]]).to.beNil();
+    NSEntityDescription *catEntity = [NSEntityDescription entityForName:@"Cat" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+    expect([_cache attributeCacheForEntity:catEntity attributes:@[ @"railsID", @"name" ]]).to.beNil();
+}
+
 - (void)testRetrievalOfObjectForEntityWithAttributeValue
 {
     RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
@@ -244,6 +275,191 @@
     assertThatBool([entityAttributeCache containsObject:human1], is(equalToBool(NO)));
 }
 
+#pragma mark - Eviction
+
+- (void)testCountLimitIsSharedByAttributeCaches
+{
+    for (NSInteger index = 0; index < 20; index++) {
+        RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:self.managedObjectStore.persistentStoreManagedObjectContext];
+        human.railsID = @(index);
+        human.name = [NSString stringWithFormat:@"Human %ld", (long)index];
+    }
+    [self.managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    _cache.countLimit = 20;
+    __block NSUInteger loadedCount = 0;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        loadedCount++;
+    }];
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"name" ] completion:^{
+        loadedCount++;
+    }];
+    expect(loadedCount).will.equal(2);
+    NSUInteger count = [[_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]] count] + [[_cache attributeCacheForEntity:self.entity attributes:@[ @"name" ]] count];
+    expect(count).to.beLessThanOrEqualTo(20);
+    expect(_cache.evictionCount).to.equal(40 - count);
+    expect([_cache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @7 } inContext:self.managedObjectStore.persistentStoreManagedObjectContext]).notTo.beNil();
+}
+
+- (void)testCountLimitForEntityIsAppliedToItsAttributeCaches
+{
+    [_cache setCountLimit:5 forEntity:self.entity];
+    expect([_cache countLimitForEntity:self.entity]).to.equal(5);
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([[_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]] countLimit]).to.equal(5);
+}
+
+#pragma mark - Snapshots
+
+- (NSURL *)temporarySnapshotDirectoryURL
+{
+    NSString *path = [NSTemporaryDirectory() stringByAppendingPathComponent:[[NSProcessInfo processInfo] globallyUniqueString]];
+    return [NSURL fileURLWithPath:path isDirectory:YES];
+}
+
+- (void)testSavingWritesSnapshotFromWhichSubsequentCachesAreLoaded
+{
+    NSManagedObjectContext *context = self.managedObjectStore.persistentStoreManagedObjectContext;
+    NSURL *directoryURL = [self temporarySnapshotDirectoryURL];
+    NSURL *snapshotURL = RKEntityCacheSnapshotURLForEntity(directoryURL, self.entity, @[ @"railsID" ]);
+    _cache.snapshotDirectoryURL = directoryURL;
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:context];
+    human.railsID = @12345;
+    [context save:nil];
+    expect([[RKEntityCacheSnapshot snapshotWithContentsOfURL:snapshotURL error:nil] count]).will.equal(1);
+    RKEntityCacheSnapshot *snapshot = [RKEntityCacheSnapshot snapshotWithContentsOfURL:snapshotURL error:nil];
+    expect([snapshot isValidForEntity:self.entity attributes:@[ @"railsID" ] persistentStoreCoordinator:context.persistentStoreCoordinator]).to.equal(YES);
+    NSMutableDictionary *objectIDsByCacheKey = [NSMutableDictionary dictionary];
+    [snapshot enumerateObjectIDsWithPersistentStoreCoordinator:context.persistentStoreCoordinator usingBlock:^(id cacheKey, NSManagedObjectID *objectID) {
+        objectIDsByCacheKey[cacheKey] = objectID;
+    }];
+    expect(objectIDsByCacheKey).to.equal(@{ @12345: human.objectID });
+
+    RKFetchCountingManagedObjectContext *fetchCountingContext = [[RKFetchCountingManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    fetchCountingContext.persistentStoreCoordinator = context.persistentStoreCoordinator;
+    RKEntityCache *loadedCache = [[RKEntityCache alloc] initWithManagedObjectContext:fetchCountingContext];
+    loadedCache.snapshotDirectoryURL = directoryURL;
+    done = NO;
+    [loadedCache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([loadedCache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @12345 } inContext:context]).to.equal(human);
+    expect(fetchCountingContext.fetchCount).to.equal(0);
+
+    RKEntityCacheAdvanceGenerationsOfPersistentStoreCoordinator(context.persistentStoreCoordinator);
+    expect([snapshot isValidForEntity:self.entity attributes:@[ @"railsID" ] persistentStoreCoordinator:context.persistentStoreCoordinator]).to.equal(NO);
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+- (void)testSavingChangedCacheKeyAttributeMovesObjectInCache
+{
+    NSManagedObjectContext *context = self.managedObjectStore.persistentStoreManagedObjectContext;
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:context];
+    human.railsID = @12345;
+    [context save:nil];
+
+    NSURL *directoryURL = [self temporarySnapshotDirectoryURL];
+    _cache.snapshotDirectoryURL = directoryURL;
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    human.railsID = @54321;
+    [context save:nil];
+    expect([_cache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @12345 } inContext:context]).to.beNil();
+    expect([_cache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @54321 } inContext:context]).to.equal(human);
+
+    [context deleteObject:human];
+    [context save:nil];
+    expect([[_cache attributeCacheForEntity:self.entity attributes:@[ @"railsID" ]] count]).to.equal(0);
+    expect([[RKEntityCacheSnapshot snapshotWithContentsOfURL:RKEntityCacheSnapshotURLForEntity(directoryURL, self.entity, @[ @"railsID" ]) error:nil] count]).will.equal(0);
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+- (void)testSnapshotIsDiscardedWhenTheStoreContainsADifferentNumberOfObjects
+{
+    NSManagedObjectContext *context = self.managedObjectStore.persistentStoreManagedObjectContext;
+    NSURL *directoryURL = [self temporarySnapshotDirectoryURL];
+    _cache.snapshotDirectoryURL = directoryURL;
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    RKHuman *human1 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:context];
+    human1.railsID = @12345;
+    [context save:nil];
+    expect([[RKEntityCacheSnapshot snapshotWithContentsOfURL:RKEntityCacheSnapshotURLForEntity(directoryURL, self.entity, @[ @"railsID" ]) error:nil] count]).will.equal(1);
+
+    // Save without any cache observing, so that the store generations are not advanced
+    _cache.snapshotDirectoryURL = nil;
+    RKHuman *human2 = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:context];
+    human2.railsID = @54321;
+    [context save:nil];
+
+    RKFetchCountingManagedObjectContext *fetchCountingContext = [[RKFetchCountingManagedObjectContext alloc] initWithConcurrencyType:NSPrivateQueueConcurrencyType];
+    fetchCountingContext.persistentStoreCoordinator = context.persistentStoreCoordinator;
+    RKEntityCache *loadedCache = [[RKEntityCache alloc] initWithManagedObjectContext:fetchCountingContext];
+    loadedCache.snapshotDirectoryURL = directoryURL;
+    done = NO;
+    [loadedCache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect(fetchCountingContext.fetchCount).to.beGreaterThan(0);
+    expect([loadedCache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @54321 } inContext:context]).to.equal(human2);
+    loadedCache.snapshotDirectoryURL = nil;
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
+- (void)testSnapshotIsDiscardedWhenItsObjectsNoLongerHaveTheirCacheKeys
+{
+    NSManagedObjectContext *context = self.managedObjectStore.persistentStoreManagedObjectContext;
+    NSURL *directoryURL = [self temporarySnapshotDirectoryURL];
+    _cache.snapshotDirectoryURL = directoryURL;
+    __block BOOL done = NO;
+    [_cache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:context];
+    human.railsID = @12345;
+    [context save:nil];
+    expect([[RKEntityCacheSnapshot snapshotWithContentsOfURL:RKEntityCacheSnapshotURLForEntity(directoryURL, self.entity, @[ @"railsID" ]) error:nil] count]).will.equal(1);
+
+    // Change the key without advancing the store generations or the number of objects
+    _cache.snapshotDirectoryURL = nil;
+    human.railsID = @54321;
+    [context save:nil];
+
+    RKEntityCache *loadedCache = [[RKEntityCache alloc] initWithManagedObjectContext:context];
+    loadedCache.snapshotDirectoryURL = directoryURL;
+    done = NO;
+    [loadedCache cacheObjectsForEntity:self.entity byAttributes:@[ @"railsID" ] completion:^{
+        done = YES;
+    }];
+    expect(done).will.equal(YES);
+    expect([loadedCache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @12345 } inContext:context]).to.beNil();
+    expect([loadedCache objectForEntity:self.entity withAttributeValues:@{ @"railsID": @54321 } inContext:context]).to.equal(human);
+    loadedCache.snapshotDirectoryURL = nil;
+    [[NSFileManager defaultManager] removeItemAtURL:directoryURL error:nil];
+}
+
 #if TARGET_OS_IPHONE
 - (void)testCacheIsFlushedOnMemoryWarning
 {
@@ -27,6 +27,7 @@
 #import "RKCat.h"
 #import "RKManagedObjectMappingOperationDataSource.h"
 #import "RKDynamicMapping.h"
+#import "RKMapping_Private.h"
 
 @interface RKEntityMappingTest : RKTestCase
 
@@ -251,6 +252,29 @@
     expect(connection.attributes).to.equal(expectedAttributes);
 }
 
+- (void)testFreezingEntityMappingFreezesConnections
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *humanEntityMapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [humanEntityMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [humanEntityMapping addConnectionForRelationship:@"favoriteCat" connectedBy:@"favoriteCatID"];
+    [humanEntityMapping freeze];
+
+    RKConnectionDescription *connection = [humanEntityMapping connectionForRelationship:@"favoriteCat"];
+    expect(connection.isFrozen).to.equal(YES);
+    expect(^{ connection.includesSubentities = NO; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [humanEntityMapping addConnectionForRelationship:@"cats" connectedBy:@[ @"railsID", @"name" ]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [humanEntityMapping removeConnection:connection]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ humanEntityMapping.identificationAttributes = @[ @"railsID" ]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ humanEntityMapping.deletionPredicate = nil; }).to.raise(NSInternalInconsistencyException);
+    expect(humanEntityMapping.connections).to.haveCountOf(1);
+
+    RKEntityMapping *copy = [humanEntityMapping copy];
+    [copy addConnectionForRelationship:@"cats" connectedBy:@[ @"railsID", @"name" ]];
+    expect([copy connectionForRelationship:@"favoriteCat"].isFrozen).to.equal(NO);
+    expect(copy.connections).to.haveCountOf(2);
+}
+
 - (void)testAddingConnectionByArrayOfAttributeNames
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -845,4 +869,24 @@
     expect(mapping.modificationAttribute).to.beNil();
 }
 
+- (void)testEnablingFingerprintingRaisesInvalidArgumentException
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    expect(^{ mapping.fingerprintsRepresentations = YES; }).to.raise(NSInvalidArgumentException);
+    expect(mapping.fingerprintsRepresentations).to.beFalsy();
+}
+
+- (void)testPrimitiveValuesCanOnlyBeSetForDynamicAttributesOfTheEntity
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    expect([mapping canSetPrimitiveValueForDestinationKey:@"name"]).to.equal(YES);
+    expect([mapping canSetPrimitiveValueForDestinationKey:@"cats"]).to.equal(NO);
+    expect([mapping canSetPrimitiveValueForDestinationKey:@"nonexistent"]).to.equal(NO);
+
+    RKObjectMapping *objectMapping = [RKObjectMapping mappingForClass:[RKHuman class]];
+    expect([objectMapping canSetPrimitiveValueForDestinationKey:@"name"]).to.equal(NO);
+}
+
 @end
@@ -18,8 +18,10 @@
 #import "RKChild.h"
 #import "RKParent.h"
 #import "RKBenchmark.h"
+#import "RKObjectMappingPlan.h"
 
 @interface RKManagedObjectMappingOperationDataSourceTest : RKTestCase
+@property (nonatomic, strong) NSMutableArray *observedKeyPaths;
 @end
 
 /**
@@ -37,6 +39,11 @@
     [RKTestFactory tearDown];
 }
 
+- (void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary *)change context:(void *)context
+{
+    [self.observedKeyPaths addObject:keyPath];
+}
+
 - (NSEntityDescription *)entityWithNameByLoadingModel:(NSString *)entityName
 {
   // load the same compiled Core Data model, in the same fashion as the object store, and get its copy of the specified entity description
@@ -148,6 +155,30 @@
     expect(object).to.equal(human);
 }
 
+- (void)testRetrievingTargetObjectsForRepresentationsInBatchWithFetchRequestCache
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    managedObjectStore.managedObjectCache = [RKFetchRequestManagedObjectCache new];
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"id" toKeyPath:@"railsID"]];
+
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext];
+    human.railsID = @123;
+    [managedObjectStore.persistentStoreManagedObjectContext save:nil];
+
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectStore.persistentStoreManagedObjectContext
+                                                                                                                                      cache:managedObjectStore.managedObjectCache];
+    NSArray *representations = @[ @{ @"id": @456 }, @{ @"id": @123 }, @{ @"name": @"Blake" }, @{ @"id": @456 } ];
+    NSArray *objects = [dataSource mappingOperation:nil targetObjectsForRepresentations:representations withMapping:mapping inRelationship:nil];
+    expect(objects).to.haveCountOf(4);
+    expect(objects[1]).to.equal(human);
+    expect([objects[0] railsID]).to.equal(@456);
+    expect(objects[3]).to.beIdenticalTo(objects[0]);
+    expect([objects[2] railsID]).to.beNil();
+    expect(objects[2]).notTo.equal(objects[0]);
+}
+
 - (void)testShouldFindExistingManagedObjectsByPrimaryKeyPathWithFetchedResultsCache
 {
     RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
@@ -1885,4 +1916,104 @@
     expect(canSkipRelationships).to.equal(YES);
 }
 
+#pragma mark - Primitive Values
+
+- (RKEntityMapping *)humanMappingInManagedObjectStore:(RKManagedObjectStore *)managedObjectStore
+{
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    mapping.identificationAttributes = @[ @"railsID" ];
+    [mapping addAttributeMappingsFromDictionary:@{ @"id": @"railsID", @"name": @"name", @"nick_name": @"nickName" }];
+    return mapping;
+}
+
+- (void)testMappingInsertedObjectSetsPrimitiveValues
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKEntityMapping *mapping = [self humanMappingInManagedObjectStore:managedObjectStore];
+    for (RKPropertyMappingPlan *plan in mapping.executionPlan.keyAttributePlans) {
+        expect(plan.canSetPrimitiveValue).to.equal(YES);
+    }
+
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectContext cache:[RKFetchRequestManagedObjectCache new]];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"id": @123, @"name": @"Blake", @"nick_name": @"Blakey" } destinationObject:nil mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(operation.error).to.beNil();
+
+    RKHuman *human = operation.destinationObject;
+    expect(human.name).to.equal(@"Blake");
+    expect(human.nickName).to.equal(@"Blakey");
+    expect(human.railsID).to.equal(@123);
+
+    // Objects observed after their insertion are assigned values with the public accessors
+    [human addObserver:self forKeyPath:@"name" options:0 context:nil];
+    self.observedKeyPaths = [NSMutableArray array];
+    operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"id": @123, @"name": @"Blake Watters" } destinationObject:human mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    [human removeObserver:self forKeyPath:@"name"];
+    expect(human.name).to.equal(@"Blake Watters");
+    expect(self.observedKeyPaths).to.equal(@[ @"name" ]);
+
+    NSError *error = nil;
+    BOOL success = [managedObjectContext save:&error];
+    expect(success).to.equal(YES);
+    [managedObjectContext reset];
+    NSFetchRequest *fetchRequest = [NSFetchRequest fetchRequestWithEntityName:@"Human"];
+    fetchRequest.predicate = [NSPredicate predicateWithFormat:@"railsID == 123"];
+    RKHuman *fetchedHuman = [[managedObjectContext executeFetchRequest:fetchRequest error:&error] firstObject];
+    expect(fetchedHuman.name).to.equal(@"Blake Watters");
+    expect(fetchedHuman.nickName).to.equal(@"Blakey");
+
+    // Saved objects are no longer pending insertion
+    operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"id": @123 } destinationObject:fetchedHuman mapping:mapping];
+    expect([dataSource mappingOperationShouldSetPrimitiveValues:operation]).to.equal(NO);
+}
+
+- (void)testMappingExistingObjectNotifiesObservers
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    human.railsID = @123;
+    [managedObjectContext save:nil];
+
+    RKManagedObjectMappingOperationDataSource *dataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectContext cache:[RKFetchRequestManagedObjectCache new]];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"id": @123, @"name": @"Blake" } destinationObject:nil mapping:[self humanMappingInManagedObjectStore:managedObjectStore]];
+    operation.dataSource = dataSource;
+    self.observedKeyPaths = [NSMutableArray array];
+    [human addObserver:self forKeyPath:@"name" options:0 context:nil];
+    [operation start];
+    [human removeObserver:self forKeyPath:@"name"];
+
+    expect(operation.error).to.beNil();
+    expect(operation.destinationObject).to.equal(human);
+    expect(human.name).to.equal(@"Blake");
+    expect(self.observedKeyPaths).to.equal(@[ @"name" ]);
+}
+
+- (void)testChangeSetDistinguishesInsertedObjectsFromExistingObjects
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSManagedObjectContext *managedObjectContext = managedObjectStore.persistentStoreManagedObjectContext;
+    RKHuman *human = [NSEntityDescription insertNewObjectForEntityForName:@"Human" inManagedObjectContext:managedObjectContext];
+    human.railsID = @123;
+    [managedObjectContext save:nil];
+
+    NSArray *representations = @[ @{ @"id": @123, @"name": @"Blake" }, @{ @"id": @456, @"name": @"Sarah" } ];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: [self humanMappingInManagedObjectStore:managedObjectStore] }];
+    mapper.mappingOperationDataSource = [[RKManagedObjectMappingOperationDataSource alloc] initWithManagedObjectContext:managedObjectContext cache:[RKFetchRequestManagedObjectCache new]];
+    mapper.collectsChangeSet = YES;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+
+    RKMappingChangeSet *changeSet = mapper.mappingResult.changeSet;
+    RKHuman *insertedHuman = [mapper.mappingResult array][1];
+    expect(insertedHuman.railsID).to.equal(@456);
+    expect(changeSet.insertedObjects).to.equal(@[ insertedHuman ]);
+    expect(changeSet.updatedObjects).to.equal(@[ human ]);
+    expect([changeSet changedKeyPathsForObject:human]).to.equal([NSSet setWithObject:@"name"]);
+}
+
 @end
@@ -0,0 +1,173 @@
+//
+//  RKObjectJSONSerializationTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKObjectJSONSerialization.h"
+#import "RKObjectParameterization.h"
+#import "RKTestUser.h"
+#import "RKTestAddress.h"
+
+@interface RKObjectJSONSerializationTest : RKTestCase
+@end
+
+// Signs every request it builds, as subclasses overriding the documented request building method do
+@interface RKSigningObjectManager : RKObjectManager
+@end
+
+@implementation RKSigningObjectManager
+
+- (NSMutableURLRequest *)requestWithMethod:(NSString *)method path:(NSString *)path parameters:(NSDictionary *)parameters
+{
+    NSMutableURLRequest *request = [super requestWithMethod:method path:path parameters:parameters];
+    [request setValue:@"signed" forHTTPHeaderField:@"X-Signature"];
+    return request;
+}
+
+@end
+
+@implementation RKObjectJSONSerializationTest
+
+- (void)setUp
+{
+    [RKTestFactory setUp];
+
+    // Reset the default transformer
+    [RKValueTransformer setDefaultValueTransformer:nil];
+}
+
+- (void)tearDown
+{
+    [RKTestFactory tearDown];
+}
+
+- (RKRequestDescriptor *)userRequestDescriptorWithRootKeyPath:(NSString *)rootKeyPath
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping requestMapping];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city", @"state" ]];
+    RKObjectMapping *userMapping = [RKObjectMapping requestMapping];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"userID": @"id", @"birthDate": @"dates.birth", @"weight": @"weight",
+                                                       @"isDeveloper": @"developer", @"favoriteColors": @"colors", @"address.country": @"dates.country" }];
+    [userMapping addRelationshipMappingWithSourceKeyPath:@"address" mapping:addressMapping];
+    [userMapping addRelationshipMappingWithSourceKeyPath:@"friends" mapping:userMapping];
+    return [RKRequestDescriptor requestDescriptorWithMapping:userMapping objectClass:[RKTestUser class] rootKeyPath:rootKeyPath method:RKRequestMethodAny];
+}
+
+- (RKTestUser *)user
+{
+    RKTestUser *user = [RKTestUser new];
+    user.name = @"Blake \"Watters\"\né";
+    user.userID = @31337;
+    user.birthDate = [NSDate dateWithTimeIntervalSince1970:0];
+    user.weight = [NSDecimalNumber decimalNumberWithString:@"131.3"];
+    user.isDeveloper = @1;
+    user.favoriteColors = @[ @"Red", @0.5 ];
+    user.address = [RKTestAddress new];
+    user.address.city = @"Carrboro";
+    RKTestUser *friend = [RKTestUser new];
+    friend.name = @"Jeff";
+    user.friends = @[ friend ];
+    return user;
+}
+
+// The representation of a user with only a name: request mappings assign `null` to the attributes missing from an object
+- (NSDictionary *)representationOfUserWithName:(NSString *)name
+{
+    return @{ @"name": name ?: [NSNull null], @"id": [NSNull null], @"weight": [NSNull null], @"developer": [NSNull null], @"colors": [NSNull null],
+              @"dates": @{ @"birth": [NSNull null], @"country": [NSNull null] } };
+}
+
+- (id)parameterizedRepresentationOfObject:(id)object requestDescriptor:(RKRequestDescriptor *)requestDescriptor
+{
+    NSData *data = [RKMIMETypeSerialization dataFromObject:[RKObjectParameterization parametersWithObject:object requestDescriptor:requestDescriptor error:nil] MIMEType:RKMIMETypeJSON error:nil];
+    return [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+}
+
+- (void)testSerializingObjectMatchesParameterization
+{
+    RKRequestDescriptor *requestDescriptor = [self userRequestDescriptorWithRootKeyPath:@"user"];
+    RKTestUser *user = [self user];
+    NSError *error = nil;
+    NSData *data = [RKObjectJSONSerialization JSONDataWithObject:user requestDescriptor:requestDescriptor error:&error];
+    expect(error).to.beNil();
+    NSDictionary *representation = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+    expect(representation).to.equal([self parameterizedRepresentationOfObject:user requestDescriptor:requestDescriptor]);
+    expect(representation[@"user"][@"dates"]).to.equal((@{ @"birth": @"1970-01-01T00:00:00.000Z", @"country": [NSNull null] }));
+    expect(representation[@"user"][@"weight"]).to.equal(@"131.3");
+    expect(representation[@"user"][@"address"]).to.equal((@{ @"city": @"Carrboro", @"state": [NSNull null] }));
+    expect(representation[@"user"][@"friends"]).to.equal(@[ [self representationOfUserWithName:@"Jeff"] ]);
+    expect(representation[@"user"][@"name"]).to.equal(@"Blake \"Watters\"\né");
+}
+
+- (void)testSerializingArrayOfObjects
+{
+    RKRequestDescriptor *requestDescriptor = [self userRequestDescriptorWithRootKeyPath:nil];
+    RKTestUser *otherUser = [RKTestUser new];
+    otherUser.name = @"Dan";
+    NSError *error = nil;
+    NSData *data = [RKObjectJSONSerialization JSONDataWithObjects:@[ [self user], otherUser ] requestDescriptor:requestDescriptor error:&error];
+    expect(error).to.beNil();
+    NSArray *representation = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+    expect(representation).to.haveCountOf(2);
+    expect(representation[0]).to.equal([self parameterizedRepresentationOfObject:[self user] requestDescriptor:requestDescriptor]);
+    expect(representation[1]).to.equal([self representationOfUserWithName:@"Dan"]);
+    expect(representation[1]).to.equal([self parameterizedRepresentationOfObject:otherUser requestDescriptor:requestDescriptor]);
+}
+
+- (void)testSerializingObjectWithoutValuesSerializesNulls
+{
+    RKRequestDescriptor *requestDescriptor = [self userRequestDescriptorWithRootKeyPath:@"user"];
+    RKTestUser *user = [RKTestUser new];
+    NSData *data = [RKObjectJSONSerialization JSONDataWithObject:user requestDescriptor:requestDescriptor error:nil];
+    NSDictionary *representation = [NSJSONSerialization JSONObjectWithData:data options:0 error:nil];
+    expect(representation).to.equal(@{ @"user": [self representationOfUserWithName:nil] });
+    expect(representation).to.equal([self parameterizedRepresentationOfObject:user requestDescriptor:requestDescriptor]);
+}
+
+- (void)testSerializingMappingWithMetadataFallsBackToParameterization
+{
+    RKObjectMapping *mapping = [RKObjectMapping requestMapping];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.rootKeyPath": @"rootKeyPath" }];
+    RKRequestDescriptor *requestDescriptor = [RKRequestDescriptor requestDescriptorWithMapping:mapping objectClass:[NSDictionary class] rootKeyPath:nil method:RKRequestMethodAny];
+    NSData *data = [RKObjectJSONSerialization JSONDataWithObject:@{ @"name": @"Blake" } requestDescriptor:requestDescriptor error:nil];
+    expect([NSJSONSerialization JSONObjectWithData:data options:0 error:nil]).to.equal([self parameterizedRepresentationOfObject:@{ @"name": @"Blake" } requestDescriptor:requestDescriptor]);
+}
+
+- (void)testSerializingFloatsAtSinglePrecision
+{
+    RKObjectMapping *mapping = [RKObjectMapping requestMapping];
+    [mapping addAttributeMappingsFromArray:@[ @"weight" ]];
+    RKRequestDescriptor *requestDescriptor = [RKRequestDescriptor requestDescriptorWithMapping:mapping objectClass:[NSDictionary class] rootKeyPath:nil method:RKRequestMethodAny];
+    NSData *data = [RKObjectJSONSerialization JSONDataWithObject:@{ @"weight": @(131.3f) } requestDescriptor:requestDescriptor error:nil];
+    expect([[NSString alloc] initWithData:data encoding:NSUTF8StringEncoding]).to.equal(@"{\"weight\":131.3}");
+}
+
+- (void)testObjectManagerSerializesObjectsDirectlyToJSON
+{
+    RKObjectManager *manager = [RKObjectManager managerWithBaseURL:[NSURL URLWithString:@"http://restkit.org"]];
+    manager.requestSerializationMIMEType = RKMIMETypeJSON;
+    RKRequestDescriptor *requestDescriptor = [self userRequestDescriptorWithRootKeyPath:@"user"];
+    [manager addRequestDescriptor:requestDescriptor];
+    RKTestUser *user = [self user];
+    NSURLRequest *request = [manager requestWithObject:user method:RKRequestMethodPOST path:@"/users" parameters:nil];
+    expect([request valueForHTTPHeaderField:@"Content-Type"]).to.beginWith(RKMIMETypeJSON);
+    expect([NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil]).to.equal([self parameterizedRepresentationOfObject:user requestDescriptor:requestDescriptor]);
+}
+
+- (void)testObjectManagerSubclassesOverridingRequestBuildingSeeObjectRequests
+{
+    RKObjectManager *manager = [RKSigningObjectManager managerWithBaseURL:[NSURL URLWithString:@"http://restkit.org"]];
+    manager.requestSerializationMIMEType = RKMIMETypeJSON;
+    RKRequestDescriptor *requestDescriptor = [self userRequestDescriptorWithRootKeyPath:@"user"];
+    [manager addRequestDescriptor:requestDescriptor];
+    RKTestUser *user = [self user];
+    NSURLRequest *request = [manager requestWithObject:user method:RKRequestMethodPOST path:@"/users" parameters:nil];
+    expect([request valueForHTTPHeaderField:@"X-Signature"]).to.equal(@"signed");
+    expect([NSJSONSerialization JSONObjectWithData:request.HTTPBody options:0 error:nil]).to.equal([self parameterizedRepresentationOfObject:user requestDescriptor:requestDescriptor]);
+}
+
+@end
@@ -50,6 +50,36 @@ NSString *RKPathAndQueryStringFromURLRelativeToURL(NSURL *URL, NSURL *baseURL);
 
 @end
 
+// Records whether the mapper delegate was ever called off the main thread
+@interface RKMainThreadCheckingMapperDelegate : NSObject <RKMapperOperationDelegate>
+@property (nonatomic, assign) NSUInteger callbackCount;
+@property (nonatomic, assign) BOOL calledOffMainThread;
+@end
+@implementation RKMainThreadCheckingMapperDelegate
+
+- (void)recordCallback
+{
+    self.callbackCount++;
+    if (! [NSThread isMainThread]) self.calledOffMainThread = YES;
+}
+
+- (void)mapperWillStartMapping:(RKMapperOperation *)mapper
+{
+    [self recordCallback];
+}
+
+- (void)mapper:(RKMapperOperation *)mapper didFinishMappingOperation:(RKMappingOperation *)mappingOperation forKeyPath:(NSString *)keyPath
+{
+    [self recordCallback];
+}
+
+- (void)mapperDidFinishMapping:(RKMapperOperation *)mapper
+{
+    [self recordCallback];
+}
+
+@end
+
 @interface RKObjectResponseMapperOperationTest : RKTestCase
 @end
 
@@ -424,6 +454,81 @@ NSString *RKPathAndQueryStringFromURLRelativeToURL(NSURL *URL, NSURL *baseURL);
     [mockDelegate verify];
 }
 
+#pragma mark - Mapping in Time Slices
+
+- (void)testMappingManagedObjectsInSlicesCallsDelegateOnTheQueueOfTheContext
+{
+    RKManagedObjectStore *managedObjectStore = [RKTestFactory managedObjectStore];
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/humans"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": @"application/json"}];
+    NSData *data = [@"[{\"name\": \"Blake\"}, {\"name\": \"Jeff\"}, {\"name\": \"Dan\"}, {\"name\": \"Sarah\"}, {\"name\": \"Ana\"}]" dataUsingEncoding:NSUTF8StringEncoding];
+
+    RKEntityMapping *mapping = [RKEntityMapping mappingForEntityForName:@"Human" inManagedObjectStore:managedObjectStore];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:nil statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    RKMainThreadCheckingMapperDelegate *mapperDelegate = [RKMainThreadCheckingMapperDelegate new];
+    RKManagedObjectResponseMapperOperation *mapper = [[RKManagedObjectResponseMapperOperation alloc] initWithRequest:request response:response data:data responseDescriptors:@[ responseDescriptor ]];
+    mapper.managedObjectContext = managedObjectStore.mainQueueManagedObjectContext;
+    mapper.mapperDelegate = mapperDelegate;
+    mapper.maximumObjectsPerSlice = 2;
+
+    // Slicing applies when mapping from a background thread into a main queue context
+    NSOperationQueue *operationQueue = [NSOperationQueue new];
+    [operationQueue addOperation:mapper];
+    expect([mapper isFinished]).will.beTruthy();
+
+    expect(mapper.error).to.beNil();
+    expect([[mapper.mappingResult array] valueForKey:@"name"]).to.equal((@[ @"Blake", @"Jeff", @"Dan", @"Sarah", @"Ana" ]));
+    expect(mapperDelegate.callbackCount).to.equal(7);
+    expect(mapperDelegate.calledOffMainThread).to.beFalsy();
+}
+
+#pragma mark - Streaming
+
+- (void)testStreamingResponseDataMapsArrayAtKeyPath
+{
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": @"application/json"}];
+    NSData *data = [@"{\"page\": {\"total\": 3}, \"data\": {\"users\": [{\"name\": \"Blake\"}, null, {\"name\": \"Jeff\"}]}}" dataUsingEncoding:NSUTF8StringEncoding];
+
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"position" }];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:@"data.users" statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    RKObjectResponseMapperOperation *mapper = [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:data responseDescriptors:@[ responseDescriptor ]];
+    mapper.streamsResponseData = YES;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    NSArray *users = [mapper.mappingResult dictionary][@"data.users"];
+    expect([users valueForKey:@"name"]).to.equal(@[ @"Blake", @"Jeff" ]);
+    expect([users valueForKey:@"position"]).to.equal(@[ @0, @2 ]);
+}
+
+- (void)testStreamingTruncatedResponseDataFailsWithoutMapping
+{
+    NSURL *responseURL = [NSURL URLWithString:@"http://restkit.org/api/v1/users"];
+    NSURLRequest *request = [NSURLRequest requestWithURL:responseURL];
+    NSHTTPURLResponse *response = [[NSHTTPURLResponse alloc] initWithURL:responseURL statusCode:200 HTTPVersion:@"1.1" headerFields:@{@"Content-Type": @"application/json"}];
+    NSData *data = [@"[{\"name\": \"Blake\"}, {\"name\": \"Je" dataUsingEncoding:NSUTF8StringEncoding];
+
+    id mockDelegate = [OCMockObject niceMockForProtocol:@protocol(RKMapperOperationDelegate)];
+    [[mockDelegate reject] mapperWillStartMapping:OCMOCK_ANY];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKResponseDescriptor *responseDescriptor = [RKResponseDescriptor responseDescriptorWithMapping:mapping method:RKRequestMethodAny pathPattern:nil keyPath:nil statusCodes:[NSIndexSet indexSetWithIndex:200]];
+
+    RKObjectResponseMapperOperation *mapper = [[RKObjectResponseMapperOperation alloc] initWithRequest:request response:response data:data responseDescriptors:@[ responseDescriptor ]];
+    mapper.streamsResponseData = YES;
+    mapper.mapperDelegate = mockDelegate;
+    [mapper start];
+    expect(mapper.mappingResult).to.beNil();
+    expect([mapper.error code]).to.equal(NSURLErrorCannotParseResponse);
+    [mockDelegate verify];
+}
+
 #pragma mark - HTTP Metadata
 
 - (void)testThatResponseMapperMakesRequestMethodAvailableToMetadata
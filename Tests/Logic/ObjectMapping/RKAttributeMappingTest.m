@@ -48,4 +48,108 @@
     expect([propertyMappingCopy.valueTransformer isEqual:propertyMapping.valueTransformer]);
 }
 
+- (RKValueTransformer *)stringToNumberTransformerWithInvocationCount:(NSUInteger *)invocationCount rejectingPrefix:(NSString *)prefix result:(NSNumber *)result
+{
+    return [RKBlockValueTransformer valueTransformerWithValidationBlock:^BOOL(__unsafe_unretained Class inputValueClass, __unsafe_unretained Class outputValueClass) {
+        return [inputValueClass isSubclassOfClass:[NSString class]] && [outputValueClass isSubclassOfClass:[NSNumber class]];
+    } transformationBlock:^BOOL(id inputValue, __autoreleasing id *outputValue, __unsafe_unretained Class outputClass, NSError *__autoreleasing *error) {
+        (*invocationCount)++;
+        if ([inputValue hasPrefix:prefix]) return NO;
+        *outputValue = result;
+        return YES;
+    }];
+}
+
+- (void)testTransformingValuesConsultsResolvedTransformersInOrder
+{
+    NSUInteger firstInvocationCount = 0;
+    NSUInteger secondInvocationCount = 0;
+    RKCompoundValueTransformer *valueTransformer = [RKCompoundValueTransformer new];
+    RKValueTransformer *firstTransformer = [self stringToNumberTransformerWithInvocationCount:&firstInvocationCount rejectingPrefix:@"1" result:@1];
+    RKValueTransformer *secondTransformer = [self stringToNumberTransformerWithInvocationCount:&secondInvocationCount rejectingPrefix:@"f" result:@2];
+    [valueTransformer addValueTransformer:firstTransformer];
+    [valueTransformer addValueTransformer:secondTransformer];
+
+    RKAttributeMapping *propertyMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"source" toKeyPath:@"destination"];
+    propertyMapping.valueTransformer = valueTransformer;
+    expect([propertyMapping valueTransformersForTransformingFromClass:[NSString class] toClass:[NSNumber class]]).to.equal((@[ firstTransformer, secondTransformer ]));
+
+    id value = nil;
+    for (NSUInteger index = 0; index < 3; index++) {
+        expect([propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil]).to.equal(YES);
+        expect(value).to.equal(@2);
+    }
+    expect(firstInvocationCount).to.equal(3);
+    expect(secondInvocationCount).to.equal(3);
+
+    // The transformer that succeeded last is not promoted: results match those of the compound value transformer regardless of the order of the values
+    expect([propertyMapping transformValue:@"999" toValue:&value ofClass:[NSNumber class] error:nil]).to.equal(YES);
+    expect(value).to.equal(@1);
+    id compoundValue = nil;
+    [valueTransformer transformValue:@"999" toValue:&compoundValue ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(compoundValue);
+    expect(secondInvocationCount).to.equal(3);
+}
+
+- (void)testMutatingTheValueTransformerInPlaceDiscardsMemoizedTransformers
+{
+    NSUInteger invocationCount = 0;
+    RKCompoundValueTransformer *valueTransformer = [RKCompoundValueTransformer new];
+    [valueTransformer addValueTransformer:[self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@1]];
+    RKAttributeMapping *propertyMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"source" toKeyPath:@"destination"];
+    propertyMapping.valueTransformer = valueTransformer;
+
+    id value = nil;
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@1);
+
+    RKValueTransformer *insertedTransformer = [self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@2];
+    [valueTransformer insertValueTransformer:insertedTransformer atIndex:0];
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@2);
+
+    [valueTransformer removeValueTransformer:insertedTransformer];
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@1);
+}
+
+- (void)testSwappingATransformerOfTheValueTransformerDiscardsMemoizedTransformers
+{
+    NSUInteger invocationCount = 0;
+    RKValueTransformer *firstTransformer = [self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@1];
+    RKCompoundValueTransformer *valueTransformer = [RKCompoundValueTransformer new];
+    [valueTransformer addValueTransformer:firstTransformer];
+    RKAttributeMapping *propertyMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"source" toKeyPath:@"destination"];
+    propertyMapping.valueTransformer = valueTransformer;
+
+    id value = nil;
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@1);
+
+    // The number of transformers is unchanged, so only their identities tell the memo apart
+    [valueTransformer removeValueTransformer:firstTransformer];
+    [valueTransformer addValueTransformer:[self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@2]];
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@2);
+}
+
+- (void)testReplacingTheValueTransformerDiscardsMemoizedTransformers
+{
+    NSUInteger invocationCount = 0;
+    RKCompoundValueTransformer *valueTransformer = [RKCompoundValueTransformer new];
+    [valueTransformer addValueTransformer:[self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@1]];
+    RKAttributeMapping *propertyMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"source" toKeyPath:@"destination"];
+    propertyMapping.valueTransformer = valueTransformer;
+
+    id value = nil;
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@1);
+
+    RKCompoundValueTransformer *otherValueTransformer = [RKCompoundValueTransformer new];
+    [otherValueTransformer addValueTransformer:[self stringToNumberTransformerWithInvocationCount:&invocationCount rejectingPrefix:@"fail" result:@2]];
+    propertyMapping.valueTransformer = otherValueTransformer;
+    [propertyMapping transformValue:@"123" toValue:&value ofClass:[NSNumber class] error:nil];
+    expect(value).to.equal(@2);
+}
+
 @end
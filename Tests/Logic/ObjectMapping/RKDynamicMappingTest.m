@@ -183,6 +183,99 @@
     assertThat(NSStringFromClass(mapping.objectClass), is(equalTo(@"Boy")));
 }
 
+- (void)testValueMatchersAcrossKeyPathsAreConsultedInRegistrationOrder
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"kind" expectedValue:@"child" objectMapping:boyMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValueMap:@{ @"Girl": girlMapping, @"Boy": boyMapping }]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"kind" expectedValue:@"daughter" objectMapping:girlMapping]];
+
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Girl", @"kind": @"child" }]).to.equal(boyMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"kind": @"daughter" }]).to.equal(boyMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"kind": @"daughter" }]).to.equal(girlMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"kind": @"unknown" }]).to.beNil();
+}
+
+- (void)testPredicateMatchersAreConsultedBetweenValueMatchersInRegistrationOrder
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithPredicate:[NSPredicate predicateWithFormat:@"numeric_type = 0"] objectMapping:girlMapping]];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Boy" objectMapping:boyMapping]];
+    [dynamicMapping setObjectMappingForRepresentationBlock:^RKObjectMapping *(id representation) {
+        return boyMapping;
+    }];
+
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"numeric_type": @0 }]).to.equal(girlMapping);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy", @"numeric_type": @1 }]).to.equal(boyMapping);
+
+    // Adding a matcher invalidates the compiled index
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Girl" objectMapping:girlMapping]];
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Girl", @"numeric_type": @1 }]).to.equal(girlMapping);
+}
+
+- (void)testFreezingCompilesMatchersAndFreezesTheirMappings
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *girlMapping = [RKObjectMapping mappingForClass:[Girl class]];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    RKObjectMappingMatcher *matcher = [RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValueMap:@{ @"Girl": girlMapping, @"Boy": boyMapping }];
+    [dynamicMapping addMatcher:matcher];
+    [dynamicMapping freeze];
+
+    expect(dynamicMapping.isFrozen).to.equal(YES);
+    expect(girlMapping.isFrozen).to.equal(YES);
+    expect(boyMapping.isFrozen).to.equal(YES);
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"type": @"Boy" }]).to.equal(boyMapping);
+    expect(^{ [dynamicMapping removeMatcher:matcher]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"kind" expectedValue:@"child" objectMapping:boyMapping]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [dynamicMapping setObjectMappingForRepresentationBlock:^RKObjectMapping *(id representation) { return nil; }]; }).to.raise(NSInternalInconsistencyException);
+    expect(dynamicMapping.matchers).to.equal(@[ matcher ]);
+}
+
+- (void)testMappingsReturnedByTheBlockOfAFrozenMappingAreFrozen
+{
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    [boyMapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [dynamicMapping setObjectMappingForRepresentationBlock:^RKObjectMapping *(id representation) {
+        return boyMapping;
+    }];
+    expect([dynamicMapping objectMappingForRepresentation:@{ @"name": @"Blake" }]).to.equal(boyMapping);
+    expect(boyMapping.isFrozen).to.equal(NO);
+
+    [dynamicMapping freeze];
+    expect(boyMapping.isFrozen).to.equal(NO);
+    __block NSUInteger unfrozenCount = 0;
+    NSObject *lock = [NSObject new];
+    dispatch_apply(16, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t index) {
+        RKObjectMapping *mapping = [dynamicMapping objectMappingForRepresentation:@{ @"name": @"Blake" }];
+        if (! mapping.isFrozen) {
+            @synchronized(lock) {
+                unfrozenCount++;
+            }
+        }
+    });
+    expect(unfrozenCount).to.equal(0);
+    expect(boyMapping.isFrozen).to.equal(YES);
+    expect(^{ [boyMapping addAttributeMappingsFromArray:@[ @"age" ]]; }).to.raise(NSInternalInconsistencyException);
+}
+
+- (void)testFreezingTerminatesOnCyclicMappingGraphs
+{
+    RKObjectMapping *boyMapping = [RKObjectMapping mappingForClass:[Boy class]];
+    RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
+    [dynamicMapping addMatcher:[RKObjectMappingMatcher matcherWithKeyPath:@"type" expectedValue:@"Boy" objectMapping:boyMapping]];
+    [boyMapping addRelationshipMappingWithSourceKeyPath:@"friends" mapping:dynamicMapping];
+    [boyMapping freeze];
+
+    expect(boyMapping.isFrozen).to.equal(YES);
+    expect(dynamicMapping.isFrozen).to.equal(YES);
+}
+
 - (void)testIteratingAndRemovingAllMatchers
 {
     RKDynamicMapping *dynamicMapping = [RKDynamicMapping new];
@@ -0,0 +1,168 @@
+//
+//  RKGeneratedMappingTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import <objc/runtime.h>
+#import "RKTestEnvironment.h"
+#import "RKGeneratedMapping.h"
+#import "RKObjectMappingPlan.h"
+#import "RKMappingCodeGenerator.h"
+#import "RKTestUser.h"
+
+static NSUInteger RKGeneratedMappingTestInvocationCount = 0;
+
+// Mirrors the code emitted by `RKMappingCodeGenerator` for a mapping of `name` and `website`
+static BOOL RKGeneratedMappingTestMapUser(RKMappingOperation *operation, NSDictionary *representation, id destinationObject, BOOL *appliedMappings)
+{
+    if (object_getClass(destinationObject) != [RKTestUser class]) return NO;
+    RKGeneratedMappingTestInvocationCount++;
+    RKTestUser *object = destinationObject;
+    BOOL applied = NO;
+
+    id value = [representation objectForKey:@"name"];
+    if ([value isKindOfClass:[NSString class]]) {
+        [object setName:value];
+        RKGeneratedMappingDidMapAttribute(operation, 0);
+        applied = YES;
+    } else if (RKGeneratedMappingApplyAttributeValue(operation, 0, value)) {
+        applied = YES;
+    }
+    if (RKGeneratedMappingApplyAttribute(operation, 1)) applied = YES;
+
+    *appliedMappings = applied;
+    return YES;
+}
+
+@interface RKGeneratedMappingTestDelegate : NSObject <RKMappingOperationDelegate>
+@property (nonatomic, strong) NSMutableArray *keyPaths;
+@end
+
+@implementation RKGeneratedMappingTestDelegate
+
+- (void)mappingOperation:(RKMappingOperation *)operation didSetValue:(id)value forKeyPath:(NSString *)keyPath usingMapping:(RKAttributeMapping *)propertyMapping
+{
+    if (! self.keyPaths) self.keyPaths = [NSMutableArray array];
+    [self.keyPaths addObject:keyPath];
+}
+
+@end
+
+@interface RKGeneratedMappingTest : RKTestCase
+@property (nonatomic, copy) NSString *registeredSignature;
+@end
+
+@implementation RKGeneratedMappingTest
+
+- (void)setUp
+{
+    RKGeneratedMappingTestInvocationCount = 0;
+}
+
+- (void)tearDown
+{
+    if (self.registeredSignature) RKRegisterGeneratedMappingFunction(self.registeredSignature, NULL);
+}
+
+- (RKObjectMapping *)userMappingWithRegisteredFunction
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"name" toKeyPath:@"name"]];
+    [mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"website" toKeyPath:@"website"]];
+
+    // The function must be registered before the mapping compiles its own execution plan
+    self.registeredSignature = RKGeneratedMappingSignatureForPlan([[RKObjectMappingPlan alloc] initWithObjectMapping:mapping]);
+    RKRegisterGeneratedMappingFunction(self.registeredSignature, RKGeneratedMappingTestMapUser);
+    return mapping;
+}
+
+- (void)testMappingOperationUsesRegisteredGeneratedFunction
+{
+    RKObjectMapping *mapping = [self userMappingWithRegisteredFunction];
+    expect(mapping.executionPlan.generatedMappingFunction == RKGeneratedMappingTestMapUser).to.equal(YES);
+
+    RKTestUser *user = [RKTestUser new];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"website": @"http://restkit.org" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect(RKGeneratedMappingTestInvocationCount).to.equal(1);
+    expect(user.name).to.equal(@"Blake");
+    expect(user.website).to.equal([NSURL URLWithString:@"http://restkit.org"]);
+    expect([operation.mappingInfo propertyMappings]).to.haveCountOf(2);
+}
+
+- (void)testGeneratedFunctionFallsBackForUnexpectedValues
+{
+    RKObjectMapping *mapping = [self userMappingWithRegisteredFunction];
+    RKTestUser *user = [RKTestUser new];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @12345 } destinationObject:user mapping:mapping];
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect(RKGeneratedMappingTestInvocationCount).to.equal(1);
+    expect(user.name).to.equal(@"12345");
+}
+
+- (void)testGeneratedFunctionIsBypassedWhenDelegateObservesValues
+{
+    RKObjectMapping *mapping = [self userMappingWithRegisteredFunction];
+    RKTestUser *user = [RKTestUser new];
+    RKGeneratedMappingTestDelegate *delegate = [RKGeneratedMappingTestDelegate new];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake" } destinationObject:user mapping:mapping];
+    operation.delegate = delegate;
+    [operation start];
+    expect(RKGeneratedMappingTestInvocationCount).to.equal(0);
+    expect(user.name).to.equal(@"Blake");
+    expect(delegate.keyPaths).to.equal(@[ @"name" ]);
+}
+
+- (void)testModifyingMappingChangesSignature
+{
+    RKObjectMapping *mapping = [self userMappingWithRegisteredFunction];
+    [mapping addPropertyMapping:[RKAttributeMapping attributeMappingFromKeyPath:@"email" toKeyPath:@"emailAddress"]];
+    expect(RKGeneratedMappingSignatureForPlan(mapping.executionPlan)).notTo.equal(self.registeredSignature);
+    expect(mapping.executionPlan.generatedMappingFunction == NULL).to.equal(YES);
+
+    RKAttributeMapping *transformedMapping = [RKAttributeMapping attributeMappingFromKeyPath:@"name" toKeyPath:@"name"];
+    transformedMapping.valueTransformer = [RKBlockValueTransformer valueTransformerWithValidationBlock:^BOOL(__unsafe_unretained Class inputValueClass, __unsafe_unretained Class outputValueClass) {
+        return YES;
+    } transformationBlock:^BOOL(id inputValue, __autoreleasing id *outputValue, Class outputValueClass, NSError *__autoreleasing *error) {
+        *outputValue = [inputValue uppercaseString];
+        return YES;
+    }];
+    RKObjectMapping *transformingMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [transformingMapping addPropertyMapping:transformedMapping];
+    expect([transformingMapping.executionPlan.keyAttributePlans count]).to.equal(1);
+    expect(RKPropertyMappingPlanUsesIdentityTransformation(transformingMapping.executionPlan.keyAttributePlans[0])).to.equal(NO);
+    expect(RKPropertyMappingPlanUsesIdentityTransformation(mapping.executionPlan.keyAttributePlans[0])).to.equal(YES);
+}
+
+- (void)testCodeGeneratorEmitsDirectAssignmentsAndFallbacks
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"age", @"website" ]];
+    RKObjectMapping *dictionaryMapping = [RKObjectMapping mappingForClass:[NSMutableDictionary class]];
+    [dictionaryMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    [mapping addRelationshipMappingWithSourceKeyPath:@"address" mapping:dictionaryMapping];
+
+    RKMappingCodeGenerator *generator = [[RKMappingCodeGenerator alloc] initWithName:@"Test Mappings"];
+    [generator addMapping:mapping];
+    expect(generator.objectMappings).to.equal(@[ mapping ]);
+
+    NSString *sourceCode = [generator sourceCode];
+    NSString *signature = RKGeneratedMappingSignatureForPlan(mapping.executionPlan);
+    NSString *registration = [NSString stringWithFormat:@"RKRegisterGeneratedMappingFunction(@\"%@\", RKGeneratedMapping_Test_Mappings_0);", signature];
+    expect([sourceCode rangeOfString:@"#import \"RKTestUser.h\""].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"if (object_getClass(destinationObject) != [RKTestUser class]) return NO;"].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"value = [representation objectForKey:@\"name\"];"].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"[object setName:value];"].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"scalarValue = [(NSNumber *)value "].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"[object setAge:scalarValue];"].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:@"RKGeneratedMappingApplyAttribute(operation, 2)"].location).notTo.equal(NSNotFound);
+    expect([sourceCode rangeOfString:registration].location).notTo.equal(NSNotFound);
+}
+
+@end
@@ -0,0 +1,105 @@
+//
+//  RKMappingChangeSetTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKMappingChangeSet.h"
+#import "RKTestUser.h"
+#import "RKTestAddress.h"
+
+@interface RKMappingChangeSetTest : RKTestCase
+@end
+
+@implementation RKMappingChangeSetTest
+
+- (RKObjectMapping *)userMapping
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromArray:@[ @"name", @"emailAddress" ]];
+    [userMapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"address" toKeyPath:@"address" withMapping:addressMapping]];
+    return userMapping;
+}
+
+- (void)testRecordingMappingsOfTheSameObjectMergesEntries
+{
+    RKTestUser *user = [RKTestUser new];
+    RKTestUser *otherUser = [RKTestUser new];
+    RKMappingChangeSet *changeSet = [RKMappingChangeSet new];
+    [changeSet recordMappingOfObject:user inserted:NO changedKeyPaths:nil];
+    [changeSet recordMappingOfObject:otherUser inserted:NO changedKeyPaths:nil];
+    expect(changeSet.unchangedObjects).to.equal(@[ user, otherUser ]);
+
+    RKMappingChangeSet *otherChangeSet = [RKMappingChangeSet new];
+    [otherChangeSet recordMappingOfObject:user inserted:NO changedKeyPaths:[NSSet setWithObject:@"name"]];
+    [otherChangeSet recordMappingOfObject:user inserted:NO changedKeyPaths:[NSSet setWithObject:@"emailAddress"]];
+    [changeSet addEntriesFromChangeSet:otherChangeSet];
+    expect(changeSet.updatedObjects).to.equal(@[ user ]);
+    expect(changeSet.unchangedObjects).to.equal(@[ otherUser ]);
+    expect([changeSet changedKeyPathsForObject:user]).to.equal([NSSet setWithObjects:@"name", @"emailAddress", nil]);
+    expect([changeSet changedKeyPathsForObject:otherUser]).to.equal([NSSet set]);
+    expect([changeSet changedKeyPathsForObject:[RKTestUser new]]).to.beNil();
+}
+
+- (void)testMapperCollectsInsertedAndUpdatedObjects
+{
+    RKTestUser *user = [RKTestUser new];
+    user.name = @"Blake";
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"name": @"Blake", @"emailAddress": @"blake@restkit.org", @"address": @{ @"city": @"Carrboro" } }
+                                                               mappingsDictionary:@{ [NSNull null]: [self userMapping] }];
+    mapper.targetObject = user;
+    mapper.collectsChangeSet = YES;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+
+    RKMappingChangeSet *changeSet = mapper.mappingResult.changeSet;
+    expect(changeSet.insertedObjects).to.equal(@[ user.address ]);
+    expect(changeSet.updatedObjects).to.equal(@[ user ]);
+    expect(changeSet.unchangedObjects).to.beEmpty();
+    expect([changeSet changedKeyPathsForObject:user]).to.equal([NSSet setWithObjects:@"emailAddress", @"address", nil]);
+    expect([changeSet changedKeyPathsForObject:user.address]).to.equal([NSSet setWithObject:@"city"]);
+}
+
+- (void)testMapperCollectsUnchangedObjects
+{
+    RKTestUser *user = [RKTestUser new];
+    user.name = @"Blake";
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"name": @"Blake" } mappingsDictionary:@{ [NSNull null]: [self userMapping] }];
+    mapper.targetObject = user;
+    mapper.collectsChangeSet = YES;
+    [mapper start];
+
+    expect(mapper.mappingResult.changeSet.unchangedObjects).to.equal(@[ user ]);
+    expect(mapper.mappingResult.changeSet.updatedObjects).to.beEmpty();
+}
+
+- (void)testChangeSetIsNotCollectedByDefault
+{
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"name": @"Blake" } mappingsDictionary:@{ [NSNull null]: [self userMapping] }];
+    [mapper start];
+    expect(mapper.mappingResult).notTo.beNil();
+    expect(mapper.mappingResult.changeSet).to.beNil();
+}
+
+- (void)testConcurrentlyMappedCollectionListsObjectsInCollectionOrder
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 200; index++) {
+        [representations addObject:@{ @"name": [NSString stringWithFormat:@"User %ld", (long) index] }];
+    }
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: mapping }];
+    mapper.mapsCollectionsConcurrently = YES;
+    mapper.collectsChangeSet = YES;
+    [mapper start];
+
+    expect(mapper.mappingResult.changeSet.insertedObjects).to.equal([mapper.mappingResult array]);
+}
+
+@end
@@ -25,6 +25,8 @@
 #import "RKObjectMappingOperationDataSource.h"
 #import "RKTestAddress.h"
 #import "RKTestUser.h"
+#import "RKDotNetDateFormatter.h"
+#import "RKValueTransformers.h"
 
 @interface TestMappable : NSObject {
     NSURL *_url;
@@ -400,6 +402,70 @@
     assertThat([object.date description], is(equalTo(@"2011-08-09 00:00:00 +0000")));
 }
 
+- (void)testShouldReuseCachedDatesForRepeatedDateStrings
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromArray:@[@"date"]];
+    mapping.parsedDateCacheLimit = 10;
+    NSDictionary *dictionary = @{@"date": @"08/09/2011"};
+    TestMappable *firstObject = [TestMappable new];
+    TestMappable *secondObject = [TestMappable new];
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+    for (TestMappable *object in @[ firstObject, secondObject ]) {
+        RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:dictionary destinationObject:object mapping:mapping];
+        operation.dataSource = dataSource;
+        [operation start];
+        expect(operation.error).to.beNil();
+    }
+    expect([firstObject.date description]).to.equal(@"2011-08-09 00:00:00 +0000");
+    expect(secondObject.date).to.beIdenticalTo(firstObject.date);
+}
+
+- (void)testShouldDiscardCachedDatesWhenTheValueTransformerIsMutated
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromArray:@[@"date"]];
+    mapping.valueTransformer = [mapping.valueTransformer copy];
+    mapping.parsedDateCacheLimit = 10;
+    NSDictionary *dictionary = @{@"date": @"08/09/2011"};
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+
+    TestMappable *firstObject = [TestMappable new];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:dictionary destinationObject:firstObject mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect([firstObject.date description]).to.equal(@"2011-08-09 00:00:00 +0000");
+
+    // Read the string as day/month instead of month/day
+    NSDateFormatter *dateFormatter = [NSDateFormatter new];
+    dateFormatter.locale = [[NSLocale alloc] initWithLocaleIdentifier:@"en_US_POSIX"];
+    dateFormatter.timeZone = [NSTimeZone timeZoneForSecondsFromGMT:0];
+    dateFormatter.dateFormat = @"dd/MM/yyyy";
+    [(RKCompoundValueTransformer *)mapping.valueTransformer insertValueTransformer:dateFormatter atIndex:0];
+
+    TestMappable *secondObject = [TestMappable new];
+    operation = [[RKMappingOperation alloc] initWithSourceObject:dictionary destinationObject:secondObject mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect([secondObject.date description]).to.equal(@"2011-09-08 00:00:00 +0000");
+}
+
+- (void)testShouldMapADotNetDateStringWithAPreferredDotNetDateFormatter
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
+    [mapping addAttributeMappingsFromArray:@[@"date"]];
+    mapping.valueTransformer = [mapping.valueTransformer copy];
+    [(RKCompoundValueTransformer *)mapping.valueTransformer insertValueTransformer:(NSFormatter<RKValueTransforming> *)[RKDotNetDateFormatter new] atIndex:0];
+    TestMappable *object = [TestMappable new];
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{@"date": @"/Date(1112715000000-0500)/"} destinationObject:object mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect([object.date description]).to.equal(@"2005-04-05 15:30:00 +0000");
+}
+
 #pragma clang diagnostic push
 #pragma clang diagnostic ignored "-Wdeprecated-declarations"
 
@@ -563,6 +629,39 @@
     expect(blake.friend.luckyNumber).to.beNil();
 }
 
+- (void)testReusingMappingOperationResetsStateAndMetadata
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"luckyNumber" }];
+    [userMapping addRelationshipMappingWithSourceKeyPath:@"friends" mapping:userMapping];
+
+    NSDictionary *representation = @{ @"name": @"Blake", @"friends": @[ @{ @"name": @"Jeff" }, @{ @"name": @"Dan" } ] };
+    RKMappingOperation *mappingOperation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:nil mapping:userMapping metadataList:@[ @{ @"mapping": @{ @"collectionIndex": @0 } } ]];
+    mappingOperation.dataSource = [RKObjectMappingOperationDataSource new];
+    expect([mappingOperation performMapping:nil]).to.equal(YES);
+    RKTestUser *blake = mappingOperation.destinationObject;
+
+    [mappingOperation prepareForReuseWithSourceObject:@{ @"unknown": @"value" } destinationObject:nil mapping:userMapping metadataList:nil];
+    expect(mappingOperation.destinationObject).to.beNil();
+    expect([mappingOperation performMapping:nil]).to.equal(NO);
+
+    representation = @{ @"name": @"Sarah", @"friends": @[ @{ @"name": @"Rachit" } ] };
+    [mappingOperation prepareForReuseWithSourceObject:representation destinationObject:nil mapping:userMapping metadataList:@[ @{ @"mapping": @{ @"collectionIndex": @1 } } ]];
+    expect(mappingOperation.error).to.beNil();
+    expect([mappingOperation performMapping:nil]).to.equal(YES);
+    RKTestUser *sarah = mappingOperation.destinationObject;
+
+    expect(blake.name).to.equal(@"Blake");
+    expect(blake.luckyNumber).to.equal(@0);
+    expect([blake.friends valueForKey:@"name"]).to.equal(@[ @"Jeff", @"Dan" ]);
+    expect([blake.friends valueForKey:@"luckyNumber"]).to.equal(@[ @0, @1 ]);
+    expect(sarah).notTo.beIdenticalTo(blake);
+    expect(sarah.name).to.equal(@"Sarah");
+    expect(sarah.luckyNumber).to.equal(@1);
+    expect([sarah.friends valueForKey:@"name"]).to.equal(@[ @"Rachit" ]);
+    expect([sarah.friends valueForKey:@"luckyNumber"]).to.equal(@[ @0 ]);
+}
+
 - (void)testThatCustomTransformerOnPropertyMappingIsInvoked
 {
     RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[TestMappable class]];
@@ -0,0 +1,110 @@
+//
+//  RKMappingProfilerTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKMappingProfiler.h"
+#import "RKTestUser.h"
+
+@interface RKMappingProfilerTest : RKTestCase
+
+@end
+
+@implementation RKMappingProfilerTest
+
+- (RKMappingProfiler *)profilerByMappingUsers
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"id": @"userID" }];
+    [userMapping addRelationshipMappingWithSourceKeyPath:@"friends" mapping:userMapping];
+
+    NSDictionary *representation = @{ @"users": @[ @{ @"id": @"1", @"name": @"Blake", @"friends": @[ @{ @"id": @"2", @"name": @"Jeff" } ] },
+                                                   @{ @"id": @"3", @"name": @"Dan" } ] };
+    RKMappingProfiler *profiler = [RKMappingProfiler new];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ @"users": userMapping }];
+    mapper.profiler = profiler;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+    return profiler;
+}
+
+- (void)testProfilingRecordsCountsPerMapping
+{
+    NSDictionary *measurements = [[self profilerByMappingUsers] dictionaryRepresentation];
+    NSArray *objectMappings = measurements[@"objectMappings"];
+    expect(objectMappings).to.haveCountOf(1);
+    expect(objectMappings[0][@"objectClass"]).to.equal(@"RKTestUser");
+    expect(objectMappings[0][@"count"]).to.equal(@3);
+
+    NSPredicate *predicate = [NSPredicate predicateWithFormat:@"sourceKeyPath == 'id'"];
+    NSDictionary *identifierMeasurement = [[measurements[@"propertyMappings"] filteredArrayUsingPredicate:predicate] lastObject];
+    expect(identifierMeasurement[@"type"]).to.equal(@"attribute");
+    expect(identifierMeasurement[@"count"]).to.equal(@3);
+    expect(identifierMeasurement[@"transformationCount"]).to.equal(@3);
+
+    predicate = [NSPredicate predicateWithFormat:@"sourceKeyPath == 'friends'"];
+    NSDictionary *friendsMeasurement = [[measurements[@"propertyMappings"] filteredArrayUsingPredicate:predicate] lastObject];
+    expect(friendsMeasurement[@"type"]).to.equal(@"relationship");
+    expect(friendsMeasurement[@"count"]).to.equal(@1);
+
+    expect([measurements[@"valueTransformers"] count]).to.beGreaterThan(0);
+    expect([NSJSONSerialization JSONObjectWithData:[[self profilerByMappingUsers] JSONDataWithError:nil] options:0 error:nil]).notTo.beNil();
+}
+
+- (void)testProfilingKeyPathsMappedConcurrently
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"id": @"userID" }];
+    NSDictionary *representation = @{ @"users": @[ @{ @"id": @"1", @"name": @"Blake" }, @{ @"id": @"2", @"name": @"Jeff" } ],
+                                      @"admins": @[ @{ @"id": @"3", @"name": @"Dan" } ] };
+    RKMappingProfiler *profiler = [RKMappingProfiler new];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ @"users": userMapping, @"admins": userMapping }];
+    mapper.mappingOperationDataSource = [RKObjectMappingOperationDataSource new];
+    mapper.mapsKeyPathsConcurrently = YES;
+    mapper.profiler = profiler;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+
+    NSArray *objectMappings = [profiler dictionaryRepresentation][@"objectMappings"];
+    expect([[objectMappings valueForKeyPath:@"@sum.count"] integerValue]).to.equal(3);
+    NSString *collapsedStacks = [profiler collapsedStackRepresentation];
+    expect(collapsedStacks).to.contain(@"users:RKTestUser;name");
+    expect(collapsedStacks).to.contain(@"admins:RKTestUser;name");
+}
+
+- (void)testCollapsedStackRepresentation
+{
+    RKMappingProfiler *profiler = [self profilerByMappingUsers];
+    NSArray *lines = [[profiler collapsedStackRepresentation] componentsSeparatedByString:@"\n"];
+    NSMutableArray *stacks = [NSMutableArray array];
+    for (NSString *line in lines) {
+        if ([line length]) [stacks addObject:[line substringToIndex:[line rangeOfString:@" " options:NSBackwardsSearch].location]];
+    }
+    expect(stacks).to.equal(@[ @"users:RKTestUser", @"users:RKTestUser;friends:RKTestUser", @"users:RKTestUser;friends:RKTestUser;id", @"users:RKTestUser;friends:RKTestUser;name", @"users:RKTestUser;id", @"users:RKTestUser;name" ]);
+
+    [profiler reset];
+    expect([profiler collapsedStackRepresentation]).to.equal(@"");
+    expect([profiler dictionaryRepresentation][@"objectMappings"]).to.haveCountOf(0);
+}
+
+- (void)testTransformationsAreAttributedToTheTransformersThatPerformedThem
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"id": @"userID", @"birthDate": @"birthDate" }];
+    RKMappingProfiler *profiler = [RKMappingProfiler new];
+    RKMapperOperation *mapper = [[RKMapperOperation alloc] initWithRepresentation:@{ @"id": @"1", @"birthDate": @"2013-01-15T10:00:00Z" } mappingsDictionary:@{ [NSNull null]: userMapping }];
+    mapper.profiler = profiler;
+    [mapper start];
+    expect(mapper.error).to.beNil();
+
+    NSArray *valueTransformerNames = [[profiler dictionaryRepresentation][@"valueTransformers"] valueForKey:@"name"];
+    expect(valueTransformerNames).to.haveCountOf(2);
+    expect(valueTransformerNames).to.contain(@"RKISO8601DateFormatter");
+    expect(valueTransformerNames).notTo.contain(@"RKCompoundValueTransformer");
+}
+
+@end
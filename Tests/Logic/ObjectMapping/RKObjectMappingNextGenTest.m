@@ -2776,6 +2776,82 @@
     }];
 }
 
+- (void)testMappingCollectionConcurrentlyPreservesOrderAndCollectionIndex
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 1000; index++) {
+        [representations addObject:(index % 100 == 50) ? [NSNull null] : @{ @"name": [NSString stringWithFormat:@"User %ld", (long) index] }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"position" }];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representations mappingsDictionary:@{ [NSNull null]: userMapping }];
+    mapperOperation.mappingOperationDataSource = [RKObjectMappingOperationDataSource new];
+    mapperOperation.mapsCollectionsConcurrently = YES;
+    NSError *error = nil;
+    [mapperOperation execute:&error];
+    NSArray *users = [mapperOperation.mappingResult array];
+    expect(error).to.beNil();
+    expect(users).to.haveCountOf(990);
+    __block NSUInteger expectedIndex = 0;
+    [users enumerateObjectsUsingBlock:^(RKTestUser *user, NSUInteger index, BOOL *stop) {
+        if (expectedIndex % 100 == 50) expectedIndex++;
+        expect(user.position).to.equal(expectedIndex);
+        expect(user.name).to.equal([NSString stringWithFormat:@"User %ld", (long) expectedIndex]);
+        expectedIndex++;
+    }];
+}
+
+- (void)testMappingKeyPathsConcurrentlyAssemblesSingleMappingResult
+{
+    NSDictionary *representation = @{ @"users": @[ @{ @"name": @"Blake Watters" }, @{ @"name": @"Jeff Arena" } ],
+                                      @"addresses": @[ @{ @"city": @"Carrboro" } ],
+                                      @"missing": [NSNull null] };
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.rootKeyPath": @"country" }];
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:representation mappingsDictionary:@{ @"users": userMapping, @"addresses": addressMapping, @"missing": userMapping }];
+    mapperOperation.mappingOperationDataSource = [RKObjectMappingOperationDataSource new];
+    mapperOperation.mapsKeyPathsConcurrently = YES;
+    NSError *error = nil;
+    [mapperOperation execute:&error];
+    expect(error).to.beNil();
+    NSDictionary *results = [mapperOperation.mappingResult dictionary];
+    expect([results allKeys]).to.haveCountOf(2);
+    expect([results[@"users"] valueForKey:@"name"]).to.equal(@[ @"Blake Watters", @"Jeff Arena" ]);
+    expect([results[@"users"] valueForKey:@"country"]).to.equal(@[ @"users", @"users" ]);
+    expect([results[@"addresses"] valueForKey:@"city"]).to.equal(@[ @"Carrboro" ]);
+}
+
+- (void)testMappingInSlicesPreservesOrderAndCollectionIndex
+{
+    NSMutableArray *representations = [NSMutableArray array];
+    for (NSUInteger index = 0; index < 7; index++) {
+        [representations addObject:(index == 3) ? [NSNull null] : @{ @"name": [NSString stringWithFormat:@"User %ld", (long) index] }];
+    }
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [userMapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"@metadata.mapping.collectionIndex": @"position" }];
+    RKMapperOperation *mapperOperation = [[RKMapperOperation alloc] initWithRepresentation:@{ @"users": representations, @"user": @{ @"name": @"Blake Watters" } } mappingsDictionary:@{ @"users": userMapping, @"user": userMapping }];
+    mapperOperation.mappingOperationDataSource = [RKObjectMappingOperationDataSource new];
+    mapperOperation.mapsCollectionsConcurrently = YES;
+    mapperOperation.maximumObjectsPerSlice = 2;
+    __block NSUInteger sliceCount = 0;
+    mapperOperation.sliceExecutionBlock = ^(void (^mappingBlock)(void)) {
+        sliceCount++;
+        mappingBlock();
+    };
+    NSError *error = nil;
+    [mapperOperation execute:&error];
+    expect(error).to.beNil();
+
+    // Four slices of at most two elements of the collection, one for the single representation, and one each for starting and finishing the mapping
+    expect(sliceCount).to.equal(7);
+    NSDictionary *results = [mapperOperation.mappingResult dictionary];
+    expect([results[@"users"] valueForKey:@"name"]).to.equal(@[ @"User 0", @"User 1", @"User 2", @"User 4", @"User 5", @"User 6" ]);
+    expect([results[@"users"] valueForKey:@"position"]).to.equal(@[ @0, @1, @2, @4, @5, @6 ]);
+    expect([results[@"user"] name]).to.equal(@"Blake Watters");
+}
+
 - (void)testMetadataIsMerged
 {
     NSArray *representations = @[ @{ @"name": @"Blake Watters" } ];
@@ -9,9 +9,13 @@
 #import "RKTestEnvironment.h"
 #import "RKTestUser.h"
 #import "RKObjectMappingOperationDataSource.h"
+#import "RKObjectMappingPlan.h"
+#import "RKPropertyInspector.h"
+#import "RKObjectUtilities.h"
+#import "RKCompoundValueTransformer+RKAdditions.h"
 
 @interface RKObjectMappingTest : RKTestCase
-
+@property (nonatomic, strong) NSMutableArray *observedKeyPaths;
 @end
 
 @implementation RKObjectMappingTest
@@ -292,4 +296,341 @@
 }
 
 
+#pragma mark - Execution Plans
+
+- (void)testExecutionPlanPartitionsPropertyMappings
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"name": @"name", @"address.city": @"country" }];
+    [mapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"friends" toKeyPath:@"friends" withMapping:mapping]];
+
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+    expect([plan.keyAttributePlans valueForKey:@"sourceKeyPath"]).to.equal(@[ @"name" ]);
+    expect([plan.keyPathAttributePlans valueForKey:@"sourceKeyPath"]).to.equal(@[ @"address.city" ]);
+    expect([plan.relationshipPlans valueForKey:@"sourceKeyPath"]).to.equal(@[ @"friends" ]);
+}
+
+- (void)testExecutionPlanResolvesDestinationClassAndPrimitiveStatus
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"age" ]];
+
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+    RKPropertyMappingPlan *namePlan = plan.keyAttributePlans[0];
+    RKPropertyMappingPlan *agePlan = plan.keyAttributePlans[1];
+    expect(namePlan.destinationClass).to.equal([NSString class]);
+    expect(namePlan.isDestinationPrimitive).to.beFalsy();
+    expect(agePlan.destinationClass).to.equal([NSNumber class]);
+    expect(agePlan.isDestinationPrimitive).to.beTruthy();
+}
+
+- (void)testExecutionPlanIsInvalidatedWhenPropertyMappingsChange
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKObjectMappingPlan *plan = mapping.executionPlan;
+    expect(mapping.executionPlan).to.beIdenticalTo(plan);
+
+    [mapping addAttributeMappingsFromArray:@[ @"emailAddress" ]];
+    expect(mapping.executionPlan).notTo.beIdenticalTo(plan);
+    expect(mapping.executionPlan.keyAttributePlans).to.haveCountOf(2);
+}
+
+- (void)testCompileCompilesRelationshipMappings
+{
+    RKObjectMapping *userMapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    [userMapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"address" toKeyPath:@"address" withMapping:addressMapping]];
+    [userMapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"friends" toKeyPath:@"friends" withMapping:userMapping]];
+    [userMapping compile];
+
+    expect([userMapping.executionPlan.relationshipPlans[0] destinationClass]).to.equal([RKTestAddress class]);
+    expect(addressMapping.executionPlan.keyAttributePlans).to.haveCountOf(1);
+}
+
+- (void)testPropertyMappingPlanReadsNestedDictionaryValuesWithoutKeyValueCoding
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"user.address.city": @"country" }];
+    RKPropertyMappingPlan *plan = mapping.executionPlan.keyPathAttributePlans[0];
+    expect(plan.requiresKeyValueCodingForSource).to.beFalsy();
+    expect([plan valueForSourceKeyPathOfRepresentation:@{ @"user": @{ @"address": @{ @"city": @"Carrboro" } } }]).to.equal(@"Carrboro");
+    expect([plan valueForSourceKeyPathOfRepresentation:@{ @"user": @{} }]).to.beNil();
+    expect([plan valueForSourceKeyPathOfRepresentation:@{ @"user": [NSNull null] }]).to.beNil();
+}
+
+- (void)testPropertyMappingPlanFallsBackToKeyValueCodingForArraysAndOperators
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromDictionary:@{ @"users.name": @"favoriteColors", @"users.@count": @"luckyNumber" }];
+    NSDictionary *representation = @{ @"users": @[ @{ @"name": @"Blake" }, @{ @"name": @"Jeff" } ] };
+    for (RKPropertyMappingPlan *plan in mapping.executionPlan.keyPathAttributePlans) {
+        if ([plan.sourceKeyPath isEqualToString:@"users.name"]) {
+            expect(plan.requiresKeyValueCodingForSource).to.beFalsy();
+            expect([plan valueForSourceKeyPathOfRepresentation:representation]).to.equal(@[ @"Blake", @"Jeff" ]);
+        } else {
+            expect(plan.requiresKeyValueCodingForSource).to.beTruthy();
+            expect([plan valueForSourceKeyPathOfRepresentation:representation]).to.equal(@2);
+        }
+    }
+}
+
+- (void)testExecutionPlanSubstitutesNestingAttributeValueIntoTemplates
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingFromKeyOfRepresentationToAttribute:@"name"];
+    [mapping addAttributeMappingsFromDictionary:@{ @"(name).email": @"emailAddress", @"position": @"position" }];
+    [mapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"(name).address" toKeyPath:@"address" withMapping:addressMapping]];
+
+    RKObjectMappingPlan *templatePlan = mapping.executionPlan;
+    RKObjectMappingPlan *plan = [templatePlan planBySubstitutingValue:@"blake" forNestingAttribute:@"name" objectMapping:mapping];
+    expect(plan).notTo.beIdenticalTo(templatePlan);
+    RKPropertyMappingPlan *emailPlan = plan.keyPathAttributePlans[0];
+    expect(emailPlan.sourceKeyPath).to.equal(@"blake.email");
+    expect(emailPlan.propertyMapping).to.beIdenticalTo([templatePlan.keyPathAttributePlans[0] propertyMapping]);
+    expect([emailPlan valueForSourceKeyPathOfRepresentation:@{ @"blake": @{ @"email": @"blake@restkit.org" } }]).to.equal(@"blake@restkit.org");
+    expect([plan.relationshipPlans[0] sourceKeyPath]).to.equal(@"blake.address");
+    expect([plan.relationshipPlans[0] destinationClass]).to.equal([RKTestAddress class]);
+
+    // Plans without templated key paths are shared
+    NSUInteger positionIndex = [templatePlan.keyAttributePlans indexOfObjectPassingTest:^BOOL(RKPropertyMappingPlan *candidate, NSUInteger idx, BOOL *stop) {
+        return [candidate.sourceKeyPath isEqualToString:@"position"];
+    }];
+    expect([plan.keyAttributePlans containsObject:templatePlan.keyAttributePlans[positionIndex]]).to.beTruthy();
+    expect([templatePlan planBySubstitutingValue:@"blake" forNestingAttribute:nil objectMapping:mapping]).to.beIdenticalTo(templatePlan);
+}
+
+- (void)testMappingWithExecutionPlanSetsValuesOnKeyValueObservedObjects
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    RKTestUser *user = [RKTestUser new];
+    self.observedKeyPaths = [NSMutableArray array];
+    [user addObserver:self forKeyPath:@"name" options:0 context:nil];
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    [user removeObserver:self forKeyPath:@"name"];
+
+    expect(operation.error).to.beNil();
+    expect(user.name).to.equal(@"Blake");
+    expect(self.observedKeyPaths).to.equal(@[ @"name" ]);
+}
+
+- (void)testPropertyInspectorResolvesAndMemoizesKeyPaths
+{
+    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
+    BOOL isPrimitive = YES;
+    expect([inspector classForPropertyAtKeyPath:@"address.city" ofClass:[RKTestUser class] isPrimitive:&isPrimitive]).to.equal([NSString class]);
+    expect(isPrimitive).to.beFalsy();
+    expect([inspector classForPropertyAtKeyPath:@"friend.age" ofClass:[RKTestUser class] isPrimitive:&isPrimitive]).to.equal([NSNumber class]);
+    expect(isPrimitive).to.beTruthy();
+    expect([inspector classForPropertyAtKeyPath:@"address.invalid" ofClass:[RKTestUser class] isPrimitive:nil]).to.beNil();
+
+    // Memoized resolutions must agree with the uncached lookups
+    expect([inspector classForPropertyAtKeyPath:@"address.city" ofClass:[RKTestUser class] isPrimitive:&isPrimitive]).to.equal([NSString class]);
+    expect(isPrimitive).to.beFalsy();
+    expect([inspector classForPropertyAtKeyPath:@"address.invalid" ofClass:[RKTestUser class] isPrimitive:nil]).to.beNil();
+    expect([[RKTestUser new] rk_classForPropertyAtKeyPath:@"address.city" isPrimitive:nil]).to.equal([NSString class]);
+}
+
+- (void)testPropertyInspectorIsSafeToQueryConcurrently
+{
+    RKPropertyInspector *inspector = [RKPropertyInspector sharedInspector];
+    NSArray *keyPaths = @[ @"name", @"age", @"address", @"address.city", @"friend.name", @"friend.address.city" ];
+    __block NSUInteger mismatches = 0;
+    dispatch_apply(256, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        NSString *keyPath = keyPaths[iteration % [keyPaths count]];
+        Class expectedClass = [keyPath isEqualToString:@"age"] ? [NSNumber class] : ([keyPath isEqualToString:@"address"] ? [RKTestAddress class] : [NSString class]);
+        if ([inspector classForPropertyAtKeyPath:keyPath ofClass:[RKTestUser class] isPrimitive:nil] != expectedClass) {
+            @synchronized(keyPaths) {
+                mismatches++;
+            }
+        }
+    });
+    expect(mismatches).to.equal(0);
+}
+
+- (void)testFingerprintingSkipsMappingOfUnchangedRepresentations
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [mapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:@"address" toKeyPath:@"address" withMapping:addressMapping]];
+    mapping.fingerprintsRepresentations = YES;
+    RKTestUser *user = [RKTestUser new];
+    RKObjectMappingOperationDataSource *dataSource = [RKObjectMappingOperationDataSource new];
+
+    NSDictionary *representation = @{ @"name": @"Blake", @"address": @{ @"city": @"Carrboro" } };
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:user mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(user.name).to.equal(@"Blake");
+
+    // An identical representation is skipped, leaving local changes in place
+    user.name = @"Local";
+    operation = [[RKMappingOperation alloc] initWithSourceObject:[representation mutableCopy] destinationObject:user mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect(user.name).to.equal(@"Local");
+
+    // A change within a nested representation is mapped
+    operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"address": @{ @"city": @"New York" } } destinationObject:user mapping:mapping];
+    operation.dataSource = dataSource;
+    [operation start];
+    expect(user.name).to.equal(@"Blake");
+    expect(user.address.city).to.equal(@"New York");
+}
+
+- (void)testFingerprintingDistinguishesMissingValuesFromNull
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"emailAddress" ]];
+    mapping.fingerprintsRepresentations = YES;
+    RKTestUser *user = [RKTestUser new];
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    user.emailAddress = @"blake@restkit.org";
+
+    operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"emailAddress": [NSNull null] } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    expect(user.emailAddress).to.beNil();
+}
+
+- (void)testFingerprintingCoversEntireRepresentationForNilSourceKeyPaths
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [mapping addPropertyMapping:[RKRelationshipMapping relationshipMappingFromKeyPath:nil toKeyPath:@"address" withMapping:addressMapping]];
+    mapping.fingerprintsRepresentations = YES;
+    RKTestUser *user = [RKTestUser new];
+
+    RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"city": @"Carrboro" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    expect(user.address.city).to.equal(@"Carrboro");
+
+    operation = [[RKMappingOperation alloc] initWithSourceObject:@{ @"name": @"Blake", @"city": @"New York" } destinationObject:user mapping:mapping];
+    operation.dataSource = [RKObjectMappingOperationDataSource new];
+    [operation start];
+    expect(operation.error).to.beNil();
+    expect(user.address.city).to.equal(@"New York");
+}
+
+- (void)testFingerprintOfObjectReflectsFullContent
+{
+    NSString *longString = [@"" stringByPaddingToLength:500 withString:@"a" startingAtIndex:0];
+    NSString *changedLongString = [[longString substringToIndex:250] stringByAppendingString:[@"" stringByPaddingToLength:250 withString:@"b" startingAtIndex:0]];
+    expect(RKFingerprintForObject(longString)).notTo.equal(RKFingerprintForObject(changedLongString));
+    expect(RKFingerprintForObject(@{ @"a": @1, @"b": @[ @2, @3 ] })).to.equal(RKFingerprintForObject(@{ @"b": @[ @2, @3 ], @"a": @1 }));
+    expect(RKFingerprintForObject(@{ @"a": @1, @"b": @[ @2, @3 ] })).notTo.equal(RKFingerprintForObject(@{ @"a": @1, @"b": @[ @3, @2 ] }));
+    expect(RKFingerprintForObject(@1)).notTo.equal(RKFingerprintForObject(@YES));
+    expect(RKFingerprintForObject(nil)).notTo.equal(RKFingerprintForObject([NSNull null]));
+}
+
+- (void)testFreezingCompilesAndFreezesTheMappingGraph
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [mapping addRelationshipMappingWithSourceKeyPath:@"address" mapping:addressMapping];
+    expect(mapping.isFrozen).to.equal(NO);
+
+    [mapping freeze];
+    expect(mapping.isFrozen).to.equal(YES);
+    expect(addressMapping.isFrozen).to.equal(YES);
+    expect([mapping.propertyMappings valueForKey:@"frozen"]).to.equal(@[ @YES, @YES ]);
+    expect([mapping executionPlan]).to.beIdenticalTo([mapping executionPlan]);
+
+    expect(^{ [mapping addAttributeMappingsFromArray:@[ @"emailAddress" ]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [mapping removePropertyMapping:[mapping mappingForAttribute:@"name"]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ mapping.assignsDefaultValueForMissingAttributes = YES; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ addressMapping.forceCollectionMapping = YES; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [mapping mappingForAttribute:@"name"].valueTransformer = nil; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [mapping mappingForRelationship:@"address"].assignmentPolicy = RKUnionAssignmentPolicy; }).to.raise(NSInternalInconsistencyException);
+    expect([mapping.propertyMappings count]).to.equal(2);
+}
+
+- (void)testFreezingReplacesTheCompoundValueTransformerWithAFrozenCopy
+{
+    RKCompoundValueTransformer *valueTransformer = [[RKValueTransformer defaultValueTransformer] copy];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    mapping.valueTransformer = valueTransformer;
+    RKAttributeMapping *attributeMapping = [mapping mappingForAttribute:@"name"];
+    attributeMapping.valueTransformer = [valueTransformer copy];
+
+    [mapping freeze];
+    RKCompoundValueTransformer *frozenValueTransformer = (RKCompoundValueTransformer *)mapping.valueTransformer;
+    expect(frozenValueTransformer).notTo.beIdenticalTo(valueTransformer);
+    expect(frozenValueTransformer.isFrozen).to.equal(YES);
+    expect([frozenValueTransformer valueTransformersForTransformingFromClass:[NSString class] toClass:[NSDate class]]).to.equal([valueTransformer valueTransformersForTransformingFromClass:[NSString class] toClass:[NSDate class]]);
+    expect(^{ [frozenValueTransformer addValueTransformer:[RKValueTransformer identityValueTransformer]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [frozenValueTransformer removeValueTransformer:[RKValueTransformer identityValueTransformer]]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ [(RKCompoundValueTransformer *)attributeMapping.valueTransformer insertValueTransformer:[RKValueTransformer identityValueTransformer] atIndex:0]; }).to.raise(NSInternalInconsistencyException);
+    expect(^{ mapping.dateFormatters = @[]; }).to.raise(NSInternalInconsistencyException);
+
+    // The original transformer may be shared and remains mutable
+    expect(valueTransformer.isFrozen).to.equal(NO);
+    [valueTransformer addValueTransformer:[RKValueTransformer identityValueTransformer]];
+
+    RKObjectMapping *copy = [mapping copy];
+    expect([(RKCompoundValueTransformer *)copy.valueTransformer isFrozen]).to.equal(NO);
+}
+
+- (void)testCopyOfFrozenMappingIsMutable
+{
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name" ]];
+    [mapping freeze];
+
+    RKObjectMapping *copy = [mapping copy];
+    expect(copy.isFrozen).to.equal(NO);
+    [copy addAttributeMappingsFromArray:@[ @"emailAddress" ]];
+    expect([copy.propertyMappings count]).to.equal(2);
+    expect([mapping.propertyMappings count]).to.equal(1);
+}
+
+- (void)testFrozenMappingIsSafeToShareAcrossThreads
+{
+    RKObjectMapping *addressMapping = [RKObjectMapping mappingForClass:[RKTestAddress class]];
+    [addressMapping addAttributeMappingsFromArray:@[ @"city" ]];
+    RKObjectMapping *mapping = [RKObjectMapping mappingForClass:[RKTestUser class]];
+    [mapping addAttributeMappingsFromArray:@[ @"name", @"age" ]];
+    [mapping addRelationshipMappingWithSourceKeyPath:@"address" mapping:addressMapping];
+    [mapping freeze];
+
+    __block NSUInteger failures = 0;
+    dispatch_apply(256, dispatch_get_global_queue(DISPATCH_QUEUE_PRIORITY_DEFAULT, 0), ^(size_t iteration) {
+        NSDictionary *representation = @{ @"name": [NSString stringWithFormat:@"User %zu", iteration], @"age": @(iteration), @"address": @{ @"city": @"New York" } };
+        RKTestUser *user = [RKTestUser new];
+        RKMappingOperation *operation = [[RKMappingOperation alloc] initWithSourceObject:representation destinationObject:user mapping:mapping];
+        operation.dataSource = [RKObjectMappingOperationDataSource new];
+        [operation start];
+        if (operation.error || ! [user.name isEqualToString:representation[@"name"]] || user.age != (NSInteger)iteration || ! [user.address.city isEqualToString:@"New York"]) {
+            @synchronized(mapping) {
+                failures++;
+            }
+        }
+    });
+    expect(failures).to.equal(0);
+}
+
+- (void)observeValueForKeyPath:(NSString *)keyPath ofObject:(id)object change:(NSDictionary *)change context:(void *)context
+{
+    [self.observedKeyPaths addObject:keyPath];
+}
+
 @end
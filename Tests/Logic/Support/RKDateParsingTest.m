@@ -0,0 +1,64 @@
+//
+//  RKDateParsingTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKDateParsing.h"
+
+@interface RKDateParsingTest : RKTestCase
+
+@end
+
+@implementation RKDateParsingTest
+
+- (void)testParsingISO8601Timestamps
+{
+    NSTimeInterval timeInterval = 0;
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05T14:48:00.125Z", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(1317826080.125);
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05T14:48:00-0500", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(1317844080);
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-08-09T00:00Z", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(1312848000);
+    expect(RKGetTimeIntervalFromISO8601String(@"2000-02-29T23:59:59+01:00", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(951865199);
+}
+
+- (void)testParsingISO8601TimestampFromNonASCIIBackedString
+{
+    NSString *string = [NSString stringWithFormat:@"%@%@", @"1970-01-01T00:00:00Z", @"é"];
+    string = [string substringToIndex:[string length] - 1];
+    NSTimeInterval timeInterval = -1;
+    expect(RKGetTimeIntervalFromISO8601String(string, &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(0);
+}
+
+- (void)testParsingISO8601TimestampsThatRequireADateFormatterFails
+{
+    NSTimeInterval timeInterval = 0;
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05T14:48:00", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-02-29T00:00:00Z", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(@"1500-01-01T00:00:00Z", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05T14:48:00.Z", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(@"2011-10-05T14:48:00Zé", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromISO8601String(nil, &timeInterval)).to.beFalsy();
+}
+
+- (void)testParsingDotNetDates
+{
+    NSTimeInterval timeInterval = 0;
+    expect(RKGetTimeIntervalFromDotNetDateString(@"/Date(1000212360000-0400)/", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(1000212360);
+    expect(RKGetTimeIntervalFromDotNetDateString(@"/Date(-864000000000)/", &timeInterval)).to.beTruthy();
+    expect(timeInterval).to.equal(-864000000);
+    expect(RKGetTimeIntervalFromDotNetDateString(@"/Date()/", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromDotNetDateString(@"1112715000-0500", &timeInterval)).to.beFalsy();
+    expect(RKGetTimeIntervalFromDotNetDateString(@"/Date(1112715000000)/ ", &timeInterval)).to.beFalsy();
+}
+
+@end
@@ -0,0 +1,81 @@
+//
+//  RKJSONStreamReaderTest.m
+//  RestKit
+//
+//  Created by RestKit on 10/17/26.
+//  Copyright (c) 2026 RestKit. All rights reserved.
+//
+
+#import "RKTestEnvironment.h"
+#import "RKJSONStreamReader.h"
+
+@interface RKJSONStreamReaderTest : RKTestCase
+
+@end
+
+@implementation RKJSONStreamReaderTest
+
+- (RKJSONStreamReader *)readerWithString:(NSString *)string
+{
+    return [[RKJSONStreamReader alloc] initWithData:[string dataUsingEncoding:NSUTF8StringEncoding]];
+}
+
+- (void)testEnumeratingArrayAtKeyPath
+{
+    RKJSONStreamReader *reader = [self readerWithString:@"{\"meta\": {\"count\": 3, \"tags\": [\"a\", \"]\"]}, \"catalog\": {\"products\": [{\"name\": \"One\"}, 2, \"thr\\\"ee\"]}}"];
+    expect([reader validateStructure:nil]).to.beTruthy();
+    id products = [reader valueAtKeyPath:@"catalog.products"];
+    expect(products).to.beKindOf([NSEnumerator class]);
+    expect([products allObjects]).to.equal(@[ @{ @"name": @"One" }, @2, @"thr\"ee" ]);
+    expect([reader valueForKeyPath:@"meta.count"]).to.equal(@3);
+    expect([reader valueAtKeyPath:@"meta.missing"]).to.beNil();
+    expect(reader.error).to.beNil();
+}
+
+- (void)testEnumeratingTopLevelArray
+{
+    RKJSONStreamReader *reader = [self readerWithString:@" [ ] "];
+    expect([[reader valueAtKeyPath:nil] allObjects]).to.equal(@[]);
+    reader = [self readerWithString:@"[{\"id\": 1}, {\"id\": 2}]"];
+    expect([[reader valueAtKeyPath:nil] allObjects]).to.equal(@[ @{ @"id": @1 }, @{ @"id": @2 } ]);
+}
+
+- (void)testEvaluatingKeyPathThroughArrayWithKeyValueCoding
+{
+    RKJSONStreamReader *reader = [self readerWithString:@"{\"users\": [{\"name\": \"Blake\"}, {\"name\": \"Jeff\"}]}"];
+    expect([reader valueForKeyPath:@"users.name"]).to.equal(@[ @"Blake", @"Jeff" ]);
+}
+
+- (void)testDuplicateKeysResolveToTheirLastValueLikeNSJSONSerialization
+{
+    NSString *string = @"{\"meta\": {\"count\": 1}, \"users\": [1], \"meta\": {\"count\": 2, \"count\": 3}, \"users\": [2, 3]}";
+    NSDictionary *object = [NSJSONSerialization JSONObjectWithData:[string dataUsingEncoding:NSUTF8StringEncoding] options:0 error:nil];
+    RKJSONStreamReader *reader = [self readerWithString:string];
+    expect([reader valueForKeyPath:@"meta.count"]).to.equal([object valueForKeyPath:@"meta.count"]);
+    expect([[reader valueAtKeyPath:@"users"] allObjects]).to.equal(object[@"users"]);
+    expect([reader valueAtKeyPath:@"meta"]).to.equal(object[@"meta"]);
+    expect(reader.error).to.beNil();
+}
+
+- (void)testValidatingTruncatedDocumentFails
+{
+    RKJSONStreamReader *reader = [self readerWithString:@"{\"products\": [{\"name\": \"One\"}, {\"name\": \"Tw"];
+    NSError *error = nil;
+    expect([reader validateStructure:&error]).to.beFalsy();
+    expect(error).notTo.beNil();
+    expect([[self readerWithString:@"[1, 2]]"] validateStructure:nil]).to.beFalsy();
+    expect([[self readerWithString:@"{\"a\": [1}"] validateStructure:nil]).to.beFalsy();
+}
+
+- (void)testEnumeratingMalformedElementRecordsError
+{
+    RKJSONStreamReader *reader = [self readerWithString:@"[{\"id\": 1}, {\"id\": tru}, {\"id\": 3}]"];
+    expect([reader validateStructure:nil]).to.beTruthy();
+    NSEnumerator *enumerator = [reader valueAtKeyPath:nil];
+    expect([enumerator nextObject]).to.equal(@{ @"id": @1 });
+    expect([enumerator nextObject]).to.beNil();
+    expect([enumerator nextObject]).to.beNil();
+    expect(reader.error).notTo.beNil();
+}
+
+@end